@@ -1066,6 +1066,7 @@
 #define ts_command_e_TS_X14 20
 #define TS_COMMAND_F 'F'
 #define TS_COMMAND_F_char F
+#define TS_COMPOSITE_COMPACT_ENABLE 7
 #define TS_COMPOSITE_DISABLE 2
 #define TS_COMPOSITE_ENABLE 1
 #define TS_COMPOSITE_READ 3
@@ -1079,6 +1080,8 @@
 #define TS_GET_COMPOSITE_BUFFER_DONE_DIFFERENTLY_char 8
 #define TS_GET_CONFIG_ERROR 'e'
 #define TS_GET_CONFIG_ERROR_char e
+#define TS_GET_EDGE_LATENCY 'y'
+#define TS_GET_EDGE_LATENCY_char y
 #define TS_GET_FIRMWARE_VERSION 'V'
 #define TS_GET_FIRMWARE_VERSION_char V
 #define TS_GET_OUTPUTS_SIZE '4'
@@ -1195,6 +1198,7 @@
 #define TS_TRIGGER_SCOPE_CHANNEL_2_NAME "Channel 2"
 #define TS_TRIGGER_SCOPE_DISABLE 5
 #define TS_TRIGGER_SCOPE_ENABLE 4
+#define TS_TRIGGER_SCOPE_ENVELOPE_ENABLE 8
 #define TS_TRIGGER_SCOPE_READ 6
 #define TsCalMode_EtbKd 5
 #define TsCalMode_EtbKi 4
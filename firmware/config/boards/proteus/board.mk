@@ -49,7 +49,6 @@ DDEFS += -DOPENBLT_CAN_TX_PIN=1
 DDEFS += -DHW_PROTEUS=1
 
 ifeq ($(PROJECT_CPU),ARCH_STM32F7)
-  # todo: KNOCK_SPECTROGRAM to use big_buffer
 	DDEFS += -DKNOCK_SPECTROGRAM=TRUE
 	DDEFS += -DLUA_RX_MAX_FILTER_COUNT=96
 	DDEFS += -DSTATIC_BOARD_ID=STATIC_BOARD_ID_PROTEUS_F7
@@ -155,6 +155,37 @@
 #define EFI_TS_SCATTER TRUE
 #endif
 
+// changed byte ranges of output channels, costs TS_TOTAL_OUTPUT_SIZE of RAM per TS channel, see ts_output_delta.h
+#ifndef EFI_TS_OUTPUT_DELTA
+#define EFI_TS_OUTPUT_DELTA FALSE
+#endif
+
+// all TS channels share output channels gathered once per period, costs two TS_TOTAL_OUTPUT_SIZE buffers
+#ifndef EFI_LIVE_DATA_SNAPSHOT
+#define EFI_LIVE_DATA_SNAPSHOT FALSE
+#endif
+
+// whole buffer CRC32 on the CRC unit, see crc32_fast.h
+#ifndef EFI_CRC32_HW
+#define EFI_CRC32_HW FALSE
+#endif
+
+// TS page CRC check only reads blocks written since previous check, opt-in since every
+// firmware side configuration writer has to report to onConfigurationAreaChanged
+#ifndef EFI_TS_PAGE_CRC_CACHE
+#define EFI_TS_PAGE_CRC_CACHE FALSE
+#endif
+
+// trigger emulator plays all channels from one precompiled edge timeline instead of PWM per channel
+#ifndef EFI_TRIGGER_EMULATOR_TIMELINE
+#define EFI_TRIGGER_EMULATOR_TIMELINE TRUE
+#endif
+
+// trigger sync point comes from table generated by unit tests instead of decoder simulation
+#ifndef EFI_TRIGGER_SHAPE_DB
+#define EFI_TRIGGER_SHAPE_DB TRUE
+#endif
+
 /**
  * Bluetooth UART setup support.
  */
@@ -191,6 +222,21 @@
 #define EFI_SIGNAL_EXECUTOR_SLEEP FALSE
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER TRUE
 
+// slow software PWM channels share one scheduler entry, see pwm_bank.h
+#ifndef EFI_PWM_BANK
+#define EFI_PWM_BANK TRUE
+#endif
+
+// scheduled vs actual injector and coil edge time, see edge_latency.h
+#ifndef EFI_OUTPUT_EDGE_LATENCY
+#define EFI_OUTPUT_EDGE_LATENCY TRUE
+#endif
+
+// per EngineModule CPU time of fast/slow/engine phase hooks, see engine_module_timing.h
+#ifndef EFI_ENGINE_MODULE_TIMING
+#define EFI_ENGINE_MODULE_TIMING FALSE
+#endif
+
 #define FUEL_MATH_EXTREME_LOGGING FALSE
 
 #define SPARK_EXTREME_LOGGING FALSE
@@ -212,6 +258,15 @@
 #define EFI_STORAGE_INT_FLASH   TRUE
 #endif
 
+/**
+ * Keep EFI_STORAGE_INT_FLASH items as append-only journal spread over both settings sectors
+ * Only changed chunks are written on burn, sector is erased only when journal is compacted
+ * Requires second settings copy sector and EFI_ACTIVE_CONFIGURATION_IN_FLASH == FALSE
+ */
+#ifndef EFI_STORAGE_INT_FLASH_JOURNAL
+#define EFI_STORAGE_INT_FLASH_JOURNAL	FALSE
+#endif
+
 /**
  * ChibiOS Managed Flash Storage
  * Can store finite number of records, can update/add while there is free space in bank.
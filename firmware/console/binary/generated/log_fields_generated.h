@@ -455,6 +455,20 @@ static LOG_FIELD_CONSTNESS_SPECIFIER_STORAGE MLG::Entries::Field fields[] = {
 	{engine->outputChannels.mapPerCylinder[9], "mapPerCylinder 10", "kPa", 0},
 	{engine->outputChannels.mapPerCylinder[10], "mapPerCylinder 11", "kPa", 0},
 	{engine->outputChannels.mapPerCylinder[11], "mapPerCylinder 12", "kPa", 0},
+	{engine->outputChannels.smartGpioSpiLatencyAvg, "Smart GPIO: SPI latency avg", "us", 0},
+	{engine->outputChannels.smartGpioSpiLatencyMax, "Smart GPIO: SPI latency max", "us", 0},
+	{engine->outputChannels.edgeLatencyInjectorMax, "Timing: injector edge late max", "us", 1},
+	{engine->outputChannels.edgeLatencyInjectorMean, "Timing: injector edge late mean", "us", 2},
+	{engine->outputChannels.edgeLatencyCoilMax, "Timing: coil edge late max", "us", 1},
+	{engine->outputChannels.edgeLatencyCoilMean, "Timing: coil edge late mean", "us", 2},
+	{engine->outputChannels.edgeLatencyQueueMax, "Timing: scheduler late max", "us", 1},
+	{engine->outputChannels.edgeLatencyQueueMean, "Timing: scheduler late mean", "us", 2},
+	{engine->outputChannels.engineModulesFastUs, "Timing: modules fast callback", "us", 2},
+	{engine->outputChannels.engineModulesHeaviestFastUs, "Timing: heaviest module fast callback", "us", 2},
+	{engine->outputChannels.engineModulesHeaviestFastMaxUs, "Timing: heaviest module fast callback max", "us", 2},
+	{engine->outputChannels.engineModulesHeaviestFastIndex, "Timing: heaviest module index", "", 0},
+	{engine->outputChannels.engineModulesSlowUs, "Timing: modules slow callback", "us", 2},
+	{engine->outputChannels.engineModulesPhaseUs, "Timing: modules engine phase", "us", 2},
 	{engine->ignitionState.baseDwell, "Ignition: base dwell", "ms", 1, "Timing"},
 	{engine->ignitionState.sparkDwell, "Ignition: coil charge time", "ms", 1, "Timing"},
 	{engine->ignitionState.dwellDurationAngle, "Ignition: dwell duration", "deg", 1, "Timing"},
@@ -370,367 +370,381 @@ mapPerCylinder9("mapPerCylinder 9", SensorCategory.SENSOR_INPUTS, FieldType.INT8
 mapPerCylinder10("mapPerCylinder 10", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 881, 1.0, 0.0, 0.0, "kPa"),
 mapPerCylinder11("mapPerCylinder 11", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 882, 1.0, 0.0, 0.0, "kPa"),
 mapPerCylinder12("mapPerCylinder 12", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 883, 1.0, 0.0, 0.0, "kPa"),
-totalFuelCorrection("Fuel: Total correction", SensorCategory.SENSOR_INPUTS, FieldType.INT, 884, 1.0, 0.0, 3.0, "mult"),
-running("running", SensorCategory.SENSOR_INPUTS, FieldType.INT, 888, 1.0, -1.0, -1.0, ""),
-afrTableYAxis("afrTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 908, 0.01, 0.0, 0.0, "%"),
-targetLambda("Fuel: target lambda", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 910, 1.0E-4, 0.5, 1.5, ""),
-targetAFR("Fuel: target AFR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 912, 0.001, 10.0, 20.0, "ratio"),
-stoichiometricRatio("Fuel: Stoich ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 914, 0.001, 0.0, 0.0, "ratio"),
-sdTcharge_coff("sdTcharge_coff", SensorCategory.SENSOR_INPUTS, FieldType.INT, 916, 1.0, -1.0, -1.0, ""),
-sdAirMassInOneCylinder("Air: Cylinder airmass", SensorCategory.SENSOR_INPUTS, FieldType.INT, 920, 1.0, 0.0, 0.0, "g"),
-normalizedCylinderFilling("Air: Normalized cyl filling", SensorCategory.SENSOR_INPUTS, FieldType.INT, 924, 1.0, 0.0, 100.0, "%"),
-brokenInjector("brokenInjector", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 928, 1.0, -1.0, -1.0, ""),
-unused88("unused88", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 929, 1.0, -1.0, -1.0, ""),
-idealEngineTorque("idealEngineTorque", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 930, 1.0, -1.0, -1.0, ""),
-baseDwell("Ignition: base dwell", SensorCategory.SENSOR_INPUTS, FieldType.INT, 936, 1.0, 0.0, 30.0, "ms"),
-sparkDwell("Ignition: coil charge time", SensorCategory.SENSOR_INPUTS, FieldType.INT, 940, 1.0, 0.0, 30.0, "ms"),
-dwellDurationAngle("Ignition: dwell duration\nas crankshaft angle\nNAN if engine is stopped\nSee also sparkDwell", SensorCategory.SENSOR_INPUTS, FieldType.INT, 944, 1.0, 0.0, 120.0, "deg"),
-cltTimingCorrection("Ign: CLT correction", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 948, 0.01, -20.0, 20.0, "deg"),
-timingIatCorrection("Ign: IAT correction", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 950, 0.01, -20.0, 20.0, "deg"),
-timingPidCorrection("Idle: Timing adjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 952, 0.01, -20.0, 20.0, "deg"),
-dfcoTimingRetard("DFCO: Timing retard", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 954, 0.01, 0.0, 50.0, "deg"),
-baseIgnitionAdvance("Timing: base ignition", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 956, 0.02, 0.0, 0.0, "deg"),
-correctedIgnitionAdvance("Timing: ignition", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 958, 0.02, 0.0, 0.0, "deg"),
-tractionAdvanceDrop("Traction: timing correction", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 960, 0.02, 0.0, 0.0, "deg"),
-alignmentFill_at_26("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 962, 1.0, 0.0, 100.0, "units"),
-dwellVoltageCorrection("Ign: Dwell voltage correction", SensorCategory.SENSOR_INPUTS, FieldType.INT, 964, 1.0, -1.0, -1.0, ""),
-luaTimingAdd("Ign: Lua timing add", SensorCategory.SENSOR_INPUTS, FieldType.INT, 968, 1.0, -20.0, 20.0, "deg"),
-luaTimingMult("Ign: Lua timing mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 972, 1.0, -20.0, 20.0, "deg"),
-trailingSparkAngle("Ign: Trailing spark deg", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 980, 0.01, -20.0, 20.0, "deg"),
-rpmForIgnitionTableDot("rpmForIgnitionTableDot", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 982, 1.0, -1.0, -1.0, ""),
-rpmForIgnitionIdleTableDot("rpmForIgnitionIdleTableDot", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 984, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_50("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 986, 1.0, 0.0, 100.0, "units"),
-loadForIgnitionTableDot("loadForIgnitionTableDot", SensorCategory.SENSOR_INPUTS, FieldType.INT, 988, 1.0, -1.0, -1.0, ""),
-m_knockLevel("Knock: Current level", SensorCategory.SENSOR_INPUTS, FieldType.INT, 992, 1.0, 0.0, 0.0, "Volts"),
-m_knockCyl1("Knock: Cyl 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 996, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl2("Knock: Cyl 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 997, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl3("Knock: Cyl 3", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 998, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl4("Knock: Cyl 4", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 999, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl5("Knock: Cyl 5", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1000, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl6("Knock: Cyl 6", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1001, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl7("Knock: Cyl 7", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1002, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl8("Knock: Cyl 8", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1003, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl9("Knock: Cyl 9", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1004, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl10("Knock: Cyl 10", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1005, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl11("Knock: Cyl 11", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1006, 1.0, 0.0, 0.0, "dBv"),
-m_knockCyl12("Knock: Cyl 12", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1007, 1.0, 0.0, 0.0, "dBv"),
-m_knockRetard("Knock: Retard", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1008, 1.0, 0.0, 0.0, "deg"),
-m_knockThreshold("Knock: Threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1012, 1.0, -1.0, -1.0, ""),
-m_knockCount("Knock: Count", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1016, 1.0, 0.0, 0.0, ""),
-m_maximumRetard("Knock: Max retard", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1020, 1.0, -1.0, -1.0, ""),
-m_knockSpectrum1("Knock: SpectrumData 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1024, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum2("Knock: SpectrumData 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1028, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum3("Knock: SpectrumData 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1032, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum4("Knock: SpectrumData 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1036, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum5("Knock: SpectrumData 5", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1040, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum6("Knock: SpectrumData 6", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1044, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum7("Knock: SpectrumData 7", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1048, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum8("Knock: SpectrumData 8", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1052, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum9("Knock: SpectrumData 9", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1056, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum10("Knock: SpectrumData 10", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1060, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum11("Knock: SpectrumData 11", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1064, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum12("Knock: SpectrumData 12", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1068, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum13("Knock: SpectrumData 13", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1072, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum14("Knock: SpectrumData 14", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1076, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum15("Knock: SpectrumData 15", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1080, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrum16("Knock: SpectrumData 16", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1084, 1.0, 0.0, 0.0, "compressed data"),
-m_knockSpectrumChannelCyl("Knock: ChannelAndCylNumber", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1088, 1.0, 0.0, 0.0, "compressed N + N"),
-m_knockFrequencyStart("Knock: Start Freq", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1090, 1.0, 0.0, 0.0, "Hz"),
-m_knockFrequencyStep("Knock: Step Freq", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1092, 1.0, 0.0, 0.0, "Hz"),
-m_knockFuelTrimMultiplier("Knock: Fuel trim when knock", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1096, 1.0, 0.0, 0.0, "multiplier"),
-tcuCurrentGear("TCU: Current Gear", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1104, 1.0, -1.0, 10.0, "gear"),
-alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1105, 1.0, 0.0, 100.0, "units"),
-tcRatio("TCU: Torque Converter Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1106, 0.01, 0.0, 0.0, "value"),
-lastShiftTime("lastShiftTime", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1108, 1.0, -1.0, -1.0, ""),
-tcu_currentRange("TCU: Current Range", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1112, 1.0, 0.0, 0.0, ""),
-pressureControlDuty("TCU: EPC Duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1113, 1.0, 0.0, 100.0, "%"),
-torqueConverterDuty("TCU: TC Duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1114, 1.0, 0.0, 100.0, "%"),
-alignmentFill_at_11("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1115, 1.0, 0.0, 100.0, "units"),
-throttleModelCrossoverAngle("Air: Throttle crossover pos", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1124, 0.01, 0.0, 100.0, "%"),
-alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1126, 1.0, 0.0, 100.0, "units"),
-throttleEstimatedFlow("Air: Throttle flow estimate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1128, 1.0, 0.0, 5.0, "g/s"),
-m_requested_pump("GDI: HPFP duration\nComputed requested pump duration in degrees (not including deadtime)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1132, 1.0, -1.0, -1.0, ""),
-fuel_requested_percent("GDI: HPFP requested duty", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1136, 1.0, 0.0, 100.0, "%"),
-fuel_requested_percent_pi("GDI: percent_pi", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1140, 1.0, -1.0, -1.0, ""),
-m_pressureTarget_kPa("GDI: target pressure", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1148, 1.0, -1.0, -1.0, ""),
-hpfp_p_control_percent("hpfp_p_control_percent", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1152, 1.0, -1.0, -1.0, ""),
-hpfp_i_control_percent("hpfp_i_control_percent", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1156, 1.0, -1.0, -1.0, ""),
-nextLobe("GDI: next lobe N", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1160, 1.0, -1.0, -1.0, ""),
-di_nextStart("GDI: valve activation angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1164, 1.0, 0.0, 100.0, "v"),
-HpfdActivationPhase("GDI: HPFP activation angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1168, 1.0, -1.0, -1.0, ""),
-HpfdDeactivationPhase("GDI: HPFP deactivation angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1172, 1.0, -1.0, -1.0, ""),
-m_deadtime("Fuel: injector lag", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1176, 1.0, 0.0, 0.0, "ms"),
-pressureDelta("Fuel: Injector pressure delta", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1180, 1.0, -1000.0, 1000.0, "kPa"),
-pressureRatio("Fuel: Injector pressure ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1184, 1.0, 0.0, 100.0, ""),
-pressureCorrectionReference("Fuel: corr reference pressure", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1188, 1.0, 0.0, 1000.0, "kPa"),
-retardThresholdRpm("Launch: Retard threshold RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1192, 1.0, -1.0, -1.0, ""),
-trqRedCutXaxisValue("trqRedCutXaxisValue", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1204, 1.0, -1.0, -1.0, ""),
-trqRedTimeXaxisValue("trqRedTimeXaxisValue", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1206, 1.0, -1.0, -1.0, ""),
-trqRedIgnRetXaxisValue("trqRedIgnRetXaxisValue", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1208, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_10("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1210, 1.0, 0.0, 100.0, "units"),
-fuelALSCorrection("fuelALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1216, 1.0, -1.0, -1.0, ""),
-timingALSCorrection("timingALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1220, 0.01, -20.0, 20.0, "deg"),
-timingALSSkip("timingALSSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1222, 0.01, 0.0, 50.0, "deg"),
-luaTargetAdd("Boost: Lua target add", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1228, 0.5, -100.0, 100.0, "percent"),
-alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1230, 1.0, 0.0, 100.0, "units"),
-luaTargetMult("Boost: Lua target mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1232, 1.0, -100.0, 100.0, ""),
-boostControlTarget("Boost: Target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1236, 0.03333333333333333, 0.0, 300.0, "kPa"),
-alignmentFill_at_14("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1238, 1.0, 0.0, 100.0, "units"),
-openLoopPart("Boost: Open loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1240, 1.0, -100.0, 100.0, "percent"),
-openLoopYAxis("openLoopYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1244, 0.1, -1000.0, 1000.0, ""),
-alignmentFill_at_22("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1246, 1.0, 0.0, 100.0, "units"),
-luaOpenLoopAdd("Boost: Lua open loop add", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1248, 1.0, -100.0, 100.0, "percent"),
-boostControllerClosedLoopPart("Boost: Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1252, 0.5, -50.0, 50.0, "%"),
-alignmentFill_at_29("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1253, 1.0, 0.0, 100.0, "units"),
-boostOutput("Boost: Output", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1254, 0.01, -100.0, 100.0, "percent"),
-acButtonState("AC switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1256, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1257, 1.0, 0.0, 100.0, "units"),
-radiatorFanStatus("radiatorFanStatus", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1272, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1273, 1.0, 0.0, 100.0, "units"),
-radiatorFanStatus("radiatorFanStatus", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1272, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1273, 1.0, 0.0, 100.0, "units"),
-injectionMass1("injectionMass 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1292, 1.0, -1.0, -1.0, ""),
-injectionMass2("injectionMass 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1296, 1.0, -1.0, -1.0, ""),
-injectionMass3("injectionMass 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1300, 1.0, -1.0, -1.0, ""),
-injectionMass4("injectionMass 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1304, 1.0, -1.0, -1.0, ""),
-injectionMass5("injectionMass 5", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1308, 1.0, -1.0, -1.0, ""),
-injectionMass6("injectionMass 6", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1312, 1.0, -1.0, -1.0, ""),
-injectionMass7("injectionMass 7", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1316, 1.0, -1.0, -1.0, ""),
-injectionMass8("injectionMass 8", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1320, 1.0, -1.0, -1.0, ""),
-injectionMass9("injectionMass 9", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1324, 1.0, -1.0, -1.0, ""),
-injectionMass10("injectionMass 10", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1328, 1.0, -1.0, -1.0, ""),
-injectionMass11("injectionMass 11", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1332, 1.0, -1.0, -1.0, ""),
-injectionMass12("injectionMass 12", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1336, 1.0, -1.0, -1.0, ""),
-lua("lua", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1340, 1.0, -1.0, -1.0, ""),
-sd("sd", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1356, 1.0, -1.0, -1.0, ""),
-crankingFuel("crankingFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1364, 1.0, -1.0, -1.0, ""),
-baroCorrection("Fuel: Barometric pressure mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1376, 1.0, -1.0, -1.0, ""),
-hellenBoardId("Detected Board ID", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1380, 1.0, 0.0, 3000.0, "id"),
-clutchUpState("Clutch: up", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1382, 1.0, -1.0, -1.0, ""),
-brakePedalState("Brake switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1383, 1.0, -1.0, -1.0, ""),
-startStopState("startStopState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1384, 1.0, -1.0, -1.0, ""),
-smartChipState("smartChipState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1385, 1.0, -1.0, -1.0, ""),
-smartChipRestartCounter("smartChipRestartCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1386, 1.0, -1.0, -1.0, ""),
-smartChipAliveCounter("smartChipAliveCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1387, 1.0, -1.0, -1.0, ""),
-startStopStateToggleCounter("startStopStateToggleCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1392, 1.0, -1.0, -1.0, ""),
-currentVe("currentVe", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1396, 1.0, -1.0, -1.0, ""),
-luaSoftSparkSkip("luaSoftSparkSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1400, 1.0, -1.0, -1.0, ""),
-luaHardSparkSkip("luaHardSparkSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1404, 1.0, -1.0, -1.0, ""),
-tractionControlSparkSkip("tractionControlSparkSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1408, 1.0, -1.0, -1.0, ""),
-fuelInjectionCounter("Fuel: Injection counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1412, 1.0, -1.0, -1.0, ""),
-globalSparkCounter("Ign: Spark counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1416, 1.0, -1.0, -1.0, ""),
-fuelingLoad("Fuel: Load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1420, 1.0, -1.0, -1.0, ""),
-ignitionLoad("Ignition: load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1424, 1.0, -1.0, -1.0, ""),
-veTableYAxis("veTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1428, 0.01, 0.0, 0.0, "%"),
-veTableIdleYAxis("veTableIdleYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1430, 0.1, -1000.0, 1000.0, ""),
-overDwellCanceledCounter("Ignition: overcharge canceled", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1432, 1.0, 0.0, 255.0, ""),
-overDwellNotScheduledCounter("Ignition: overDwellNotScheduled", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1433, 1.0, 0.0, 255.0, ""),
-sparkOutOfOrderCounter("Ignition: sparkOutOfOrder", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1434, 1.0, 0.0, 255.0, ""),
-dwellUnderChargeCounter("Ignition: undecharge warnings", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1435, 1.0, 0.0, 255.0, ""),
-dwellOverChargeCounter("Ignition: overcharge warnings", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1436, 1.0, 0.0, 255.0, ""),
-alignmentFill_at_145("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1437, 1.0, 0.0, 100.0, "units"),
-dwellActualRatio("Ignition: Dwell deviation", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1440, 1.0, 80.0, 120.0, "%"),
-stftCorrection1("STFT: Bank 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1444, 1.0, 50.0, 150.0, "%"),
-stftCorrection2("STFT: Bank 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1448, 1.0, 50.0, 150.0, "%"),
-tpsFrom("Fuel: TPS AE from", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1452, 1.0, -1.0, -1.0, ""),
-tpsTo("Fuel: TPS AE to", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1456, 1.0, -1.0, -1.0, ""),
-deltaTps("Fuel: TPS AE change", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1460, 1.0, -1.0, -1.0, ""),
-extraFuel("Fuel: TPS extraFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1464, 1.0, -1.0, -1.0, ""),
-valueFromTable("Fuel: TPS valueFromTable", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1468, 1.0, -1.0, -1.0, ""),
-fractionalInjFuel("Fuel: TPS AE fractionalInjFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1476, 1.0, -1.0, -1.0, ""),
-accumulatedValue("accumulatedValue", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1480, 1.0, -1.0, -1.0, ""),
-maxExtraPerCycle("maxExtraPerCycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1484, 1.0, -1.0, -1.0, ""),
-maxExtraPerPeriod("maxExtraPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1488, 1.0, -1.0, -1.0, ""),
-maxInjectedPerPeriod("maxInjectedPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1492, 1.0, -1.0, -1.0, ""),
-cycleCnt("cycleCnt", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1496, 1.0, -1.0, -1.0, ""),
-hwEventCounters1("Hardware events since boot 1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1500, 1.0, -1.0, -1.0, ""),
-hwEventCounters2("Hardware events since boot 2", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1502, 1.0, -1.0, -1.0, ""),
-hwEventCounters3("Hardware events since boot 3", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1504, 1.0, -1.0, -1.0, ""),
-hwEventCounters4("Hardware events since boot 4", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1506, 1.0, -1.0, -1.0, ""),
-vvtEventRiseCounter1("vvtEventRiseCounter 1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1508, 1.0, -1.0, -1.0, ""),
-vvtEventRiseCounter2("vvtEventRiseCounter 2", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1510, 1.0, -1.0, -1.0, ""),
-vvtEventRiseCounter3("vvtEventRiseCounter 3", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1512, 1.0, -1.0, -1.0, ""),
-vvtEventRiseCounter4("vvtEventRiseCounter 4", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1514, 1.0, -1.0, -1.0, ""),
-vvtEventFallCounter1("vvtEventFallCounter 1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1516, 1.0, -1.0, -1.0, ""),
-vvtEventFallCounter2("vvtEventFallCounter 2", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1518, 1.0, -1.0, -1.0, ""),
-vvtEventFallCounter3("vvtEventFallCounter 3", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1520, 1.0, -1.0, -1.0, ""),
-vvtEventFallCounter4("vvtEventFallCounter 4", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1522, 1.0, -1.0, -1.0, ""),
-vvtCamCounter("Sync: total cams front counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1524, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_26("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1526, 1.0, 0.0, 100.0, "units"),
-mapVvt_MAP_AT_SPECIAL_POINT("InstantMAP at readout angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1528, 1.0, -300.0, 300.0, "kPa"),
-mapVvt_MAP_AT_DIFF("InstantMAP delta @ readout angles", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1532, 1.0, -300.0, 300.0, "kPa"),
-mapVvt_MAP_AT_CYCLE_COUNT("mapVvt_MAP_AT_CYCLE_COUNT", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1536, 1.0, -10.0, 100.0, "distance"),
-mapVvt_sync_counter("Instant MAP sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1537, 1.0, 0.0, 100.0, "counter"),
-mapVvt_min_point_counter("mapVvt_min_point_counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1538, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_39("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1539, 1.0, 0.0, 100.0, "units"),
-temp_mapVvt_index("temp_mapVvt_index", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1540, 1.0, -1.0, -1.0, ""),
-mapVvt_CycleDelta("mapVvt_CycleDelta", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1544, 1.0, -1.0, -1.0, ""),
-currentEngineDecodedPhase("Sync: TDC Engine Phase", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1548, 1.0, 0.0, 0.0, "deg"),
-triggerToothAngleError("Sync: trigger angle error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1552, 1.0, -30.0, 30.0, "deg"),
-triggerIgnoredToothCount("triggerIgnoredToothCount", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1556, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_57("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1557, 1.0, 0.0, 100.0, "units"),
-mapCamPrevToothAngle("Sync: MAP: prev angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1560, 1.0, -3000.0, 3000.0, "deg"),
-triggerElapsedUs("triggerElapsedUs", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1568, 1.0, -1.0, -1.0, ""),
-synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1572, 1.0, -1.0, -1.0, ""),
-vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1576, 1.0, 0.0, 100000.0, "us"),
-vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1580, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1584, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1588, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1592, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1596, 1.0, -10000.0, 10000.0, ""),
-triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1600, 1.0, -10000.0, 10000.0, ""),
-triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1604, 1.0, -1.0, -1.0, ""),
-triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1605, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1606, 1.0, 0.0, 100.0, "units"),
-synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1572, 1.0, -1.0, -1.0, ""),
-vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1576, 1.0, 0.0, 100000.0, "us"),
-vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1580, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1584, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1588, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1592, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1596, 1.0, -10000.0, 10000.0, ""),
-triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1600, 1.0, -10000.0, 10000.0, ""),
-triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1604, 1.0, -1.0, -1.0, ""),
-triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1605, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1606, 1.0, 0.0, 100.0, "units"),
-synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1572, 1.0, -1.0, -1.0, ""),
-vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1576, 1.0, 0.0, 100000.0, "us"),
-vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1580, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1584, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1588, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1592, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1596, 1.0, -10000.0, 10000.0, ""),
-triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1600, 1.0, -10000.0, 10000.0, ""),
-triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1604, 1.0, -1.0, -1.0, ""),
-triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1605, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1606, 1.0, 0.0, 100.0, "units"),
-synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1572, 1.0, -1.0, -1.0, ""),
-vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1576, 1.0, 0.0, 100000.0, "us"),
-vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1580, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1584, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1588, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1592, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1596, 1.0, -10000.0, 10000.0, ""),
-triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1600, 1.0, -10000.0, 10000.0, ""),
-triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1604, 1.0, -1.0, -1.0, ""),
-triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1605, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1606, 1.0, 0.0, 100.0, "units"),
-synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1572, 1.0, -1.0, -1.0, ""),
-vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1576, 1.0, 0.0, 100000.0, "us"),
-vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1580, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1584, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1588, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1592, 1.0, -10000.0, 10000.0, ""),
-vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1596, 1.0, -10000.0, 10000.0, ""),
-triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1600, 1.0, -10000.0, 10000.0, ""),
-triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1604, 1.0, -1.0, -1.0, ""),
-triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1605, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1606, 1.0, 0.0, 100.0, "units"),
-camResyncCounter("sync: Phase Re-Sync Counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1752, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1753, 1.0, 0.0, 100.0, "units"),
-wallFuelCorrection("fuel wallwetting injection time\n correction to account for wall wetting effect for current cycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1760, 1.0, -1.0, -1.0, ""),
-wallFuel("Fuel on the wall\nin ms of injector open time for each injector.", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1764, 1.0, -1.0, -1.0, ""),
-emaError("emaError", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1772, 1.0, -1.0, -1.0, ""),
-liveDataExampleField("liveDataExampleField", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1776, 1.0, -1.0, -1.0, ""),
-idleState("idleState", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1780, 1.0, -1.0, -1.0, ""),
-baseIdlePosition("idle: base value\ncurrent position without adjustments (iacByTpsTaper, afterCrankingIACtaperDuration)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1784, 1.0, -1.0, -1.0, ""),
-iacByTpsTaper("idle: iacByTpsTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1788, 1.0, -1.0, -1.0, ""),
-idleTarget("Idle: Target RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1796, 1.0, -1.0, -1.0, ""),
-idleEntryRpm("Idle: Entry threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1798, 1.0, -1.0, -1.0, ""),
-idleExitRpm("Idle: Exit threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1800, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_22("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1802, 1.0, 0.0, 100.0, "units"),
-targetRpmByClt("Idle: Target RPM base", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1804, 1.0, -1.0, -1.0, ""),
-targetRpmAc("Idle: Target A/C RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1808, 1.0, -1.0, -1.0, ""),
-iacByRpmTaper("idle: iacByRpmTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1812, 1.0, -1.0, -1.0, ""),
-luaAdd("idle: Lua Adder", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1816, 1.0, -1.0, -1.0, ""),
-m_lastTargetRpm("m_lastTargetRpm", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1820, 1.0, -1.0, -1.0, ""),
-idleClosedLoop("Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1824, 1.0, -1.0, -1.0, ""),
-currentIdlePosition("Idle: Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1828, 1.0, 0.0, 0.0, "%"),
-idleTargetAirmass("Target airmass", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1832, 1.0, 0.0, 0.0, "mg"),
-idleTargetFlow("Target airflow", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1834, 0.01, 0.0, 0.0, "kg/h"),
-etbCurrentTarget("ETB: target for current pedal", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1836, 1.0, 0.0, 100.0, "%"),
-boardEtbAdjustment("ETB: board adjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1840, 1.0, -100.0, 100.0, "%"),
-targetWithIdlePosition("ETB: target with idle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1844, 1.0, 0.0, 100.0, "%"),
-luaAdjustment("ETB: luaAdjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1848, 1.0, -100.0, 100.0, "%"),
-trim("ETB: trim", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1852, 1.0, -100.0, 100.0, "%"),
-adjustedEtbTarget("ETB: target with adjustments", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1856, 0.01, 0.0, 100.0, "%"),
-m_adjustedTarget("ETB: final target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1858, 0.01, 0.0, 100.0, "%"),
-m_wastegatePosition("DC: wastegatePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1860, 1.0, 0.0, 3.0, "%"),
-m_lastPidDtMs("EBT: last PID dT", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1864, 1.0, 0.0, 4.0, "mS"),
-etbFeedForward("etbFeedForward", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1868, 1.0, -1.0, -1.0, ""),
-integralError("Integral error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1872, 1.0, 0.0, 100.0, ""),
-etbTpsErrorCounter("ETB TPS error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1880, 1.0, 0.0, 3.0, "count"),
-etbPpsErrorCounter("ETB pedal error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1882, 1.0, 0.0, 3.0, "count"),
-etbErrorCode("etbErrorCode", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1884, 1.0, -1.0, -1.0, ""),
-etbErrorCodeBlinker("etbErrorCodeBlinker", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1885, 1.0, -1.0, -1.0, ""),
-tcEtbDrop("ETB traction control", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1886, 1.0, 0.0, 100.0, "%"),
-alignmentFill_at_51("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1887, 1.0, 0.0, 100.0, "units"),
-jamTimer("ETB jam timer", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1888, 0.01, 0.0, 100.0, "sec"),
-state("state", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1890, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_55("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1891, 1.0, 0.0, 100.0, "units"),
-etbCurrentTarget("ETB: target for current pedal", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1836, 1.0, 0.0, 100.0, "%"),
-boardEtbAdjustment("ETB: board adjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1840, 1.0, -100.0, 100.0, "%"),
-targetWithIdlePosition("ETB: target with idle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1844, 1.0, 0.0, 100.0, "%"),
-luaAdjustment("ETB: luaAdjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1848, 1.0, -100.0, 100.0, "%"),
-trim("ETB: trim", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1852, 1.0, -100.0, 100.0, "%"),
-adjustedEtbTarget("ETB: target with adjustments", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1856, 0.01, 0.0, 100.0, "%"),
-m_adjustedTarget("ETB: final target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1858, 0.01, 0.0, 100.0, "%"),
-m_wastegatePosition("DC: wastegatePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1860, 1.0, 0.0, 3.0, "%"),
-m_lastPidDtMs("EBT: last PID dT", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1864, 1.0, 0.0, 4.0, "mS"),
-etbFeedForward("etbFeedForward", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1868, 1.0, -1.0, -1.0, ""),
-integralError("Integral error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1872, 1.0, 0.0, 100.0, ""),
-etbTpsErrorCounter("ETB TPS error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1880, 1.0, 0.0, 3.0, "count"),
-etbPpsErrorCounter("ETB pedal error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1882, 1.0, 0.0, 3.0, "count"),
-etbErrorCode("etbErrorCode", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1884, 1.0, -1.0, -1.0, ""),
-etbErrorCodeBlinker("etbErrorCodeBlinker", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1885, 1.0, -1.0, -1.0, ""),
-tcEtbDrop("ETB traction control", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1886, 1.0, 0.0, 100.0, "%"),
-alignmentFill_at_51("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1887, 1.0, 0.0, 100.0, "units"),
-jamTimer("ETB jam timer", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1888, 0.01, 0.0, 100.0, "sec"),
-state("state", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1890, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_55("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1891, 1.0, 0.0, 100.0, "units"),
-stateCode("WBO: State code", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1948, 1.0, -1.0, -1.0, ""),
-heaterDuty("WBO: Heater duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1949, 1.0, 0.0, 100.0, "%"),
-pumpDuty("WBO: Pump duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1950, 1.0, 0.0, 100.0, "%"),
-alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1951, 1.0, 0.0, 100.0, "units"),
-tempC("WBO: Temperature", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1956, 1.0, 500.0, 1000.0, "C"),
-nernstVoltage("WBO: Nernst Voltage", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1958, 0.001, 0.0, 1.0, "V"),
-esr("WBO: ESR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1960, 1.0, 0.0, 10000.0, "ohm"),
-alignmentFill_at_14("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1962, 1.0, 0.0, 100.0, "units"),
-stateCode("WBO: State code", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1948, 1.0, -1.0, -1.0, ""),
-heaterDuty("WBO: Heater duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1949, 1.0, 0.0, 100.0, "%"),
-pumpDuty("WBO: Pump duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1950, 1.0, 0.0, 100.0, "%"),
-alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1951, 1.0, 0.0, 100.0, "units"),
-tempC("WBO: Temperature", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1956, 1.0, 500.0, 1000.0, "C"),
-nernstVoltage("WBO: Nernst Voltage", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1958, 0.001, 0.0, 1.0, "V"),
-esr("WBO: ESR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1960, 1.0, 0.0, 10000.0, "ohm"),
-alignmentFill_at_14("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1962, 1.0, 0.0, 100.0, "units"),
-dcOutput0("DC: output0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1980, 1.0, -1.0, 1.0, "%"),
-isEnabled0_int("DC: en0", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1984, 1.0, 0.0, 10.0, "%"),
-alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1985, 1.0, 0.0, 100.0, "units"),
-value0("SENT ch0 value0", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1992, 1.0, 0.0, 4095.0, "RAW"),
-value1("SENT ch0 value1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1994, 1.0, 0.0, 4095.0, "RAW"),
-errorRate("SENT ch0 error rate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1996, 1.0, 0.0, 100.0, "% (don't belive me)"),
-vvtTarget("vvtTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2000, 0.1, -90.0, 90.0, "deg"),
-vvtOutput("vvtOutput", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2002, 0.5, 100.0, 1.0, "%"),
+smartGpioSpiLatencyAvg("Smart GPIO: SPI latency avg", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 884, 1.0, 0.0, 65535.0, "us"),
+smartGpioSpiLatencyMax("Smart GPIO: SPI latency max", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 886, 1.0, 0.0, 65535.0, "us"),
+edgeLatencyInjectorMax("Timing: injector edge late max", SensorCategory.SENSOR_INPUTS, FieldType.INT, 888, 1.0, 0.0, 1000.0, "us"),
+edgeLatencyInjectorMean("Timing: injector edge late mean", SensorCategory.SENSOR_INPUTS, FieldType.INT, 892, 1.0, 0.0, 1000.0, "us"),
+edgeLatencyCoilMax("Timing: coil edge late max", SensorCategory.SENSOR_INPUTS, FieldType.INT, 896, 1.0, 0.0, 1000.0, "us"),
+edgeLatencyCoilMean("Timing: coil edge late mean", SensorCategory.SENSOR_INPUTS, FieldType.INT, 900, 1.0, 0.0, 1000.0, "us"),
+edgeLatencyQueueMax("Timing: scheduler late max", SensorCategory.SENSOR_INPUTS, FieldType.INT, 904, 1.0, 0.0, 1000.0, "us"),
+edgeLatencyQueueMean("Timing: scheduler late mean", SensorCategory.SENSOR_INPUTS, FieldType.INT, 908, 1.0, 0.0, 1000.0, "us"),
+engineModulesFastUs("Timing: modules fast callback", SensorCategory.SENSOR_INPUTS, FieldType.INT, 912, 1.0, 0.0, 1000.0, "us"),
+engineModulesHeaviestFastUs("Timing: heaviest module fast callback", SensorCategory.SENSOR_INPUTS, FieldType.INT, 916, 1.0, 0.0, 1000.0, "us"),
+engineModulesHeaviestFastMaxUs("Timing: heaviest module fast callback max", SensorCategory.SENSOR_INPUTS, FieldType.INT, 920, 1.0, 0.0, 1000.0, "us"),
+engineModulesHeaviestFastIndex("Timing: heaviest module index", SensorCategory.SENSOR_INPUTS, FieldType.INT, 924, 1.0, 0.0, 100.0, ""),
+engineModulesSlowUs("Timing: modules slow callback", SensorCategory.SENSOR_INPUTS, FieldType.INT, 928, 1.0, 0.0, 10000.0, "us"),
+engineModulesPhaseUs("Timing: modules engine phase", SensorCategory.SENSOR_INPUTS, FieldType.INT, 932, 1.0, 0.0, 1000.0, "us"),
+totalFuelCorrection("Fuel: Total correction", SensorCategory.SENSOR_INPUTS, FieldType.INT, 936, 1.0, 0.0, 3.0, "mult"),
+running("running", SensorCategory.SENSOR_INPUTS, FieldType.INT, 940, 1.0, -1.0, -1.0, ""),
+afrTableYAxis("afrTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 960, 0.01, 0.0, 0.0, "%"),
+targetLambda("Fuel: target lambda", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 962, 1.0E-4, 0.5, 1.5, ""),
+targetAFR("Fuel: target AFR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 964, 0.001, 10.0, 20.0, "ratio"),
+stoichiometricRatio("Fuel: Stoich ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 966, 0.001, 0.0, 0.0, "ratio"),
+sdTcharge_coff("sdTcharge_coff", SensorCategory.SENSOR_INPUTS, FieldType.INT, 968, 1.0, -1.0, -1.0, ""),
+sdAirMassInOneCylinder("Air: Cylinder airmass", SensorCategory.SENSOR_INPUTS, FieldType.INT, 972, 1.0, 0.0, 0.0, "g"),
+normalizedCylinderFilling("Air: Normalized cyl filling", SensorCategory.SENSOR_INPUTS, FieldType.INT, 976, 1.0, 0.0, 100.0, "%"),
+brokenInjector("brokenInjector", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 980, 1.0, -1.0, -1.0, ""),
+unused88("unused88", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 981, 1.0, -1.0, -1.0, ""),
+idealEngineTorque("idealEngineTorque", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 982, 1.0, -1.0, -1.0, ""),
+baseDwell("Ignition: base dwell", SensorCategory.SENSOR_INPUTS, FieldType.INT, 988, 1.0, 0.0, 30.0, "ms"),
+sparkDwell("Ignition: coil charge time", SensorCategory.SENSOR_INPUTS, FieldType.INT, 992, 1.0, 0.0, 30.0, "ms"),
+dwellDurationAngle("Ignition: dwell duration\nas crankshaft angle\nNAN if engine is stopped\nSee also sparkDwell", SensorCategory.SENSOR_INPUTS, FieldType.INT, 996, 1.0, 0.0, 120.0, "deg"),
+cltTimingCorrection("Ign: CLT correction", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1000, 0.01, -20.0, 20.0, "deg"),
+timingIatCorrection("Ign: IAT correction", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1002, 0.01, -20.0, 20.0, "deg"),
+timingPidCorrection("Idle: Timing adjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1004, 0.01, -20.0, 20.0, "deg"),
+dfcoTimingRetard("DFCO: Timing retard", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1006, 0.01, 0.0, 50.0, "deg"),
+baseIgnitionAdvance("Timing: base ignition", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1008, 0.02, 0.0, 0.0, "deg"),
+correctedIgnitionAdvance("Timing: ignition", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1010, 0.02, 0.0, 0.0, "deg"),
+tractionAdvanceDrop("Traction: timing correction", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1012, 0.02, 0.0, 0.0, "deg"),
+alignmentFill_at_26("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1014, 1.0, 0.0, 100.0, "units"),
+dwellVoltageCorrection("Ign: Dwell voltage correction", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1016, 1.0, -1.0, -1.0, ""),
+luaTimingAdd("Ign: Lua timing add", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1020, 1.0, -20.0, 20.0, "deg"),
+luaTimingMult("Ign: Lua timing mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1024, 1.0, -20.0, 20.0, "deg"),
+trailingSparkAngle("Ign: Trailing spark deg", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1032, 0.01, -20.0, 20.0, "deg"),
+rpmForIgnitionTableDot("rpmForIgnitionTableDot", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1034, 1.0, -1.0, -1.0, ""),
+rpmForIgnitionIdleTableDot("rpmForIgnitionIdleTableDot", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1036, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_50("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1038, 1.0, 0.0, 100.0, "units"),
+loadForIgnitionTableDot("loadForIgnitionTableDot", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1040, 1.0, -1.0, -1.0, ""),
+m_knockLevel("Knock: Current level", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1044, 1.0, 0.0, 0.0, "Volts"),
+m_knockCyl1("Knock: Cyl 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1048, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl2("Knock: Cyl 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1049, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl3("Knock: Cyl 3", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1050, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl4("Knock: Cyl 4", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1051, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl5("Knock: Cyl 5", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1052, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl6("Knock: Cyl 6", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1053, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl7("Knock: Cyl 7", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1054, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl8("Knock: Cyl 8", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1055, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl9("Knock: Cyl 9", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1056, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl10("Knock: Cyl 10", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1057, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl11("Knock: Cyl 11", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1058, 1.0, 0.0, 0.0, "dBv"),
+m_knockCyl12("Knock: Cyl 12", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1059, 1.0, 0.0, 0.0, "dBv"),
+m_knockRetard("Knock: Retard", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1060, 1.0, 0.0, 0.0, "deg"),
+m_knockThreshold("Knock: Threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1064, 1.0, -1.0, -1.0, ""),
+m_knockCount("Knock: Count", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1068, 1.0, 0.0, 0.0, ""),
+m_maximumRetard("Knock: Max retard", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1072, 1.0, -1.0, -1.0, ""),
+m_knockSpectrum1("Knock: SpectrumData 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1076, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum2("Knock: SpectrumData 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1080, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum3("Knock: SpectrumData 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1084, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum4("Knock: SpectrumData 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1088, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum5("Knock: SpectrumData 5", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1092, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum6("Knock: SpectrumData 6", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1096, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum7("Knock: SpectrumData 7", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1100, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum8("Knock: SpectrumData 8", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1104, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum9("Knock: SpectrumData 9", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1108, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum10("Knock: SpectrumData 10", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1112, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum11("Knock: SpectrumData 11", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1116, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum12("Knock: SpectrumData 12", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1120, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum13("Knock: SpectrumData 13", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1124, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum14("Knock: SpectrumData 14", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1128, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum15("Knock: SpectrumData 15", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1132, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrum16("Knock: SpectrumData 16", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1136, 1.0, 0.0, 0.0, "compressed data"),
+m_knockSpectrumChannelCyl("Knock: ChannelAndCylNumber", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1140, 1.0, 0.0, 0.0, "compressed N + N"),
+m_knockFrequencyStart("Knock: Start Freq", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1142, 1.0, 0.0, 0.0, "Hz"),
+m_knockFrequencyStep("Knock: Step Freq", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1144, 1.0, 0.0, 0.0, "Hz"),
+m_knockFuelTrimMultiplier("Knock: Fuel trim when knock", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1148, 1.0, 0.0, 0.0, "multiplier"),
+tcuCurrentGear("TCU: Current Gear", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1156, 1.0, -1.0, 10.0, "gear"),
+alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1157, 1.0, 0.0, 100.0, "units"),
+tcRatio("TCU: Torque Converter Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1158, 0.01, 0.0, 0.0, "value"),
+lastShiftTime("lastShiftTime", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1160, 1.0, -1.0, -1.0, ""),
+tcu_currentRange("TCU: Current Range", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1164, 1.0, 0.0, 0.0, ""),
+pressureControlDuty("TCU: EPC Duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1165, 1.0, 0.0, 100.0, "%"),
+torqueConverterDuty("TCU: TC Duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1166, 1.0, 0.0, 100.0, "%"),
+alignmentFill_at_11("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1167, 1.0, 0.0, 100.0, "units"),
+throttleModelCrossoverAngle("Air: Throttle crossover pos", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1176, 0.01, 0.0, 100.0, "%"),
+alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1178, 1.0, 0.0, 100.0, "units"),
+throttleEstimatedFlow("Air: Throttle flow estimate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1180, 1.0, 0.0, 5.0, "g/s"),
+m_requested_pump("GDI: HPFP duration\nComputed requested pump duration in degrees (not including deadtime)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1184, 1.0, -1.0, -1.0, ""),
+fuel_requested_percent("GDI: HPFP requested duty", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1188, 1.0, 0.0, 100.0, "%"),
+fuel_requested_percent_pi("GDI: percent_pi", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1192, 1.0, -1.0, -1.0, ""),
+m_pressureTarget_kPa("GDI: target pressure", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1200, 1.0, -1.0, -1.0, ""),
+hpfp_p_control_percent("hpfp_p_control_percent", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1204, 1.0, -1.0, -1.0, ""),
+hpfp_i_control_percent("hpfp_i_control_percent", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1208, 1.0, -1.0, -1.0, ""),
+nextLobe("GDI: next lobe N", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1212, 1.0, -1.0, -1.0, ""),
+di_nextStart("GDI: valve activation angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1216, 1.0, 0.0, 100.0, "v"),
+HpfdActivationPhase("GDI: HPFP activation angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1220, 1.0, -1.0, -1.0, ""),
+HpfdDeactivationPhase("GDI: HPFP deactivation angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1224, 1.0, -1.0, -1.0, ""),
+m_deadtime("Fuel: injector lag", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1228, 1.0, 0.0, 0.0, "ms"),
+pressureDelta("Fuel: Injector pressure delta", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1232, 1.0, -1000.0, 1000.0, "kPa"),
+pressureRatio("Fuel: Injector pressure ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1236, 1.0, 0.0, 100.0, ""),
+pressureCorrectionReference("Fuel: corr reference pressure", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1240, 1.0, 0.0, 1000.0, "kPa"),
+retardThresholdRpm("Launch: Retard threshold RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1244, 1.0, -1.0, -1.0, ""),
+trqRedCutXaxisValue("trqRedCutXaxisValue", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1256, 1.0, -1.0, -1.0, ""),
+trqRedTimeXaxisValue("trqRedTimeXaxisValue", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1258, 1.0, -1.0, -1.0, ""),
+trqRedIgnRetXaxisValue("trqRedIgnRetXaxisValue", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1260, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_10("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1262, 1.0, 0.0, 100.0, "units"),
+fuelALSCorrection("fuelALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1268, 1.0, -1.0, -1.0, ""),
+timingALSCorrection("timingALSCorrection", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1272, 0.01, -20.0, 20.0, "deg"),
+timingALSSkip("timingALSSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1274, 0.01, 0.0, 50.0, "deg"),
+luaTargetAdd("Boost: Lua target add", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1280, 0.5, -100.0, 100.0, "percent"),
+alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1282, 1.0, 0.0, 100.0, "units"),
+luaTargetMult("Boost: Lua target mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1284, 1.0, -100.0, 100.0, ""),
+boostControlTarget("Boost: Target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1288, 0.03333333333333333, 0.0, 300.0, "kPa"),
+alignmentFill_at_14("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1290, 1.0, 0.0, 100.0, "units"),
+openLoopPart("Boost: Open loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1292, 1.0, -100.0, 100.0, "percent"),
+openLoopYAxis("openLoopYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1296, 0.1, -1000.0, 1000.0, ""),
+alignmentFill_at_22("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1298, 1.0, 0.0, 100.0, "units"),
+luaOpenLoopAdd("Boost: Lua open loop add", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1300, 1.0, -100.0, 100.0, "percent"),
+boostControllerClosedLoopPart("Boost: Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1304, 0.5, -50.0, 50.0, "%"),
+alignmentFill_at_29("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1305, 1.0, 0.0, 100.0, "units"),
+boostOutput("Boost: Output", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1306, 0.01, -100.0, 100.0, "percent"),
+acButtonState("AC switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1308, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1309, 1.0, 0.0, 100.0, "units"),
+radiatorFanStatus("radiatorFanStatus", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1324, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1325, 1.0, 0.0, 100.0, "units"),
+radiatorFanStatus("radiatorFanStatus", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1324, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1325, 1.0, 0.0, 100.0, "units"),
+injectionMass1("injectionMass 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1344, 1.0, -1.0, -1.0, ""),
+injectionMass2("injectionMass 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1348, 1.0, -1.0, -1.0, ""),
+injectionMass3("injectionMass 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1352, 1.0, -1.0, -1.0, ""),
+injectionMass4("injectionMass 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1356, 1.0, -1.0, -1.0, ""),
+injectionMass5("injectionMass 5", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1360, 1.0, -1.0, -1.0, ""),
+injectionMass6("injectionMass 6", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1364, 1.0, -1.0, -1.0, ""),
+injectionMass7("injectionMass 7", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1368, 1.0, -1.0, -1.0, ""),
+injectionMass8("injectionMass 8", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1372, 1.0, -1.0, -1.0, ""),
+injectionMass9("injectionMass 9", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1376, 1.0, -1.0, -1.0, ""),
+injectionMass10("injectionMass 10", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1380, 1.0, -1.0, -1.0, ""),
+injectionMass11("injectionMass 11", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1384, 1.0, -1.0, -1.0, ""),
+injectionMass12("injectionMass 12", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1388, 1.0, -1.0, -1.0, ""),
+lua("lua", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1392, 1.0, -1.0, -1.0, ""),
+sd("sd", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1408, 1.0, -1.0, -1.0, ""),
+crankingFuel("crankingFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1416, 1.0, -1.0, -1.0, ""),
+baroCorrection("Fuel: Barometric pressure mult", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1428, 1.0, -1.0, -1.0, ""),
+hellenBoardId("Detected Board ID", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1432, 1.0, 0.0, 3000.0, "id"),
+clutchUpState("Clutch: up", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1434, 1.0, -1.0, -1.0, ""),
+brakePedalState("Brake switch", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1435, 1.0, -1.0, -1.0, ""),
+startStopState("startStopState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1436, 1.0, -1.0, -1.0, ""),
+smartChipState("smartChipState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1437, 1.0, -1.0, -1.0, ""),
+smartChipRestartCounter("smartChipRestartCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1438, 1.0, -1.0, -1.0, ""),
+smartChipAliveCounter("smartChipAliveCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1439, 1.0, -1.0, -1.0, ""),
+startStopStateToggleCounter("startStopStateToggleCounter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1444, 1.0, -1.0, -1.0, ""),
+currentVe("currentVe", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1448, 1.0, -1.0, -1.0, ""),
+luaSoftSparkSkip("luaSoftSparkSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1452, 1.0, -1.0, -1.0, ""),
+luaHardSparkSkip("luaHardSparkSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1456, 1.0, -1.0, -1.0, ""),
+tractionControlSparkSkip("tractionControlSparkSkip", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1460, 1.0, -1.0, -1.0, ""),
+fuelInjectionCounter("Fuel: Injection counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1464, 1.0, -1.0, -1.0, ""),
+globalSparkCounter("Ign: Spark counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1468, 1.0, -1.0, -1.0, ""),
+fuelingLoad("Fuel: Load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1472, 1.0, -1.0, -1.0, ""),
+ignitionLoad("Ignition: load", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1476, 1.0, -1.0, -1.0, ""),
+veTableYAxis("veTableYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1480, 0.01, 0.0, 0.0, "%"),
+veTableIdleYAxis("veTableIdleYAxis", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1482, 0.1, -1000.0, 1000.0, ""),
+overDwellCanceledCounter("Ignition: overcharge canceled", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1484, 1.0, 0.0, 255.0, ""),
+overDwellNotScheduledCounter("Ignition: overDwellNotScheduled", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1485, 1.0, 0.0, 255.0, ""),
+sparkOutOfOrderCounter("Ignition: sparkOutOfOrder", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1486, 1.0, 0.0, 255.0, ""),
+dwellUnderChargeCounter("Ignition: undecharge warnings", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1487, 1.0, 0.0, 255.0, ""),
+dwellOverChargeCounter("Ignition: overcharge warnings", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1488, 1.0, 0.0, 255.0, ""),
+alignmentFill_at_145("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1489, 1.0, 0.0, 100.0, "units"),
+dwellActualRatio("Ignition: Dwell deviation", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1492, 1.0, 80.0, 120.0, "%"),
+stftCorrection1("STFT: Bank 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1496, 1.0, 50.0, 150.0, "%"),
+stftCorrection2("STFT: Bank 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1500, 1.0, 50.0, 150.0, "%"),
+tpsFrom("Fuel: TPS AE from", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1504, 1.0, -1.0, -1.0, ""),
+tpsTo("Fuel: TPS AE to", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1508, 1.0, -1.0, -1.0, ""),
+deltaTps("Fuel: TPS AE change", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1512, 1.0, -1.0, -1.0, ""),
+extraFuel("Fuel: TPS extraFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1516, 1.0, -1.0, -1.0, ""),
+valueFromTable("Fuel: TPS valueFromTable", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1520, 1.0, -1.0, -1.0, ""),
+fractionalInjFuel("Fuel: TPS AE fractionalInjFuel", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1528, 1.0, -1.0, -1.0, ""),
+accumulatedValue("accumulatedValue", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1532, 1.0, -1.0, -1.0, ""),
+maxExtraPerCycle("maxExtraPerCycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1536, 1.0, -1.0, -1.0, ""),
+maxExtraPerPeriod("maxExtraPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1540, 1.0, -1.0, -1.0, ""),
+maxInjectedPerPeriod("maxInjectedPerPeriod", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1544, 1.0, -1.0, -1.0, ""),
+cycleCnt("cycleCnt", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1548, 1.0, -1.0, -1.0, ""),
+hwEventCounters1("Hardware events since boot 1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1552, 1.0, -1.0, -1.0, ""),
+hwEventCounters2("Hardware events since boot 2", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1554, 1.0, -1.0, -1.0, ""),
+hwEventCounters3("Hardware events since boot 3", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1556, 1.0, -1.0, -1.0, ""),
+hwEventCounters4("Hardware events since boot 4", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1558, 1.0, -1.0, -1.0, ""),
+vvtEventRiseCounter1("vvtEventRiseCounter 1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1560, 1.0, -1.0, -1.0, ""),
+vvtEventRiseCounter2("vvtEventRiseCounter 2", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1562, 1.0, -1.0, -1.0, ""),
+vvtEventRiseCounter3("vvtEventRiseCounter 3", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1564, 1.0, -1.0, -1.0, ""),
+vvtEventRiseCounter4("vvtEventRiseCounter 4", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1566, 1.0, -1.0, -1.0, ""),
+vvtEventFallCounter1("vvtEventFallCounter 1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1568, 1.0, -1.0, -1.0, ""),
+vvtEventFallCounter2("vvtEventFallCounter 2", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1570, 1.0, -1.0, -1.0, ""),
+vvtEventFallCounter3("vvtEventFallCounter 3", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1572, 1.0, -1.0, -1.0, ""),
+vvtEventFallCounter4("vvtEventFallCounter 4", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1574, 1.0, -1.0, -1.0, ""),
+vvtCamCounter("Sync: total cams front counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1576, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_26("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1578, 1.0, 0.0, 100.0, "units"),
+mapVvt_MAP_AT_SPECIAL_POINT("InstantMAP at readout angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1580, 1.0, -300.0, 300.0, "kPa"),
+mapVvt_MAP_AT_DIFF("InstantMAP delta @ readout angles", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1584, 1.0, -300.0, 300.0, "kPa"),
+mapVvt_MAP_AT_CYCLE_COUNT("mapVvt_MAP_AT_CYCLE_COUNT", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1588, 1.0, -10.0, 100.0, "distance"),
+mapVvt_sync_counter("Instant MAP sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1589, 1.0, 0.0, 100.0, "counter"),
+mapVvt_min_point_counter("mapVvt_min_point_counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1590, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_39("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1591, 1.0, 0.0, 100.0, "units"),
+temp_mapVvt_index("temp_mapVvt_index", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1592, 1.0, -1.0, -1.0, ""),
+mapVvt_CycleDelta("mapVvt_CycleDelta", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1596, 1.0, -1.0, -1.0, ""),
+currentEngineDecodedPhase("Sync: TDC Engine Phase", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1600, 1.0, 0.0, 0.0, "deg"),
+triggerToothAngleError("Sync: trigger angle error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1604, 1.0, -30.0, 30.0, "deg"),
+triggerIgnoredToothCount("triggerIgnoredToothCount", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1608, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_57("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1609, 1.0, 0.0, 100.0, "units"),
+mapCamPrevToothAngle("Sync: MAP: prev angle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1612, 1.0, -3000.0, 3000.0, "deg"),
+triggerElapsedUs("triggerElapsedUs", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1620, 1.0, -1.0, -1.0, ""),
+synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1624, 1.0, -1.0, -1.0, ""),
+vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1628, 1.0, 0.0, 100000.0, "us"),
+vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1632, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1636, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1640, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1644, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1648, 1.0, -10000.0, 10000.0, ""),
+triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1652, 1.0, -10000.0, 10000.0, ""),
+triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1656, 1.0, -1.0, -1.0, ""),
+triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1657, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1658, 1.0, 0.0, 100.0, "units"),
+synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1624, 1.0, -1.0, -1.0, ""),
+vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1628, 1.0, 0.0, 100000.0, "us"),
+vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1632, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1636, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1640, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1644, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1648, 1.0, -10000.0, 10000.0, ""),
+triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1652, 1.0, -10000.0, 10000.0, ""),
+triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1656, 1.0, -1.0, -1.0, ""),
+triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1657, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1658, 1.0, 0.0, 100.0, "units"),
+synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1624, 1.0, -1.0, -1.0, ""),
+vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1628, 1.0, 0.0, 100000.0, "us"),
+vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1632, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1636, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1640, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1644, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1648, 1.0, -10000.0, 10000.0, ""),
+triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1652, 1.0, -10000.0, 10000.0, ""),
+triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1656, 1.0, -1.0, -1.0, ""),
+triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1657, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1658, 1.0, 0.0, 100.0, "units"),
+synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1624, 1.0, -1.0, -1.0, ""),
+vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1628, 1.0, 0.0, 100000.0, "us"),
+vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1632, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1636, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1640, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1644, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1648, 1.0, -10000.0, 10000.0, ""),
+triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1652, 1.0, -10000.0, 10000.0, ""),
+triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1656, 1.0, -1.0, -1.0, ""),
+triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1657, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1658, 1.0, 0.0, 100.0, "units"),
+synchronizationCounter("sync: wheel sync counter", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1624, 1.0, -1.0, -1.0, ""),
+vvtToothDurations0("vvtToothDurations0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1628, 1.0, 0.0, 100000.0, "us"),
+vvtCurrentPosition("sync: Primary Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1632, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition1("sync: Cam Position 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1636, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition2("sync: Cam Position 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1640, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition3("sync: Cam Position 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1644, 1.0, -10000.0, 10000.0, ""),
+vvtToothPosition4("sync: Cam Position 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1648, 1.0, -10000.0, 10000.0, ""),
+triggerSyncGapRatio("Sync: Trigger Latest Ratio", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1652, 1.0, -10000.0, 10000.0, ""),
+triggerStateIndex("triggerStateIndex", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1656, 1.0, -1.0, -1.0, ""),
+triggerCountersError("triggerCountersError", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1657, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_34("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1658, 1.0, 0.0, 100.0, "units"),
+camResyncCounter("sync: Phase Re-Sync Counter", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1804, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_1("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1805, 1.0, 0.0, 100.0, "units"),
+wallFuelCorrection("fuel wallwetting injection time\n correction to account for wall wetting effect for current cycle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1812, 1.0, -1.0, -1.0, ""),
+wallFuel("Fuel on the wall\nin ms of injector open time for each injector.", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1816, 1.0, -1.0, -1.0, ""),
+emaError("emaError", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1824, 1.0, -1.0, -1.0, ""),
+liveDataExampleField("liveDataExampleField", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1828, 1.0, -1.0, -1.0, ""),
+idleState("idleState", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1832, 1.0, -1.0, -1.0, ""),
+baseIdlePosition("idle: base value\ncurrent position without adjustments (iacByTpsTaper, afterCrankingIACtaperDuration)", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1836, 1.0, -1.0, -1.0, ""),
+iacByTpsTaper("idle: iacByTpsTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1840, 1.0, -1.0, -1.0, ""),
+idleTarget("Idle: Target RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1848, 1.0, -1.0, -1.0, ""),
+idleEntryRpm("Idle: Entry threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1850, 1.0, -1.0, -1.0, ""),
+idleExitRpm("Idle: Exit threshold", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1852, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_22("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1854, 1.0, 0.0, 100.0, "units"),
+targetRpmByClt("Idle: Target RPM base", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1856, 1.0, -1.0, -1.0, ""),
+targetRpmAc("Idle: Target A/C RPM", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1860, 1.0, -1.0, -1.0, ""),
+iacByRpmTaper("idle: iacByRpmTaper portion", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1864, 1.0, -1.0, -1.0, ""),
+luaAdd("idle: Lua Adder", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1868, 1.0, -1.0, -1.0, ""),
+m_lastTargetRpm("m_lastTargetRpm", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1872, 1.0, -1.0, -1.0, ""),
+idleClosedLoop("Closed loop", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1876, 1.0, -1.0, -1.0, ""),
+currentIdlePosition("Idle: Position", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1880, 1.0, 0.0, 0.0, "%"),
+idleTargetAirmass("Target airmass", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1884, 1.0, 0.0, 0.0, "mg"),
+idleTargetFlow("Target airflow", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1886, 0.01, 0.0, 0.0, "kg/h"),
+etbCurrentTarget("ETB: target for current pedal", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1888, 1.0, 0.0, 100.0, "%"),
+boardEtbAdjustment("ETB: board adjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1892, 1.0, -100.0, 100.0, "%"),
+targetWithIdlePosition("ETB: target with idle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1896, 1.0, 0.0, 100.0, "%"),
+luaAdjustment("ETB: luaAdjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1900, 1.0, -100.0, 100.0, "%"),
+trim("ETB: trim", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1904, 1.0, -100.0, 100.0, "%"),
+adjustedEtbTarget("ETB: target with adjustments", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1908, 0.01, 0.0, 100.0, "%"),
+m_adjustedTarget("ETB: final target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1910, 0.01, 0.0, 100.0, "%"),
+m_wastegatePosition("DC: wastegatePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1912, 1.0, 0.0, 3.0, "%"),
+m_lastPidDtMs("EBT: last PID dT", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1916, 1.0, 0.0, 4.0, "mS"),
+etbFeedForward("etbFeedForward", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1920, 1.0, -1.0, -1.0, ""),
+integralError("Integral error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1924, 1.0, 0.0, 100.0, ""),
+etbTpsErrorCounter("ETB TPS error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1932, 1.0, 0.0, 3.0, "count"),
+etbPpsErrorCounter("ETB pedal error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1934, 1.0, 0.0, 3.0, "count"),
+etbErrorCode("etbErrorCode", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1936, 1.0, -1.0, -1.0, ""),
+etbErrorCodeBlinker("etbErrorCodeBlinker", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1937, 1.0, -1.0, -1.0, ""),
+tcEtbDrop("ETB traction control", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1938, 1.0, 0.0, 100.0, "%"),
+alignmentFill_at_51("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1939, 1.0, 0.0, 100.0, "units"),
+jamTimer("ETB jam timer", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1940, 0.01, 0.0, 100.0, "sec"),
+state("state", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1942, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_55("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1943, 1.0, 0.0, 100.0, "units"),
+etbCurrentTarget("ETB: target for current pedal", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1888, 1.0, 0.0, 100.0, "%"),
+boardEtbAdjustment("ETB: board adjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1892, 1.0, -100.0, 100.0, "%"),
+targetWithIdlePosition("ETB: target with idle", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1896, 1.0, 0.0, 100.0, "%"),
+luaAdjustment("ETB: luaAdjustment", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1900, 1.0, -100.0, 100.0, "%"),
+trim("ETB: trim", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1904, 1.0, -100.0, 100.0, "%"),
+adjustedEtbTarget("ETB: target with adjustments", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1908, 0.01, 0.0, 100.0, "%"),
+m_adjustedTarget("ETB: final target", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1910, 0.01, 0.0, 100.0, "%"),
+m_wastegatePosition("DC: wastegatePosition", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1912, 1.0, 0.0, 3.0, "%"),
+m_lastPidDtMs("EBT: last PID dT", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1916, 1.0, 0.0, 4.0, "mS"),
+etbFeedForward("etbFeedForward", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1920, 1.0, -1.0, -1.0, ""),
+integralError("Integral error", SensorCategory.SENSOR_INPUTS, FieldType.INT, 1924, 1.0, 0.0, 100.0, ""),
+etbTpsErrorCounter("ETB TPS error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1932, 1.0, 0.0, 3.0, "count"),
+etbPpsErrorCounter("ETB pedal error counter", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1934, 1.0, 0.0, 3.0, "count"),
+etbErrorCode("etbErrorCode", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1936, 1.0, -1.0, -1.0, ""),
+etbErrorCodeBlinker("etbErrorCodeBlinker", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1937, 1.0, -1.0, -1.0, ""),
+tcEtbDrop("ETB traction control", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1938, 1.0, 0.0, 100.0, "%"),
+alignmentFill_at_51("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1939, 1.0, 0.0, 100.0, "units"),
+jamTimer("ETB jam timer", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 1940, 0.01, 0.0, 100.0, "sec"),
+state("state", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1942, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_55("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 1943, 1.0, 0.0, 100.0, "units"),
+stateCode("WBO: State code", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2000, 1.0, -1.0, -1.0, ""),
+heaterDuty("WBO: Heater duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2001, 1.0, 0.0, 100.0, "%"),
+pumpDuty("WBO: Pump duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2002, 1.0, 0.0, 100.0, "%"),
 alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2003, 1.0, 0.0, 100.0, "units"),
-lambdaTimeSinceGood("lambdaTimeSinceGood", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2008, 0.01, 0.0, 1.0, "sec"),
-alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2010, 1.0, 0.0, 100.0, "units"),
-sparkDuration1("Spark duration 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2012, 1.0, 0.0, 5.0, "ms"),
-sparkDuration2("Spark duration 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2016, 1.0, 0.0, 5.0, "ms"),
-sparkDuration3("Spark duration 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2020, 1.0, 0.0, 5.0, "ms"),
-sparkDuration4("Spark duration 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2024, 1.0, 0.0, 5.0, "ms"),
-ltftCntHit("LTFT learning: hits", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2028, 1.0, 0.0, 10000.0, "cnt"),
-ltftCntMiss("LTFT learning: miss", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2032, 1.0, 0.0, 10000.0, "cnt"),
-ltftCntDeadband("LTFT learning: in deadband", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2036, 1.0, 0.0, 10000.0, "cnt"),
-ltftCorrection1("LTFT: Bank 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2044, 1.0, 50.0, 150.0, "%"),
-ltftCorrection2("LTFT: Bank 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2048, 1.0, 50.0, 150.0, "%"),
-ltftAccummulatedCorrection1("LTFT: Total Bank 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2052, 1.0, 50.0, 150.0, "%"),
-ltftAccummulatedCorrection2("LTFT: Total Bank 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2056, 1.0, 50.0, 150.0, "%"),
-stftCorrectionBinIdx("STFT: used bin", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2060, 1.0, -1.0, -1.0, ""),
-stftLearningBinIdx("STFT: learning bin", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2061, 1.0, -1.0, -1.0, ""),
-stftCorrectionState("stftCorrectionState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2062, 1.0, -1.0, -1.0, ""),
-stftLearningState1("stftLearningState 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2063, 1.0, -1.0, -1.0, ""),
-stftLearningState2("stftLearningState 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2064, 1.0, -1.0, -1.0, ""),
-alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2065, 1.0, 0.0, 100.0, "units"),
-stftInputError1("STFT: input Lambda error 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2068, 1.0, 50.0, 150.0, "%"),
-stftInputError2("STFT: input Lambda error 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2072, 1.0, 50.0, 150.0, "%"),
+tempC("WBO: Temperature", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2008, 1.0, 500.0, 1000.0, "C"),
+nernstVoltage("WBO: Nernst Voltage", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2010, 0.001, 0.0, 1.0, "V"),
+esr("WBO: ESR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2012, 1.0, 0.0, 10000.0, "ohm"),
+alignmentFill_at_14("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2014, 1.0, 0.0, 100.0, "units"),
+stateCode("WBO: State code", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2000, 1.0, -1.0, -1.0, ""),
+heaterDuty("WBO: Heater duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2001, 1.0, 0.0, 100.0, "%"),
+pumpDuty("WBO: Pump duty", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2002, 1.0, 0.0, 100.0, "%"),
+alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2003, 1.0, 0.0, 100.0, "units"),
+tempC("WBO: Temperature", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2008, 1.0, 500.0, 1000.0, "C"),
+nernstVoltage("WBO: Nernst Voltage", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2010, 0.001, 0.0, 1.0, "V"),
+esr("WBO: ESR", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2012, 1.0, 0.0, 10000.0, "ohm"),
+alignmentFill_at_14("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2014, 1.0, 0.0, 100.0, "units"),
+dcOutput0("DC: output0", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2032, 1.0, -1.0, 1.0, "%"),
+isEnabled0_int("DC: en0", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2036, 1.0, 0.0, 10.0, "%"),
+alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2037, 1.0, 0.0, 100.0, "units"),
+value0("SENT ch0 value0", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2044, 1.0, 0.0, 4095.0, "RAW"),
+value1("SENT ch0 value1", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2046, 1.0, 0.0, 4095.0, "RAW"),
+errorRate("SENT ch0 error rate", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2048, 1.0, 0.0, 100.0, "% (don't belive me)"),
+vvtTarget("vvtTarget", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2052, 0.1, -90.0, 90.0, "deg"),
+vvtOutput("vvtOutput", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2054, 0.5, 100.0, 1.0, "%"),
+alignmentFill_at_3("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2055, 1.0, 0.0, 100.0, "units"),
+lambdaTimeSinceGood("lambdaTimeSinceGood", SensorCategory.SENSOR_INPUTS, FieldType.INT16, 2060, 0.01, 0.0, 1.0, "sec"),
+alignmentFill_at_6("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2062, 1.0, 0.0, 100.0, "units"),
+sparkDuration1("Spark duration 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2064, 1.0, 0.0, 5.0, "ms"),
+sparkDuration2("Spark duration 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2068, 1.0, 0.0, 5.0, "ms"),
+sparkDuration3("Spark duration 3", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2072, 1.0, 0.0, 5.0, "ms"),
+sparkDuration4("Spark duration 4", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2076, 1.0, 0.0, 5.0, "ms"),
+ltftCntHit("LTFT learning: hits", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2080, 1.0, 0.0, 10000.0, "cnt"),
+ltftCntMiss("LTFT learning: miss", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2084, 1.0, 0.0, 10000.0, "cnt"),
+ltftCntDeadband("LTFT learning: in deadband", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2088, 1.0, 0.0, 10000.0, "cnt"),
+ltftCorrection1("LTFT: Bank 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2096, 1.0, 50.0, 150.0, "%"),
+ltftCorrection2("LTFT: Bank 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2100, 1.0, 50.0, 150.0, "%"),
+ltftAccummulatedCorrection1("LTFT: Total Bank 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2104, 1.0, 50.0, 150.0, "%"),
+ltftAccummulatedCorrection2("LTFT: Total Bank 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2108, 1.0, 50.0, 150.0, "%"),
+stftCorrectionBinIdx("STFT: used bin", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2112, 1.0, -1.0, -1.0, ""),
+stftLearningBinIdx("STFT: learning bin", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2113, 1.0, -1.0, -1.0, ""),
+stftCorrectionState("stftCorrectionState", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2114, 1.0, -1.0, -1.0, ""),
+stftLearningState1("stftLearningState 1", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2115, 1.0, -1.0, -1.0, ""),
+stftLearningState2("stftLearningState 2", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2116, 1.0, -1.0, -1.0, ""),
+alignmentFill_at_5("need 4 byte alignment", SensorCategory.SENSOR_INPUTS, FieldType.INT8, 2117, 1.0, 0.0, 100.0, "units"),
+stftInputError1("STFT: input Lambda error 1", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2120, 1.0, 50.0, 150.0, "%"),
+stftInputError2("STFT: input Lambda error 2", SensorCategory.SENSOR_INPUTS, FieldType.INT, 2124, 1.0, 50.0, 150.0, "%"),
@@ -0,0 +1,87 @@
+/**
+ * @file live_data_snapshot.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "live_data_snapshot.h"
+#include "live_data.h"
+#include "tunerstudio.h"
+
+#if EFI_TUNER_STUDIO
+
+#if EFI_LIVE_DATA_SNAPSHOT
+
+static DoubleBufferedImage<TS_TOTAL_OUTPUT_SIZE> snapshot;
+
+static const efidur_t snapshotMaxAgeNt = MS2NT(LIVE_DATA_SNAPSHOT_PERIOD_MS);
+
+static const uint8_t* takeSnapshot(efitick_t nowNt) {
+	uint8_t *buffer = snapshot.beginWrite();
+	if (!buffer) {
+		return nullptr;
+	}
+
+	updateTunerStudioState();
+	copyRange(buffer, getLiveDataFragments(), 0, TS_TOTAL_OUTPUT_SIZE);
+	snapshot.publish(buffer, nowNt);
+
+	// hold it like any other reader
+	return snapshot.acquire(nowNt, snapshotMaxAgeNt);
+}
+
+#if EFI_UNIT_TEST
+void resetLiveDataSnapshotForUnitTests() {
+	snapshot.invalidate();
+}
+#endif // EFI_UNIT_TEST
+
+LiveDataReader::LiveDataReader() {
+	efitick_t nowNt = getTimeNowNt();
+	m_image = snapshot.acquire(nowNt, snapshotMaxAgeNt);
+
+	if (!m_image) {
+		m_image = takeSnapshot(nowNt);
+	}
+
+	if (!m_image) {
+		updateTunerStudioState();
+	}
+}
+
+LiveDataReader::~LiveDataReader() {
+	if (m_image) {
+		snapshot.release(m_image);
+	}
+}
+
+#else
+
+#if EFI_UNIT_TEST
+void resetLiveDataSnapshotForUnitTests() {
+}
+#endif // EFI_UNIT_TEST
+
+LiveDataReader::LiveDataReader()
+	: m_image(nullptr)
+{
+	updateTunerStudioState();
+}
+
+LiveDataReader::~LiveDataReader() {
+}
+
+#endif // EFI_LIVE_DATA_SNAPSHOT
+
+void LiveDataReader::copy(uint8_t *destination, size_t offset, size_t size) const {
+	// scatter offsets come from the client, let copyRange deal with anything past the image
+	if (m_image && offset + size <= TS_TOTAL_OUTPUT_SIZE) {
+		memcpy(destination, m_image + offset, size);
+	} else {
+		copyRange(destination, getLiveDataFragments(), offset, size);
+	}
+}
+
+#endif // EFI_TUNER_STUDIO
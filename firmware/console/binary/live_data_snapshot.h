@@ -0,0 +1,121 @@
+/**
+ * @file live_data_snapshot.h
+ * @brief Output channels image shared by all TunerStudio channels
+ *
+ * First TS thread which finds the latest image older than LIVE_DATA_SNAPSHOT_PERIOD_MS gathers all live data
+ * fragments into one of two buffers, channels serve their reads from the latest complete buffer. Gathering stays
+ * on low priority TS threads, its cost does not depend on number of connected clients, and every client sees
+ * the same sample.
+ *
+ * A reader holds its buffer for as long as it is sending it. Producer never writes into a buffer
+ * which is held, it skips the update instead, so a slow reader can not observe a torn image.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#ifndef LIVE_DATA_SNAPSHOT_PERIOD_MS
+#define LIVE_DATA_SNAPSHOT_PERIOD_MS 20
+#endif
+
+/**
+ * Two buffers, one is published, other one is being written.
+ * Any thread may produce, one at a time, readers may be any number of threads.
+ */
+template <size_t TSize>
+class DoubleBufferedImage {
+public:
+	/**
+	 * @return buffer to fill, nullptr if a reader still holds it or another thread is writing
+	 * Every non-null result has to be published.
+	 */
+	uint8_t* beginWrite() {
+		chibios_rt::CriticalSectionLocker csl;
+
+		size_t back = m_front < 0 ? 0 : 1 - m_front;
+		if (m_isWriting || m_readers[back] != 0) {
+			return nullptr;
+		}
+
+		// readers only ever take the front one, so it stays ours until published
+		m_isWriting = true;
+		return m_buffers[back];
+	}
+
+	void publish(const uint8_t *buffer, efitick_t nowNt) {
+		chibios_rt::CriticalSectionLocker csl;
+
+		m_isWriting = false;
+		m_front = buffer == m_buffers[0] ? 0 : 1;
+		m_publishedNt = nowNt;
+		m_sequence++;
+	}
+
+	/**
+	 * @return latest published buffer if it is not older than maxAgeNt, nullptr otherwise
+	 * Every non-null result has to be released.
+	 */
+	const uint8_t* acquire(efitick_t nowNt, efidur_t maxAgeNt) {
+		chibios_rt::CriticalSectionLocker csl;
+
+		if (m_front < 0 || nowNt - m_publishedNt > maxAgeNt) {
+			return nullptr;
+		}
+
+		m_readers[m_front]++;
+		return m_buffers[m_front];
+	}
+
+	void release(const uint8_t *buffer) {
+		chibios_rt::CriticalSectionLocker csl;
+
+		m_readers[buffer == m_buffers[0] ? 0 : 1]--;
+	}
+
+	// readers get nothing until next publish, buffers which are held stay held
+	void invalidate() {
+		chibios_rt::CriticalSectionLocker csl;
+
+		m_front = -1;
+	}
+
+	uint32_t getSequence() const {
+		return m_sequence;
+	}
+
+	static constexpr size_t size = TSize;
+
+private:
+	uint8_t m_buffers[2][TSize];
+	uint8_t m_readers[2] = { 0, 0 };
+	// nothing published yet if negative
+	int8_t m_front = -1;
+	bool m_isWriting = false;
+	efitick_t m_publishedNt = 0;
+	uint32_t m_sequence = 0;
+};
+
+#if EFI_UNIT_TEST
+void resetLiveDataSnapshotForUnitTests();
+#endif // EFI_UNIT_TEST
+
+/**
+ * Reads output channels from the latest snapshot, takes a new one if it is too old.
+ * Reads straight from live data if another thread is busy taking it, or both buffers are held.
+ */
+class LiveDataReader {
+public:
+	LiveDataReader();
+	~LiveDataReader();
+
+	void copy(uint8_t *destination, size_t offset, size_t size) const;
+
+	// whole image if it comes from snapshot, nullptr otherwise
+	const uint8_t* getImage() const {
+		return m_image;
+	}
+
+private:
+	const uint8_t *m_image;
+};
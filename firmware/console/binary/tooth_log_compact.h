@@ -0,0 +1,174 @@
+/**
+ * @file tooth_log_compact.h
+ * @brief Delta encoded composite tooth logger records
+ *
+ * Each record starts with a varint header: time since previous record in microseconds, shifted left by two,
+ * bit 1 means 'primary trigger level toggled', bit 0 means 'full channel byte follows'.
+ * Channel byte uses TOOTH_LOG_COMPACT_* bits and is written only when something other than primary level changes.
+ * A typical 60-2 tooth is two bytes instead of five bytes of composite_logger_s.
+ *
+ * Every buffer starts with a resync record: channel byte with TOOTH_LOG_COMPACT_RESYNC followed by
+ * absolute little endian timestamp, so buffers can be decoded on their own and simply concatenated.
+ *
+ * No firmware dependencies on purpose, misc/tooth_log_converter includes this file as well.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define TOOTH_LOG_COMPACT_PRI		0x01
+#define TOOTH_LOG_COMPACT_SEC		0x02
+#define TOOTH_LOG_COMPACT_TRIGGER	0x04
+#define TOOTH_LOG_COMPACT_SYNC		0x08
+#define TOOTH_LOG_COMPACT_COIL		0x10
+#define TOOTH_LOG_COMPACT_INJECTOR	0x20
+#define TOOTH_LOG_COMPACT_CHANNELS	0x3F
+#define TOOTH_LOG_COMPACT_RESYNC	0x80
+
+#define TOOTH_LOG_COMPACT_HEADER_CHANNELS	0x01
+#define TOOTH_LOG_COMPACT_HEADER_PRI_TOGGLE	0x02
+
+// 34 bit header takes five varint bytes, plus channel byte and resync timestamp
+#define TOOTH_LOG_COMPACT_MAX_RECORD 10
+
+struct ToothLogCompactEncoder {
+	// next record carries absolute timestamp
+	void reset() {
+		m_needsResync = true;
+	}
+
+	/**
+	 * @return number of bytes written, zero if record does not fit
+	 */
+	size_t encode(uint8_t *dst, size_t space, uint32_t timestampUs, uint8_t channels) {
+		channels &= TOOTH_LOG_COMPACT_CHANNELS;
+
+		uint64_t header;
+		bool writeChannels;
+
+		if (m_needsResync) {
+			header = TOOTH_LOG_COMPACT_HEADER_CHANNELS;
+			writeChannels = true;
+		} else {
+			uint8_t changed = channels ^ m_lastChannels;
+			// wraps around after 71 minutes just like the timestamp itself
+			uint64_t deltaUs = (uint32_t)(timestampUs - m_lastTimestampUs);
+
+			header = deltaUs << 2;
+			if (changed == TOOTH_LOG_COMPACT_PRI) {
+				header |= TOOTH_LOG_COMPACT_HEADER_PRI_TOGGLE;
+				writeChannels = false;
+			} else {
+				writeChannels = changed != 0;
+				if (writeChannels) {
+					header |= TOOTH_LOG_COMPACT_HEADER_CHANNELS;
+				}
+			}
+		}
+
+		uint8_t record[TOOTH_LOG_COMPACT_MAX_RECORD];
+		size_t size = 0;
+
+		do {
+			uint8_t byte = header & 0x7F;
+			header >>= 7;
+			record[size++] = header ? (byte | 0x80) : byte;
+		} while (header);
+
+		if (writeChannels) {
+			record[size++] = m_needsResync ? (channels | TOOTH_LOG_COMPACT_RESYNC) : channels;
+		}
+
+		if (m_needsResync) {
+			for (size_t i = 0; i < 4; i++) {
+				record[size++] = timestampUs >> (8 * i);
+			}
+		}
+
+		if (size > space) {
+			return 0;
+		}
+
+		for (size_t i = 0; i < size; i++) {
+			dst[i] = record[i];
+		}
+
+		m_needsResync = false;
+		m_lastTimestampUs = timestampUs;
+		m_lastChannels = channels;
+
+		return size;
+	}
+
+private:
+	bool m_needsResync = true;
+	uint32_t m_lastTimestampUs = 0;
+	uint8_t m_lastChannels = 0;
+};
+
+struct ToothLogCompactDecoder {
+	/**
+	 * @return number of bytes consumed, zero if record is truncated or malformed
+	 */
+	size_t decode(const uint8_t *src, size_t size, uint32_t &timestampUs, uint8_t &channels) {
+		uint64_t header = 0;
+		size_t idx = 0;
+
+		for (size_t shift = 0; ; shift += 7) {
+			if (idx >= size || shift > 28) {
+				return 0;
+			}
+
+			uint8_t byte = src[idx++];
+			header |= (uint64_t)(byte & 0x7F) << shift;
+
+			if (!(byte & 0x80)) {
+				break;
+			}
+		}
+
+		uint8_t newChannels = m_lastChannels;
+		if (header & TOOTH_LOG_COMPACT_HEADER_CHANNELS) {
+			if (idx >= size) {
+				return 0;
+			}
+			newChannels = src[idx++];
+		} else if (header & TOOTH_LOG_COMPACT_HEADER_PRI_TOGGLE) {
+			newChannels ^= TOOTH_LOG_COMPACT_PRI;
+		}
+
+		uint32_t newTimestampUs = m_lastTimestampUs + (uint32_t)(header >> 2);
+
+		if (newChannels & TOOTH_LOG_COMPACT_RESYNC) {
+			if (idx + 4 > size) {
+				return 0;
+			}
+			newTimestampUs = 0;
+			for (size_t i = 0; i < 4; i++) {
+				newTimestampUs |= (uint32_t)src[idx++] << (8 * i);
+			}
+			newChannels &= TOOTH_LOG_COMPACT_CHANNELS;
+			m_synced = true;
+		} else if (!m_synced) {
+			// stream has to start with absolute timestamp
+			return 0;
+		}
+
+		m_lastTimestampUs = newTimestampUs;
+		m_lastChannels = newChannels;
+
+		timestampUs = newTimestampUs;
+		channels = newChannels;
+
+		return idx;
+	}
+
+private:
+	bool m_synced = false;
+	uint32_t m_lastTimestampUs = 0;
+	uint8_t m_lastChannels = 0;
+};
@@ -10,6 +10,8 @@
 
 #include "pch.h"
 
+#include "tooth_log_compact.h"
+
 #if EFI_TOOTH_LOGGER
 #if !EFI_SHAFT_POSITION_INPUT
 	fail("EFI_SHAFT_POSITION_INPUT required to have EFI_EMULATE_POSITION_SENSORS")
@@ -69,7 +71,7 @@ void SetNextCompositeEntry(efitick_t timestamp) {
 	events.push_back(event);
 }
 
-void EnableToothLogger() {
+void EnableToothLogger(bool /*compact*/) {
 	ToothLoggerEnabled = true;
 	events.clear();
 }
@@ -80,12 +82,14 @@ void DisableToothLogger() {
 
 #else // not EFI_UNIT_TEST
 
-static constexpr size_t BUFFER_COUNT = BIG_BUFFER_SIZE / sizeof(CompositeBuffer);
-static_assert(BUFFER_COUNT >= 2);
+// actual count depends on how much of the big buffer we get
+static constexpr size_t MAX_BUFFER_COUNT = BIG_BUFFER_QUOTA_TOOTH_LOGGER / sizeof(CompositeBuffer);
+static_assert(MAX_BUFFER_COUNT >= 2);
 
 static CompositeBuffer* buffers = nullptr;
-static chibios_rt::Mailbox<CompositeBuffer*, BUFFER_COUNT> freeBuffers CCM_OPTIONAL;
-static chibios_rt::Mailbox<CompositeBuffer*, BUFFER_COUNT> filledBuffers CCM_OPTIONAL;
+static size_t bufferCount = 0;
+static chibios_rt::Mailbox<CompositeBuffer*, MAX_BUFFER_COUNT> freeBuffers CCM_OPTIONAL;
+static chibios_rt::Mailbox<CompositeBuffer*, MAX_BUFFER_COUNT> filledBuffers CCM_OPTIONAL;
 
 static CompositeBuffer* currentBuffer = nullptr;
 
@@ -97,30 +101,42 @@ static void setToothLogReady(bool value) {
 
 static BigBufferHandle bufferHandle;
 
-void EnableToothLogger() {
+static bool compactMode = false;
+static ToothLogCompactEncoder compactEncoder;
+
+void EnableToothLogger(bool compact) {
 	chibios_rt::CriticalSectionLocker csl;
 
-	bufferHandle = getBigBuffer(BigBufferUser::ToothLogger);
+	// give back what we hold from previous enable, if anything
+	bufferHandle = {};
+	bufferHandle = getBigBuffer(BigBufferUser::ToothLogger, 2 * sizeof(CompositeBuffer));
 	if (!bufferHandle) {
+		// previous buffers are gone, stop writing into them
+		ToothLoggerEnabled = false;
+		buffers = nullptr;
+		currentBuffer = nullptr;
 		return;
 	}
 
 	buffers = bufferHandle.get<CompositeBuffer>();
+	bufferCount = bufferHandle.size() / sizeof(CompositeBuffer);
 
 	// Reset all buffers
-	for (size_t i = 0; i < BUFFER_COUNT; i++) {
+	for (size_t i = 0; i < bufferCount; i++) {
 		buffers[i].nextIdx = 0;
 	}
 
 	// Reset state
 	currentBuffer = nullptr;
+	compactMode = compact;
 
 	// Empty the filled buffer list
 	CompositeBuffer* dummy;
 	while (MSG_TIMEOUT != filledBuffers.fetchI(&dummy)) ;
 
 	// Put all buffers in the free list
-	for (size_t i = 0; i < BUFFER_COUNT; i++) {
+	while (MSG_TIMEOUT != freeBuffers.fetchI(&dummy)) ;
+	for (size_t i = 0; i < bufferCount; i++) {
 		freeBuffers.postI(&buffers[i]);
 	}
 
@@ -143,6 +159,11 @@ void DisableToothLogger() {
 	// C++ magic: here we are calling BigBufferHandle::operator=() with empty instance
 	bufferHandle = {};
 	buffers = nullptr;
+	currentBuffer = nullptr;
+
+	// space may now belong to another user, make sure nobody reads it through us
+	CompositeBuffer* dummy;
+	while (MSG_TIMEOUT != filledBuffers.fetchI(&dummy)) ;
 }
 
 static CompositeBuffer* GetToothLoggerBufferImpl(sysinterval_t timeout) {
@@ -198,6 +219,9 @@ static CompositeBuffer* findBuffer(efitick_t timestamp) {
 		// to fill the buffer.
 		buffer->startTime.reset(timestamp);
 		buffer->nextIdx = 0;
+		buffer->isCompact = compactMode;
+		// each buffer starts with absolute timestamp
+		compactEncoder.reset();
 
 		currentBuffer = buffer;
 	}
@@ -216,27 +240,46 @@ static void SetNextCompositeEntry(efitick_t timestamp) {
 		return;
 	}
 
-	size_t idx = buffer->nextIdx;
-	auto nextIdx = idx + 1;
-	buffer->nextIdx = nextIdx;
-
-	if (idx < efi::size(buffer->buffer)) {
-		composite_logger_s* entry = &buffer->buffer[idx];
-
-		uint32_t nowUs = NT2US(timestamp);
+	uint32_t nowUs = NT2US(timestamp);
+	bool isSync = engine->triggerCentral.triggerState.getShaftSynchronized();
+	bool bufferFull;
+
+	if (buffer->isCompact) {
+		uint8_t channels =
+			  (currentTrigger1 ? TOOTH_LOG_COMPACT_PRI : 0)
+			| (currentTrigger2 ? TOOTH_LOG_COMPACT_SEC : 0)
+			| (currentTdc ? TOOTH_LOG_COMPACT_TRIGGER : 0)
+			| (isSync ? TOOTH_LOG_COMPACT_SYNC : 0)
+			| (currentCoilState ? TOOTH_LOG_COMPACT_COIL : 0)
+			| (currentInjectorState ? TOOTH_LOG_COMPACT_INJECTOR : 0);
+
+		size_t idx = buffer->nextIdx;
+		buffer->nextIdx += compactEncoder.encode(&buffer->compact[idx], sizeof(buffer->compact) - idx, nowUs, channels);
+
+		// swap while worst case record still fits so that no entry is ever dropped
+		bufferFull = sizeof(buffer->compact) - buffer->nextIdx < TOOTH_LOG_COMPACT_MAX_RECORD;
+	} else {
+		size_t idx = buffer->nextIdx;
+		auto nextIdx = idx + 1;
+		buffer->nextIdx = nextIdx;
+
+		if (idx < efi::size(buffer->buffer)) {
+			composite_logger_s* entry = &buffer->buffer[idx];
+
+			// TS uses big endian, grumble
+			entry->timestamp = SWAP_UINT32(nowUs);
+			entry->priLevel = currentTrigger1;
+			entry->secLevel = currentTrigger2;
+			entry->trigger = currentTdc;
+			entry->sync = isSync;
+			entry->coil = currentCoilState;
+			entry->injector = currentInjectorState;
+		}
 
-		// TS uses big endian, grumble
-		entry->timestamp = SWAP_UINT32(nowUs);
-		entry->priLevel = currentTrigger1;
-		entry->secLevel = currentTrigger2;
-		entry->trigger = currentTdc;
-		entry->sync = engine->triggerCentral.triggerState.getShaftSynchronized();
-		entry->coil = currentCoilState;
-		entry->injector = currentInjectorState;
+		// if the buffer is full...
+		bufferFull = nextIdx >= efi::size(buffer->buffer);
 	}
 
-	// if the buffer is full...
-	bool bufferFull = nextIdx >= efi::size(buffer->buffer);
 	// ... or it's been too long since the last flush
 	bool bufferTimedOut = buffer->startTime.hasElapsedSec(5);
 
@@ -20,7 +20,8 @@ void jsonTraceEntry(const char* name, int pid, bool isEnter, efitick_t timestamp
 void EnableToothLoggerIfNotEnabled();
 
 // Enable the tooth logger - this clears the buffer starts logging
-void EnableToothLogger();
+// compact: buffers are delta encoded, see tooth_log_compact.h
+void EnableToothLogger(bool compact = false);
 
 // Stop logging - leave buffer intact
 void DisableToothLogger();
@@ -52,9 +53,23 @@ typedef struct __attribute__ ((packed)) {
 static constexpr size_t toothLoggerEntriesPerBuffer = 250;
 
 struct CompositeBuffer {
-	composite_logger_s buffer[toothLoggerEntriesPerBuffer];
+	union {
+		composite_logger_s buffer[toothLoggerEntriesPerBuffer];
+		// TS_COMPOSITE_COMPACT_ENABLE
+		uint8_t compact[toothLoggerEntriesPerBuffer * sizeof(composite_logger_s)];
+	};
+	// entry count, or byte count for compact buffer
 	size_t nextIdx;
+	bool isCompact;
 	Timer startTime;
+
+	const uint8_t* getData() const {
+		return isCompact ? compact : reinterpret_cast<const uint8_t*>(buffer);
+	}
+
+	size_t getSizeBytes() const {
+		return isCompact ? nextIdx : nextIdx * sizeof(composite_logger_s);
+	}
 };
 
 // Get a reference to the buffer
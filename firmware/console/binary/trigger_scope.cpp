@@ -4,11 +4,27 @@
 
 #include "trigger_scope.h"
 #include "trigger_scope_config.h"
+#include "trigger_scope_envelope.h"
+
+#ifndef TRIGGER_SCOPE_ENVELOPE_CHUNK
+// frames per conversion, envelope mode samples into two such chunks in turn
+#define TRIGGER_SCOPE_ENVELOPE_CHUNK 128
+#endif
+
+#define TRIGGER_SCOPE_ENVELOPE_CHUNK_BYTES (TRIGGER_SCOPE_ENVELOPE_CHUNK * TRIGGER_SCOPE_CHANNEL_COUNT)
 
 static BigBufferHandle buffer;
 
 static bool isRunning = false;
 
+static bool isEnvelopeMode = false;
+static TriggerScopeEnvelope envelope;
+static uint16_t envelopeSamplesPerRecord;
+// -1 to start right away
+static int envelopeTriggerTooth = -1;
+static bool isArmed = false;
+static int chunkIndex;
+
 static void completionCallback(ADCDriver* adcp) {
 	if (isRunning && adcp->state == ADC_COMPLETE) {
 		engine->outputChannels.triggerScopeReady = true;
@@ -35,54 +51,139 @@ static const uint32_t smpr2 =
 	ADC_SMPR2_SMP_AN8(TRIGGER_SCOPE_SAMPLE_TIME) |
 	ADC_SMPR2_SMP_AN9(TRIGGER_SCOPE_SAMPLE_TIME);
 
-static const ADCConversionGroup adcConvGroupCh1 = { FALSE, 2, &completionCallback, nullptr,
-	ADC_CR1_RES_1,	// Sample in 8-bit mode
-	ADC_CR2_SWSTART,
-	// sample times for channels 10...18
-	smpr1,
-	// sample times for channels 0...9
-	smpr2,
+#define TRIGGER_SCOPE_CONVERSION_GROUP(callback) { FALSE, 2, callback, nullptr, \
+	ADC_CR1_RES_1,	/* Sample in 8-bit mode */ \
+	ADC_CR2_SWSTART, \
+	/* sample times for channels 10...18 */ \
+	smpr1, \
+	/* sample times for channels 0...9 */ \
+	smpr2, \
+ \
+	0,	/* htr */ \
+	0,	/* ltr */ \
+ \
+	0,	/* sqr1 */ \
+	0,	/* sqr2 */ \
+	ADC_SQR3_SQ1_N(TRIGGER_SCOPE_ADC_CH1) | ADC_SQR3_SQ2_N(TRIGGER_SCOPE_ADC_CH2) \
+}
+
+static const ADCConversionGroup adcConvGroupCh1 = TRIGGER_SCOPE_CONVERSION_GROUP(&completionCallback);
+
+static void envelopeCallback(ADCDriver* adcp);
+static const ADCConversionGroup adcConvGroupEnvelope = TRIGGER_SCOPE_CONVERSION_GROUP(&envelopeCallback);
+
+// chunks live at the end of the buffer, records are written from the start
+static uint8_t* getEnvelopeChunk(int index) {
+	return buffer.get<uint8_t>() + buffer.size() - (2 - index) * TRIGGER_SCOPE_ENVELOPE_CHUNK_BYTES;
+}
+
+static void startEnvelopeChunkI() {
+	adcStartConversionI(&TRIGGER_SCOPE_ADC, &adcConvGroupEnvelope,
+		reinterpret_cast<adcsample_t*>(getEnvelopeChunk(chunkIndex)), TRIGGER_SCOPE_ENVELOPE_CHUNK);
+}
 
-	0,	// htr
-	0,	// ltr
+static void startEnvelopeI() {
+	envelope.start(buffer.get<uint8_t>(), buffer.size() - 2 * TRIGGER_SCOPE_ENVELOPE_CHUNK_BYTES, envelopeSamplesPerRecord);
+	chunkIndex = 0;
+	startEnvelopeChunkI();
+}
+
+static void envelopeCallback(ADCDriver* adcp) {
+	if (!isRunning || !buffer || adcp->state != ADC_COMPLETE) {
+		return;
+	}
+
+	const uint8_t* completed = getEnvelopeChunk(chunkIndex);
+	bool isLastChunk = envelope.getFramesToFill() <= TRIGGER_SCOPE_ENVELOPE_CHUNK;
+
+	// other chunk fills while this one is folded into records
+	if (!isLastChunk) {
+		chibios_rt::CriticalSectionLocker csl;
+		chunkIndex ^= 1;
+		startEnvelopeChunkI();
+	}
+
+	if (envelope.feed(completed, TRIGGER_SCOPE_ENVELOPE_CHUNK)) {
+		engine->outputChannels.triggerScopeReady = true;
+	}
+}
 
-	0,	// sqr1
-	0,	// sqr2
-	ADC_SQR3_SQ1_N(TRIGGER_SCOPE_ADC_CH1) | ADC_SQR3_SQ2_N(TRIGGER_SCOPE_ADC_CH2)
-};
+static bool isAdcReady() {
+	return (TRIGGER_SCOPE_ADC.state == ADC_READY) ||
+			(TRIGGER_SCOPE_ADC.state == ADC_COMPLETE) ||
+			(TRIGGER_SCOPE_ADC.state == ADC_ERROR);
+}
 
-static constexpr size_t sampleCount = BIG_BUFFER_SIZE / (2 * sizeof(uint8_t));
 
 static void startSampling() {
 	chibios_rt::CriticalSectionLocker csl;
 
 	if (buffer && !engineConfiguration->enableSoftwareKnock) {
 		// Cancel if ADC isn't ready
-		if (!((TRIGGER_SCOPE_ADC.state == ADC_READY) ||
-				(TRIGGER_SCOPE_ADC.state == ADC_COMPLETE) ||
-				(TRIGGER_SCOPE_ADC.state == ADC_ERROR))) {
+		if (!isAdcReady()) {
 			triggerScopeDisable();
 			return;
 		}
 
+		if (isEnvelopeMode) {
+			if (envelopeTriggerTooth >= 0) {
+				// see triggerScopeOnTriggerTooth
+				isArmed = true;
+			} else {
+				startEnvelopeI();
+			}
+			return;
+		}
+
+		// two channels, 8 bit samples
+		size_t sampleCount = buffer.size() / (2 * sizeof(uint8_t));
 		adcStartConversionI(&TRIGGER_SCOPE_ADC, &adcConvGroupCh1, buffer.get<adcsample_t>(), sampleCount);
 	}
 }
 
 // Enable one buffer's worth of perf tracing, and retrieve the buffer size in bytes
 void triggerScopeEnable() {
+	buffer = {};
 	buffer = getBigBuffer(BigBufferUser::TriggerScope);
 
+	isEnvelopeMode = false;
 	isRunning = true;
 
 	startSampling();
 }
 
+void triggerScopeEnableEnvelope(uint16_t samplesPerRecord, int triggerTooth) {
+	buffer = {};
+	buffer = getBigBuffer(BigBufferUser::TriggerScope, 2 * TRIGGER_SCOPE_ENVELOPE_CHUNK_BYTES + TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE);
+
+	envelopeSamplesPerRecord = samplesPerRecord;
+	envelopeTriggerTooth = triggerTooth;
+	isArmed = false;
+	isEnvelopeMode = true;
+	isRunning = true;
+
+	startSampling();
+}
+
+void triggerScopeOnTriggerTooth(uint32_t trgEventIndex) {
+	if (!isArmed || (int)trgEventIndex != envelopeTriggerTooth) {
+		return;
+	}
+
+	chibios_rt::CriticalSectionLocker csl;
+	isArmed = false;
+
+	if (isRunning && buffer && isAdcReady()) {
+		startEnvelopeI();
+	}
+}
+
 void triggerScopeDisable() {
 	// we're done with the buffer - let somebody else have it
 	buffer = {};
 
 	isRunning = false;
+	isArmed = false;
 	engine->outputChannels.triggerScopeReady = false;
 }
 
@@ -101,6 +202,10 @@ const BigBufferHandle& triggerScopeGetBuffer() {
 	return buffer;
 }
 
+size_t triggerScopeGetSize() {
+	return isEnvelopeMode ? envelope.getSize() : buffer.size();
+}
+
 void initTriggerScope() {
 	// Trigger scope and knock currently mutually exclusive
 	if (!engineConfiguration->enableSoftwareKnock) {
@@ -3,5 +3,14 @@
 void triggerScopeEnable();
 void triggerScopeDisable();
 const BigBufferHandle& triggerScopeGetBuffer();
+// bytes of buffer which hold data, whole buffer unless in envelope mode
+size_t triggerScopeGetSize();
+
+/**
+ * Instead of raw samples capture min/max/mean records, see trigger_scope_envelope.h
+ * @param triggerTooth trigger event index to start each capture at, -1 to start right away
+ */
+void triggerScopeEnableEnvelope(uint16_t samplesPerRecord, int triggerTooth);
+void triggerScopeOnTriggerTooth(uint32_t trgEventIndex);
 
 void initTriggerScope();
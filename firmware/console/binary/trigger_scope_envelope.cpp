@@ -0,0 +1,73 @@
+/**
+ * @file trigger_scope_envelope.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "trigger_scope_envelope.h"
+
+void TriggerScopeEnvelope::start(uint8_t *output, size_t outputSize, uint16_t samplesPerRecord) {
+	m_output = output;
+	m_outputSize = outputSize;
+	m_written = 0;
+	m_samplesPerRecord = samplesPerRecord == 0 ? 1 : samplesPerRecord;
+	resetRecord();
+}
+
+void TriggerScopeEnvelope::resetRecord() {
+	m_count = 0;
+	for (int ch = 0; ch < TRIGGER_SCOPE_CHANNEL_COUNT; ch++) {
+		m_min[ch] = UINT8_MAX;
+		m_max[ch] = 0;
+		m_sum[ch] = 0;
+	}
+}
+
+void TriggerScopeEnvelope::writeRecord() {
+	uint8_t *record = m_output + m_written;
+	for (int ch = 0; ch < TRIGGER_SCOPE_CHANNEL_COUNT; ch++) {
+		record[3 * ch] = m_min[ch];
+		record[3 * ch + 1] = m_max[ch];
+		record[3 * ch + 2] = (m_sum[ch] + m_count / 2) / m_count;
+	}
+	m_written += TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE;
+
+	resetRecord();
+}
+
+bool TriggerScopeEnvelope::feed(const uint8_t *frames, size_t frameCount) {
+	if (isFull()) {
+		return true;
+	}
+
+	for (size_t i = 0; i < frameCount; i++) {
+		const uint8_t *frame = frames + i * TRIGGER_SCOPE_CHANNEL_COUNT;
+		for (int ch = 0; ch < TRIGGER_SCOPE_CHANNEL_COUNT; ch++) {
+			uint8_t sample = frame[ch];
+			m_min[ch] = std::min(m_min[ch], sample);
+			m_max[ch] = std::max(m_max[ch], sample);
+			m_sum[ch] += sample;
+		}
+
+		if (++m_count == m_samplesPerRecord) {
+			writeRecord();
+
+			if (isFull()) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+size_t TriggerScopeEnvelope::getFramesToFill() const {
+	if (isFull()) {
+		return 0;
+	}
+
+	size_t records = (m_outputSize - m_written) / TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE;
+	return records * m_samplesPerRecord - m_count;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file trigger_scope_envelope.h
+ * @brief Folds interleaved trigger scope samples into min/max/mean records
+ *
+ * One record covers samplesPerRecord frames, a frame being one 8 bit sample of each channel.
+ * Record layout is min, max, mean of channel 1 followed by the same for channel 2, so with a
+ * decimation of 64 a buffer holds 64 / 3 times longer window than raw samples would.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define TRIGGER_SCOPE_CHANNEL_COUNT 2
+#define TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE (3 * TRIGGER_SCOPE_CHANNEL_COUNT)
+
+class TriggerScopeEnvelope {
+public:
+	void start(uint8_t *output, size_t outputSize, uint16_t samplesPerRecord);
+
+	/**
+	 * @param frames interleaved samples, TRIGGER_SCOPE_CHANNEL_COUNT bytes per frame
+	 * @return true once output is full, frames past that point are dropped
+	 */
+	bool feed(const uint8_t *frames, size_t frameCount);
+
+	bool isFull() const {
+		return m_written + TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE > m_outputSize;
+	}
+
+	// frames still needed to fill the output
+	size_t getFramesToFill() const;
+
+	// bytes of complete records
+	size_t getSize() const {
+		return m_written;
+	}
+
+	uint16_t getSamplesPerRecord() const {
+		return m_samplesPerRecord;
+	}
+
+private:
+	void resetRecord();
+	void writeRecord();
+
+	uint8_t *m_output = nullptr;
+	size_t m_outputSize = 0;
+	size_t m_written = 0;
+	uint16_t m_samplesPerRecord = 1;
+
+	uint16_t m_count = 0;
+	uint8_t m_min[TRIGGER_SCOPE_CHANNEL_COUNT];
+	uint8_t m_max[TRIGGER_SCOPE_CHANNEL_COUNT];
+	uint32_t m_sum[TRIGGER_SCOPE_CHANNEL_COUNT];
+};
@@ -0,0 +1,145 @@
+/**
+ * @file ts_output_delta.h
+ * @brief Changed byte ranges of output channels image
+ *
+ * TS_OUTPUT_DELTA_COMMAND response payload starts with frame type and frame sequence number.
+ * Full frame carries the whole requested range. Delta frame carries runs relative to the previous frame:
+ * number of unchanged bytes to skip (0-255), run length (0-255), then run length bytes of new data.
+ * Longer gaps are written as several runs of zero length.
+ *
+ * Client echoes sequence number of the last frame it has applied, anything else gets a full frame,
+ * so a lost or corrupted response costs one full frame.
+ *
+ * No firmware dependencies on purpose, so that it is easy to reuse on the client side.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define TS_OUTPUT_DELTA_FULL 0
+#define TS_OUTPUT_DELTA_CHANGES 1
+
+// frame type and sequence number
+#define TS_OUTPUT_DELTA_HEADER_SIZE 2
+
+#define TS_OUTPUT_DELTA_MAX_SKIP 255
+#define TS_OUTPUT_DELTA_MAX_RUN 255
+
+/**
+ * Compares image against the previously sent one part by part, so the caller never needs
+ * both images in full at the same time, and turns the shadow into the current image as it goes.
+ */
+class TsOutputDeltaEncoder {
+public:
+	TsOutputDeltaEncoder(uint8_t *out, size_t space)
+		: m_out(out)
+		, m_space(space)
+	{
+	}
+
+	/**
+	 * Next part of the image: parts have to be contiguous, starting from the first byte
+	 */
+	void update(uint8_t *shadow, const uint8_t *current, size_t size) {
+		for (size_t i = 0; i < size; i++) {
+			if (shadow[i] == current[i]) {
+				m_runLength = nullptr;
+				m_skip++;
+				continue;
+			}
+
+			shadow[i] = current[i];
+
+			if (!m_runLength || *m_runLength == TS_OUTPUT_DELTA_MAX_RUN) {
+				openRun();
+			}
+
+			if (m_overflow || m_size >= m_space) {
+				m_overflow = true;
+				continue;
+			}
+
+			m_out[m_size++] = current[i];
+			(*m_runLength)++;
+		}
+	}
+
+	// runs did not fit, or would not be smaller than full frame: shadow is still updated
+	bool isOverflow() const {
+		return m_overflow;
+	}
+
+	size_t size() const {
+		return m_size;
+	}
+
+private:
+	void openRun() {
+		m_runLength = nullptr;
+
+		while (!m_overflow && m_skip > TS_OUTPUT_DELTA_MAX_SKIP) {
+			appendRun(TS_OUTPUT_DELTA_MAX_SKIP);
+			m_runLength = nullptr;
+			m_skip -= TS_OUTPUT_DELTA_MAX_SKIP;
+		}
+
+		if (!m_overflow) {
+			appendRun(m_skip);
+			m_skip = 0;
+		}
+	}
+
+	void appendRun(size_t skip) {
+		if (m_size + 2 > m_space) {
+			m_overflow = true;
+			return;
+		}
+
+		m_out[m_size++] = skip;
+		m_runLength = &m_out[m_size];
+		m_out[m_size++] = 0;
+	}
+
+	uint8_t * const m_out;
+	const size_t m_space;
+	size_t m_size = 0;
+
+	// unchanged bytes since the end of the last run
+	size_t m_skip = 0;
+	// length byte of the run being written, null if last byte was unchanged
+	uint8_t *m_runLength = nullptr;
+	bool m_overflow = false;
+};
+
+/**
+ * Applies delta frame runs to the previous image
+ * @return false if runs do not fit the image
+ */
+inline bool tsOutputDeltaApply(uint8_t *image, size_t imageSize, const uint8_t *runs, size_t size) {
+	size_t position = 0;
+	size_t i = 0;
+
+	while (i < size) {
+		if (i + 2 > size) {
+			return false;
+		}
+
+		position += runs[i];
+		size_t length = runs[i + 1];
+		i += 2;
+
+		if (i + length > size || position + length > imageSize) {
+			return false;
+		}
+
+		for (size_t j = 0; j < length; j++) {
+			image[position++] = runs[i++];
+		}
+	}
+
+	return true;
+}
@@ -78,12 +78,15 @@
 #include "trigger_scope.h"
 #include "electronic_throttle.h"
 #include "live_data.h"
+#include "live_data_snapshot.h"
+#include "crc32_fast.h"
 #include "efi_quote.h"
 
 #include <string.h>
 #include "bench_test.h"
 #include "status_loop.h"
 #include "mmc_card.h"
+#include "edge_latency.h"
 
 #if EFI_SIMULATOR
 #include "rusEfiFunctionalTest.h"
@@ -170,6 +173,40 @@ void tunerStudioDebug(TsChannelBase* tsChannel, const char *msg) {
 // use this array for any disabled pages on TS
 uint8_t ts_blank_page_placeholder[256];
 
+#if EFI_TS_PAGE_CRC_CACHE
+// TS checks CRC of the whole settings page after every connect and burn
+static Crc32PageCache<TOTAL_CONFIG_SIZE> settingsPageCrc;
+// changes which do not come through TS writes bump configuration version
+static int settingsPageCrcConfigVersion = -1;
+// or report changed area, lowest changed offset since last CRC check
+static size_t settingsPageFirmwareDirtyStart = TOTAL_CONFIG_SIZE;
+
+#if EFI_UNIT_TEST
+void resetTsPageCrcCacheForUnitTests() {
+	settingsPageCrc.invalidate();
+}
+#endif // EFI_UNIT_TEST
+#elif EFI_UNIT_TEST
+void resetTsPageCrcCacheForUnitTests() {
+}
+#endif // EFI_TS_PAGE_CRC_CACHE
+
+void onConfigurationAreaChanged(const void *start, size_t size) {
+#if EFI_TS_PAGE_CRC_CACHE
+	if (size == 0) {
+		return;
+	}
+
+	// cache itself belongs to TS thread
+	size_t offset = (const uint8_t*)start - (const uint8_t*)config;
+	chibios_rt::CriticalSectionLocker csl;
+	settingsPageFirmwareDirtyStart = minI(settingsPageFirmwareDirtyStart, offset);
+#else
+	UNUSED(start);
+	UNUSED(size);
+#endif // EFI_TS_PAGE_CRC_CACHE
+}
+
 static uint8_t* getWorkingPageAddr(TsChannelBase* tsChannel, size_t page, size_t offset) {
 	// TODO: validate offset?
 	switch (page) {
@@ -347,7 +384,18 @@ void TunerStudio::handleWriteChunkCommand(TsChannelBase* tsChannel, uint16_t pag
 		}
 		// Force any board configuration options that humans shouldn't be able to change
 		// huh, why is this NOT within above 'needToTriggerTsRefresh()' condition?
-		call_board_override(custom_board_ConfigOverrides);
+		bool hasBoardOverrides = call_board_override(custom_board_ConfigOverrides);
+
+#if EFI_TS_PAGE_CRC_CACHE
+		if (hasBoardOverrides) {
+			// could have touched anything
+			settingsPageCrc.invalidate();
+		} else {
+			settingsPageCrc.markDirty(offset, count);
+		}
+#else
+		UNUSED(hasBoardOverrides);
+#endif // EFI_TS_PAGE_CRC_CACHE
 	} else {
 		memcpy(addr, content, count);
 	}
@@ -371,7 +419,32 @@ void TunerStudio::handleCrc32Check(TsChannelBase *tsChannel, uint16_t page, uint
 		return;
 	}
 
-	uint32_t crc = SWAP_UINT32(crc32(start, count));
+	uint32_t crc;
+#if EFI_TS_PAGE_CRC_CACHE
+	if (page == TS_PAGE_SETTINGS && offset == 0 && count == TOTAL_CONFIG_SIZE) {
+		int version = engine->getGlobalConfigurationVersion();
+		if (version != settingsPageCrcConfigVersion) {
+			settingsPageCrc.invalidate();
+			settingsPageCrcConfigVersion = version;
+		}
+
+		size_t firmwareDirtyStart;
+		{
+			chibios_rt::CriticalSectionLocker csl;
+			firmwareDirtyStart = settingsPageFirmwareDirtyStart;
+			settingsPageFirmwareDirtyStart = TOTAL_CONFIG_SIZE;
+		}
+		if (firmwareDirtyStart < TOTAL_CONFIG_SIZE) {
+			settingsPageCrc.markDirty(firmwareDirtyStart, TOTAL_CONFIG_SIZE - firmwareDirtyStart);
+		}
+		crc = settingsPageCrc.get(start);
+	} else
+#endif // EFI_TS_PAGE_CRC_CACHE
+	{
+		crc = crc32Fast(start, count);
+	}
+
+	crc = SWAP_UINT32(crc);
 	tsChannel->sendResponse(TS_CRC, (const uint8_t *) &crc, 4);
 	// todo: rename to onConfigCrc?
 	ConfigurationWizard::onConfigOnStartUpOrBurn(false);
@@ -400,6 +473,7 @@ void TunerStudio::handleScatteredReadCommand(TsChannelBase* tsChannel) {
 	uint32_t crc = tsChannel->writePacketHeader(TS_RESPONSE_OK, totalResponseSize);
 
 	uint8_t dataBuffer[8];
+	LiveDataReader reader;
 	for (size_t i = 0; i < TS_SCATTER_OFFSETS_COUNT; i++) {
 		uint16_t packed = tsChannel->page1.highSpeedOffsets[i];
 		uint16_t type = packed >> 13;
@@ -410,9 +484,9 @@ void TunerStudio::handleScatteredReadCommand(TsChannelBase* tsChannel) {
 		size_t size = 1 << (type - 1);
 
 		// write each data point and CRC incrementally
-		copyRange(dataBuffer, getLiveDataFragments(), offset, size);
+		reader.copy(dataBuffer, offset, size);
 		tsChannel->write(dataBuffer, size, false);
-		crc = crc32inc((void*)dataBuffer, crc, size);
+		crc = crc32FastInc((void*)dataBuffer, crc, size);
 	}
 #if EFI_SIMULATOR
 //	printf("CRC %x\n", crc);
@@ -510,6 +584,9 @@ static bool isKnownCommand(char command) {
 #endif // EFI_SIMULATOR
 #if EFI_TS_SCATTER
 			|| command == TS_GET_SCATTERED_GET_COMMAND
+#endif
+#if EFI_TS_OUTPUT_DELTA
+			|| command == TS_OUTPUT_DELTA_COMMAND
 #endif
 			|| command == TS_SET_LOGGER_SWITCH
 			|| command == TS_GET_COMPOSITE_BUFFER_DONE_DIFFERENTLY
@@ -519,6 +596,7 @@ static bool isKnownCommand(char command) {
 			|| command == TS_PERF_TRACE_BEGIN
 			|| command == TS_PERF_TRACE_GET_BUFFER
 			|| command == TS_GET_CONFIG_ERROR
+			|| command == TS_GET_EDGE_LATENCY
 			|| command == TS_QUERY_BOOTLOADER;
 }
 
@@ -718,7 +796,7 @@ static int tsProcessOne(TsChannelBase* tsChannel) {
 
 	expectedCrc = SWAP_UINT32(expectedCrc);
 
-	uint32_t actualCrc = crc32(tsChannel->scratchBuffer, incomingPacketSize);
+	uint32_t actualCrc = crc32Fast(tsChannel->scratchBuffer, incomingPacketSize);
 	if (actualCrc != expectedCrc) {
 		/* send error only if previously we were in sync */
 		if (tsChannel->in_sync) {
@@ -851,6 +929,12 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 		// TS will not use this command until ochBlockSize is bigger than blockingFactor and prefer ochGetCommand :(
 		cmdOutputChannels(tsChannel, offset, count);
 		break;
+#if EFI_TS_OUTPUT_DELTA
+	case TS_OUTPUT_DELTA_COMMAND:
+		// sequence byte follows offset and count, without it client gets a full frame
+		cmdOutputChannelsDelta(tsChannel, offset, count, incomingPacketSize >= 6 ? (uint8_t)data[4] : -1);
+		break;
+#endif // EFI_TS_OUTPUT_DELTA
 	case TS_GET_SCATTERED_GET_COMMAND:
 #if EFI_TS_SCATTER
 		handleScatteredReadCommand(tsChannel);
@@ -906,6 +990,16 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 	case TS_GET_CONFIG_ERROR:
 		handleGetConfigErorr(tsChannel);
 		break;
+	case TS_GET_EDGE_LATENCY:
+#if EFI_OUTPUT_EDGE_LATENCY
+		{
+			auto& report = getEdgeLatencyReport();
+			tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(&report), sizeof(report), true);
+		}
+#else
+		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE, DO_NOT_LOG);
+#endif /* EFI_OUTPUT_EDGE_LATENCY */
+		break;
 #if EFI_SIMULATOR
 	case TS_SIMULATE_CAN:
 		void handleWrapCan(TsChannelBase* tsChannel, char *data, int incomingPacketSize);
@@ -932,6 +1026,9 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 		case TS_COMPOSITE_ENABLE:
 			EnableToothLogger();
 			break;
+		case TS_COMPOSITE_COMPACT_ENABLE:
+			EnableToothLogger(/*compact*/true);
+			break;
 		case TS_COMPOSITE_DISABLE:
 			DisableToothLogger();
 			break;
@@ -940,7 +1037,7 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 				auto toothBuffer = GetToothLoggerBufferNonblocking();
 
 				if (toothBuffer) {
-					tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(toothBuffer->buffer), toothBuffer->nextIdx * sizeof(composite_logger_s), true);
+					tsChannel->sendResponse(TS_CRC, toothBuffer->getData(), toothBuffer->getSizeBytes(), true);
 
 					ReturnToothLoggerBuffer(toothBuffer);
 				} else {
@@ -953,6 +1050,12 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 		case TS_TRIGGER_SCOPE_ENABLE:
 			triggerScopeEnable();
 			break;
+		case TS_TRIGGER_SCOPE_ENVELOPE_ENABLE:
+			// samples per record as uint16, then optional trigger event index to capture at, also uint16
+			triggerScopeEnableEnvelope(
+				incomingPacketSize >= 4 ? (uint8_t)data[1] | (uint8_t)data[2] << 8 : 1,
+				incomingPacketSize >= 6 ? (uint8_t)data[3] | (uint8_t)data[4] << 8 : -1);
+			break;
 		case TS_TRIGGER_SCOPE_DISABLE:
 			triggerScopeDisable();
 			break;
@@ -961,7 +1064,7 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 				const auto& buffer = triggerScopeGetBuffer();
 
 				if (buffer) {
-					tsChannel->sendResponse(TS_CRC, buffer.get<uint8_t>(), buffer.size(), true);
+					tsChannel->sendResponse(TS_CRC, buffer.get<uint8_t>(), triggerScopeGetSize(), true);
 				} else {
 					// TS asked for a tooth logger buffer, but we don't have one to give it.
 					sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE, DO_NOT_LOG);
@@ -984,7 +1087,7 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 			auto toothBuffer = GetToothLoggerBufferNonblocking();
 
 			if (toothBuffer) {
-				tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(toothBuffer->buffer), toothBuffer->nextIdx * sizeof(composite_logger_s), true);
+				tsChannel->sendResponse(TS_CRC, toothBuffer->getData(), toothBuffer->getSizeBytes(), true);
 
 				ReturnToothLoggerBuffer(toothBuffer);
 			} else {
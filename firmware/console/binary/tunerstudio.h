@@ -55,6 +55,16 @@ int getSecondsSinceChannelsRequest();
 
 void updateTunerStudioState();
 
+/**
+ * Firmware side change of persistent_config_s which does not go through TS, for instance LTFT applied to VE table.
+ * Safe from any thread, TS picks it up on next CRC check.
+ */
+void onConfigurationAreaChanged(const void *start, size_t size);
+
+#if EFI_UNIT_TEST
+void resetTsPageCrcCacheForUnitTests();
+#endif // EFI_UNIT_TEST
+
 bool isTuningVeNow();
 void startTunerStudioConnectivity();
 bool needToTriggerTsRefresh();
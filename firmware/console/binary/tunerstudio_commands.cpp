@@ -5,9 +5,14 @@
 #include "tunerstudio_io.h"
 
 #include "live_data.h"
+#include "live_data_snapshot.h"
 
 #include "status_loop.h"
 
+#if EFI_TS_OUTPUT_DELTA
+#include "ts_output_delta.h"
+#endif // EFI_TS_OUTPUT_DELTA
+
 #if EFI_TUNER_STUDIO
 
 static Timer channelsRequestTimer;
@@ -34,23 +39,25 @@ void TunerStudio::cmdOutputChannels(TsChannelBase* tsChannel, uint16_t offset, u
 	}
 
 	tsState.outputChannelsCommandCounter++;
-	updateTunerStudioState();
 	// this method is invoked too often to print any debug information
 	uint8_t * scratchBuffer = (uint8_t *)tsChannel->scratchBuffer;
 	/**
 	 * collect data from all models
 	 */
-	FragmentList list = getLiveDataFragments();
+	LiveDataReader reader;
 
 	uint32_t crc = tsChannel->writePacketHeader(TS_RESPONSE_OK, count);
 
+	if (reader.getImage()) {
+		// snapshot does not change while we hold it, no need to copy
+		crc = tsChannel->writePacketBody(reader.getImage() + offset, count, crc);
+		count = 0;
+	}
+
 	while (count) {
 		size_t chunkSize = minI(count, sizeof(tsChannel->scratchBuffer));
-		/**
-		 * collect data from all models
-		 */
-		size_t actualSize = copyRange(scratchBuffer, list, offset, chunkSize);
-		crc = tsChannel->writePacketBody(scratchBuffer, actualSize, crc);
+		reader.copy(scratchBuffer, offset, chunkSize);
+		crc = tsChannel->writePacketBody(scratchBuffer, chunkSize, crc);
 
 		count -= chunkSize;
 		offset += chunkSize;
@@ -59,4 +66,67 @@ void TunerStudio::cmdOutputChannels(TsChannelBase* tsChannel, uint16_t offset, u
 	tsChannel->writeCrcPacketTail(crc);
 }
 
+#if EFI_TS_OUTPUT_DELTA
+
+/**
+ * @brief Same as 'Output' command but only bytes which have changed since the frame client has acknowledged
+ * @param lastSequence sequence number of the last frame client has applied, -1 if none
+ */
+void TunerStudio::cmdOutputChannelsDelta(TsChannelBase* tsChannel, uint16_t offset, uint16_t count, int lastSequence) {
+	if (offset + count > TS_TOTAL_OUTPUT_SIZE) {
+		efiPrintf("TS: Version Mismatch? Too much outputs requested offset=%d + count=%d/total=%d", offset, count,
+				TS_TOTAL_OUTPUT_SIZE);
+		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE, "cmd_size");
+		return;
+	}
+
+	if (offset < BLOCKING_FACTOR) {
+		engine->outputChannels.outputRequestPeriod = channelsRequestTimer.getElapsedUs();
+		channelsRequestTimer.reset();
+	}
+
+	tsState.outputChannelsCommandCounter++;
+	uint8_t * scratchBuffer = (uint8_t *)tsChannel->scratchBuffer;
+	LiveDataReader reader;
+
+	TsOutputDeltaShadow &shadow = tsChannel->outputDeltaShadow;
+
+	bool canDelta = shadow.count != 0 && shadow.offset == offset && shadow.count == count
+		&& shadow.sequence == lastSequence;
+
+	// delta frame has to be smaller than full frame to be worth it
+	TsOutputDeltaEncoder encoder(scratchBuffer + TS_OUTPUT_DELTA_HEADER_SIZE,
+		minI(count, sizeof(tsChannel->scratchBuffer) - TS_OUTPUT_DELTA_HEADER_SIZE));
+
+	if (canDelta) {
+		uint8_t part[64];
+		for (size_t position = 0; position < count; position += sizeof(part)) {
+			size_t chunkSize = minI(count - position, sizeof(part));
+			reader.copy(part, offset + position, chunkSize);
+			encoder.update(&shadow.image[position], part, chunkSize);
+		}
+	} else {
+		reader.copy(shadow.image, offset, count);
+	}
+
+	shadow.offset = offset;
+	shadow.count = count;
+	shadow.sequence++;
+
+	// runs are already in scratch buffer right after the header
+	bool isDelta = canDelta && !encoder.isOverflow();
+	scratchBuffer[0] = isDelta ? TS_OUTPUT_DELTA_CHANGES : TS_OUTPUT_DELTA_FULL;
+	scratchBuffer[1] = shadow.sequence;
+	size_t bodySize = isDelta ? encoder.size() : count;
+
+	uint32_t crc = tsChannel->writePacketHeader(TS_RESPONSE_OK, TS_OUTPUT_DELTA_HEADER_SIZE + bodySize);
+	crc = tsChannel->writePacketBody(scratchBuffer, TS_OUTPUT_DELTA_HEADER_SIZE + (isDelta ? bodySize : 0), crc);
+	if (!isDelta) {
+		crc = tsChannel->writePacketBody(shadow.image, count, crc);
+	}
+	tsChannel->writeCrcPacketTail(crc);
+}
+
+#endif // EFI_TS_OUTPUT_DELTA
+
 #endif // EFI_TUNER_STUDIO
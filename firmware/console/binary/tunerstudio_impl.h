@@ -26,6 +26,7 @@ public:
 	bool handlePlainCommand(TsChannelBase* tsChannel, uint8_t command);
 
 	void cmdOutputChannels(TsChannelBase* tsChannel, uint16_t offset, uint16_t count) override;
+	void cmdOutputChannelsDelta(TsChannelBase* tsChannel, uint16_t offset, uint16_t count, int lastSequence);
 	/**
 	 * this command is part of protocol initialization
 	 */
@@ -8,6 +8,7 @@
 #include "pch.h"
 
 #include "tunerstudio_io.h"
+#include "crc32_fast.h"
 
 #if EFI_SIMULATOR
 #include "rusEfiFunctionalTest.h"
@@ -47,7 +48,7 @@ void TsChannelBase::crcAndWriteBuffer(uint8_t responseCode, size_t size) {
 	scratchBuffer[2] = responseCode;
 
 	// CRC is computed on the responseCode and payload but not length
-	uint32_t crc = crc32(&scratchBuffer[2], size + 1); // command part of CRC
+	uint32_t crc = crc32Fast(&scratchBuffer[2], size + 1); // command part of CRC
 
 	// Place the CRC at the end
 	crc = SWAP_UINT32(crc);
@@ -66,7 +67,7 @@ uint32_t TsChannelBase::writePacketHeader(const uint8_t responseCode, const size
 	write(headerBuffer, sizeof(headerBuffer), /*isEndOfPacket*/false);
 
 	 // Command part of CRC
-	return crc32((void*)(headerBuffer + 2), 1);
+	return crc32Fast((void*)(headerBuffer + 2), 1);
 }
 
 void TsChannelBase::writeCrcPacketLarge(const uint8_t responseCode, const uint8_t* buf, const size_t size) {
@@ -75,7 +76,7 @@ void TsChannelBase::writeCrcPacketLarge(const uint8_t responseCode, const uint8_
 	// Command part of CRC
 	uint32_t crc = writePacketHeader(responseCode, size);
 	// Data part of CRC
-	crc = crc32inc((void*)buf, crc, size);
+	crc = crc32FastInc((void*)buf, crc, size);
 	*(uint32_t*)crcBuffer = SWAP_UINT32(crc);
 
 	// If data, write that
@@ -91,7 +92,7 @@ void TsChannelBase::writeCrcPacketLarge(const uint8_t responseCode, const uint8_
 uint32_t TsChannelBase::writePacketBody(const uint8_t* buf, const size_t size, uint32_t crc) {
 	if ((size) && (buf)) {
 		write(buf, size, /*isEndOfPacket*/false);
-		crc = crc32inc((void *)buf, crc, size);
+		crc = crc32FastInc((void *)buf, crc, size);
 	}
 
 	// return updated CRC
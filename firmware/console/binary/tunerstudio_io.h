@@ -27,6 +27,19 @@
 #define TS_PACKET_HEADER_SIZE	3
 #define TS_PACKET_TAIL_SIZE		4
 
+#if EFI_TS_OUTPUT_DELTA
+/**
+ * Last output channels image sent to a channel, delta frames are relative to it
+ */
+struct TsOutputDeltaShadow {
+	uint16_t offset = 0;
+	// zero means nothing was sent yet
+	uint16_t count = 0;
+	uint8_t sequence = 0;
+	uint8_t image[TS_TOTAL_OUTPUT_SIZE];
+};
+#endif // EFI_TS_OUTPUT_DELTA
+
 class TsChannelBase {
 public:
 	TsChannelBase(const char *name);
@@ -65,6 +78,10 @@ public:
 #if EFI_TS_SCATTER
 	page1_s page1;
 #endif
+#if EFI_TS_OUTPUT_DELTA
+	// owned by the thread serving this channel, so no locking
+	TsOutputDeltaShadow outputDeltaShadow;
+#endif // EFI_TS_OUTPUT_DELTA
 	const char *name;
 
 	void assertPacketSize(size_t size, bool allowLongPackets);
@@ -63,8 +63,17 @@
 #include "max3185x.h"
 #include "single_timer_executor.h"
 #include "periodic_task.h"
+#include "gpio/spi_batch.h"
 #endif /* EFI_PROD_CODE */
 
+#if EFI_OUTPUT_EDGE_LATENCY
+#include "edge_latency.h"
+#endif /* EFI_OUTPUT_EDGE_LATENCY */
+
+#if EFI_ENGINE_MODULE_TIMING
+#include "engine_module_timing.h"
+#endif /* EFI_ENGINE_MODULE_TIMING */
+
 #if EFI_CONFIGURATION_STORAGE
 #include "storage.h"
 #include "flash_main.h"
@@ -747,6 +756,18 @@ void updateTunerStudioState() {
 	tsOutputChannels->extiOverflowCount = getExtiOverflowCounter();
 #endif
 
+#if HAL_USE_SPI && EFI_PROD_CODE
+	reportSpiBatchToTS();
+#endif
+
+#if EFI_OUTPUT_EDGE_LATENCY
+	reportEdgeLatencyToTS();
+#endif /* EFI_OUTPUT_EDGE_LATENCY */
+
+#if EFI_ENGINE_MODULE_TIMING
+	reportEngineModuleTimingToTS();
+#endif /* EFI_ENGINE_MODULE_TIMING */
+
 	switch (engineConfiguration->debugMode)	{
 	case DBG_LOGIC_ANALYZER:
 #if EFI_LOGIC_ANALYZER
@@ -712,14 +712,11 @@ void EtbController::checkJam(percent_t setpoint, percent_t observation) {
 	}
 }
 
-#if !EFI_UNIT_TEST
 /**
- * Things running on a timer (instead of a thread) don't participate it the RTOS's thread priority system,
- * and operate essentially "first come first serve", which risks starvation.
- * Since ETB is a safety critical device, we need the hard RTOS guarantee that it will be scheduled over other less important tasks.
+ * ETB is updated from the main loop thread which has the highest priority,
+ * this way it gets the hard RTOS guarantee that it will be scheduled over other less important tasks.
  */
-#include "periodic_thread_controller.h"
-#endif // EFI_UNIT_TEST
+static_assert(ETB_LOOP_FREQUENCY == hzForPeriod(ETB_UPDATE_RATE));
 
 #include <utility>
 
@@ -740,24 +737,20 @@ void blinkEtbErrorCodes(bool blinkPhase) {
 	}
 }
 
-#if !EFI_UNIT_TEST
-
-struct DcThread final : public PeriodicController<512> {
-	DcThread() : PeriodicController("DC", PRIO_ETB, ETB_LOOP_FREQUENCY) {}
+static bool etbUpdateStarted = false;
 
-	void PeriodicTask(efitick_t) override {
-		// Simply update all controllers
-		for (int i = 0 ; i < ETB_COUNT; i++) {
-			auto controller = engine->etbControllers[i];
-			assertNotNullVoid(controller);
-			etbControllers[i]->update();
-		}
+void updateElectronicThrottle() {
+	if (!etbUpdateStarted) {
+		return;
 	}
-};
 
-static DcThread dcThread CCM_OPTIONAL;
-
-#endif // !EFI_UNIT_TEST
+	// Simply update all controllers
+	for (int i = 0 ; i < ETB_COUNT; i++) {
+		auto controller = engine->etbControllers[i];
+		assertNotNullVoid(controller);
+		etbControllers[i]->update();
+	}
+}
 
 #if EFI_UNIT_TEST
 void etbPidReset() {
@@ -952,11 +945,7 @@ void doInitElectronicThrottle(bool isStartupInit) {
 #endif /* EFI_UNIT_TEST */
 
 #if !EFI_UNIT_TEST
-	static bool started = false;
-	if (started == false) {
-		dcThread.start();
-		started = true;
-	}
+	etbUpdateStarted = true;
 #endif
 }
 
@@ -13,6 +13,8 @@
 
 void initElectronicThrottle();
 void doInitElectronicThrottle(bool isStartupInit);
+// invoked by main loop at ETB_UPDATE_RATE
+void updateElectronicThrottle();
 
 void setEtbIdlePosition(percent_t pos);
 void setEtbWastegatePosition(percent_t pos);
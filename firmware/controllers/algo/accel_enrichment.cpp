@@ -131,26 +131,14 @@ void TpsAccelEnrichment::onEngineCycleTps() {
 
 int TpsAccelEnrichment::getMaxDeltaIndex() {
 	int len = minI(cb.getSize(), cb.getCount());
-	tooShort = len < 2;
+	tooShort = len < 2 || maxDelta.isEmpty();
 	if (tooShort) {
 		return 0;
 	}
 	int ci = cb.currentIndex - 1;
-	float maxValue = cb.get(ci) - cb.get(ci - 1);
-	int resultIndex = ci;
 
-	// todo: 'get' method is maybe a bit heavy because of the branching
-	// todo: this could be optimized with some careful magic
-
-	for (int i = 1; i<len - 1;i++) {
-		float v = cb.get(ci - i) - cb.get(ci - i - 1);
-		if (v > maxValue) {
-			maxValue = v;
-			resultIndex = ci - i;
-		}
-	}
-
-	return resultIndex;
+	// delta which ends at the value maxDelta age values before the latest one
+	return ci - (int)maxDelta.getMaxAge();
 }
 
 float TpsAccelEnrichment::getMaxDelta() {
@@ -161,6 +149,7 @@ float TpsAccelEnrichment::getMaxDelta() {
 
 void TpsAccelEnrichment::resetAE() {
 	cb.clear();
+	maxDelta.clear();
 	resetFractionValues();
 }
 
@@ -174,11 +163,18 @@ void TpsAccelEnrichment::resetFractionValues() {
 
 void TpsAccelEnrichment::setLength(int length) {
 	cb.setSize(length);
+	// N values have N - 1 deltas between them
+	maxDelta.setWindow(cb.getSize() - 1);
 }
 
 void TpsAccelEnrichment::onNewValue(float currentValue) {
+	float previousValue = cb.get(cb.currentIndex - 1);
+
 	// Push new value in to the history buffer
 	cb.add(currentValue);
+	if (cb.getCount() > 1) {
+		maxDelta.add(currentValue - previousValue);
+	}
 
 	// Update deltas
 	int maxDeltaIndex = getMaxDeltaIndex();
@@ -208,7 +204,7 @@ bool TpsAccelEnrichment::isAccelEventTriggered() {
 
 TpsAccelEnrichment::TpsAccelEnrichment() {
 	resetAE();
-	cb.setSize(4);
+	setLength(4);
 }
 
 void TpsAccelEnrichment::onConfigurationChange(engine_configuration_s const* /*previousConfig*/) {
@@ -11,6 +11,7 @@
 
 #include "efitime.h"
 #include "cyclic_buffer.h"
+#include "sliding_window_max.h"
 #include "table_helper.h"
 #include "wall_fuel_state_generated.h"
 #include "tps_accel_state_generated.h"
@@ -37,6 +38,8 @@ public:
 
 	void setLength(int length);
 	cyclic_buffer<float> cb;
+	// consecutive differences of the values in cb, so the biggest one does not need a rescan
+	SlidingWindowMax<float, CB_MAX_SIZE> maxDelta;
 	void onNewValue(float currentValue);
 	int onUpdateInvocationCounter = 0;
 
@@ -20,6 +20,7 @@
 
 #include "aux_valves.h"
 #include "perf_trace.h"
+#include "crc32_fast.h"
 #include "backup_ram.h"
 #include "idle_thread.h"
 #include "idle_hardware.h"
@@ -27,6 +28,7 @@
 #include "speedometer.h"
 #include "dynoview.h"
 #include "boost_control.h"
+#include "engine_module_timing.h"
 #include "ac_control.h"
 #include "vr_pwm.h"
 #include "max3185x.h"
@@ -157,8 +159,18 @@ void boardPeriodicFastCallback() {
 }
 
 void Engine::periodicSlowCallback() {
+	periodicSlowCallbackPart(0, 1);
+}
+
+void Engine::periodicSlowCallbackPart(size_t part, size_t partCount) {
 	ScopePerf perf(PE::EnginePeriodicSlowCallback);
 
+	if (part > 0) {
+		// engine modules are spread over all parts but the first one
+		applyAllEngineModules(engine->engineModules, EngineModuleHook::SlowCallback, [](auto & m) { m.onSlowCallback(); }, part - 1, partCount - 1);
+		return;
+	}
+
 #if EFI_SHAFT_POSITION_INPUT
 	// Re-read config in case it's changed
 	triggerCentral.primaryTriggerConfiguration.update();
@@ -181,7 +193,9 @@ void Engine::periodicSlowCallback() {
 
 	updateGppwm();
 
-	engine->engineModules.apply_all([](auto & m) { m.onSlowCallback(); });
+	if (partCount == 1) {
+		applyAllEngineModules(engine->engineModules, EngineModuleHook::SlowCallback, [](auto & m) { m.onSlowCallback(); });
+	}
 
 #if (BOARD_TLE8888_COUNT > 0)
 	tle8888startup();
@@ -334,9 +348,9 @@ void Engine::preCalculate() {
 #if EFI_TUNER_STUDIO
 	// we take 2 bytes of crc32, no idea if it's right to call it crc16 or not
 	// we have a hack here - we rely on the fact that engineMake is the first of three relevant fields
-	engine->outputChannels.engineMakeCodeNameCrc16 = crc32(engineConfiguration->engineMake, 3 * VEHICLE_INFO_SIZE);
+	engine->outputChannels.engineMakeCodeNameCrc16 = crc32Fast(engineConfiguration->engineMake, 3 * VEHICLE_INFO_SIZE);
 
-	engine->outputChannels.tuneCrc16 = crc32(config, sizeof(persistent_config_s));
+	engine->outputChannels.tuneCrc16 = crc32Fast(config, sizeof(persistent_config_s));
 #endif /* EFI_TUNER_STUDIO */
 }
 
@@ -565,7 +579,7 @@ void Engine::periodicFastCallback() {
 
 	speedoUpdate();
 
-	engineModules.apply_all([](auto & m) { m.onFastCallback(); });
+	applyAllEngineModules(engineModules, EngineModuleHook::FastCallback, [](auto & m) { m.onFastCallback(); });
 }
 
 void Engine::onEngineStopped() {
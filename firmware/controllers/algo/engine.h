@@ -47,6 +47,7 @@
 #include "harley_acr.h"
 #include "dfco.h"
 #include "fuel_computer.h"
+#include "pwm_bank.h"
 #include "advance_map.h"
 #include "ignition_state.h"
 #include "sensor_checker.h"
@@ -292,6 +293,11 @@ public:
             = [](const IgnitionEvent&, efitick_t) -> void {};
 #endif // EFI_UNIT_TEST
 
+#if EFI_PWM_BANK
+    // slow software PWM channels on 'scheduler' share a single entry through this one
+    PwmBank pwmBank{};
+#endif // EFI_PWM_BANK
+
 #if EFI_ENGINE_CONTROL
     FuelSchedule injectionEvents{};
     IgnitionEventList ignitionEvents{};
@@ -334,6 +340,11 @@ public:
       * See SLOW_CALLBACK_PERIOD_MS
       */
   void periodicSlowCallback();
+    /**
+      * Part zero is engine level work, engine modules are split between parts one to partCount - 1
+      * so that main loop can run them on different ticks. Single part does everything.
+      */
+  void periodicSlowCallbackPart(size_t part, size_t partCount);
 	void onEngineStopped();
   void updateSlowSensors();
   void updateSwitchInputs();
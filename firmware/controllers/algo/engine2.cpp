@@ -17,6 +17,7 @@
 #include "closed_loop_fuel.h"
 #include "launch_control.h"
 #include "injector_model.h"
+#include "sensor_snapshot.h"
 #include "tunerstudio.h"
 
 #include "rusefi/efistring.h"
@@ -153,6 +154,8 @@ void EngineState::updateSparkSkip() {
 
 void EngineState::periodicFastCallback() {
 	ScopePerf perf(PE::EngineStatePeriodicFastCallback);
+	// all fuel/spark math below sees the same sensor readings
+	SensorSnapshotScope sensorSnapshot;
 
 #if EFI_SHAFT_POSITION_INPUT
 	if (!engine->slowCallBackWasInvoked) {
@@ -196,9 +199,11 @@ void EngineState::periodicFastCallback() {
 
 	auto clResult = engine->module<ShortTermFuelTrim>()->getCorrection(rpm, fuelLoad);
 
-	engine->module<LongTermFuelTrim>()->learn(clResult, rpm, fuelLoad);
+	// bin search once for both learning and correction
+	engine->module<LongTermFuelTrim>()->updateCell(rpm, fuelLoad);
+	engine->module<LongTermFuelTrim>()->learn(clResult);
 
-	auto ltftResult = engine->module<LongTermFuelTrim>()->getTrims(rpm, fuelLoad);
+	auto ltftResult = engine->module<LongTermFuelTrim>()->getTrims();
 
 	injectionStage2Fraction = getStage2InjectionFraction(rpm, engine->fuelComputer.afrTableYAxis);
 	float stage2InjectionMass = untrimmedInjectionMass * injectionStage2Fraction;
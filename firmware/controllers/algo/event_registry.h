@@ -12,6 +12,7 @@
 #include "scheduler.h"
 #include "fl_stack.h"
 #include "trigger_structure.h"
+#include "phase_event_ring.h"
 
 struct AngleBasedEvent {
 	scheduling_s eventScheduling;
@@ -101,6 +102,13 @@ public:
 	 */
 	IgnitionEvent elements[MAX_CYLINDER_COUNT];
 	bool isReady = false;
+
+	/**
+	 * Dwell angles by phase, cylinder index as id. With odd cylinder wasted spark each cylinder
+	 * also has its dwell + 360 entry, id offset by MAX_CYLINDER_COUNT.
+	 */
+	PhaseEventRing phaseOrder;
+	bool isPhaseOrderWithWastedSpark = false;
 };
 
 class AuxActor {
@@ -10,6 +10,7 @@
 #include "generated_lookup_engine_configuration.h"
 
 #include "rusefi/crc.h"
+#include "crc32_fast.h"
 
 // todo: ChibiOS has pretty similar functionality for persistent container, we probably should reuse it one day?
 struct persistent_config_container_s {
@@ -18,7 +19,8 @@ struct persistent_config_container_s {
 	persistent_config_s persistentConfiguration{};
 	uint32_t crc{};
 
+	// also called from critical sections and before OS start, so no CRC unit
 	uint32_t getCrc() {
-		return crc32(&persistentConfiguration, sizeof(persistent_config_s));
+		return crc32FastInc(&persistentConfiguration, 0, sizeof(persistent_config_s));
 	}
 };
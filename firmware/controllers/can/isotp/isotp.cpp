@@ -6,6 +6,7 @@
 #include "pch.h"
 #include "isotp.h"
 #include "can_rx.h"
+#include "crc32_fast.h"
 
 #if HAL_USE_CAN || EFI_UNIT_TEST
 
@@ -138,7 +139,7 @@ TODO: refactor into child class if we ever choose to revive this logic
 #if defined(TS_CAN_DEVICE_SHORT_PACKETS_IN_ONE_FRAME)
 	if (frameType == ISO_TP_FRAME_SINGLE) {
 		// restore the CRC on the whole packet
-		uint32_t crc = crc32((void *) srcBuf, numBytesAvailable);
+		uint32_t crc = crc32Fast((void *) srcBuf, numBytesAvailable);
 		// we need a separate buffer for crc because srcBuf may not be word-aligned for direct copy
 		uint8_t crcBuffer[sizeof(uint32_t)];
 		*(uint32_t *) (crcBuffer) = SWAP_UINT32(crc);
@@ -27,7 +27,9 @@ CONTROLLERS_SRC_CPP = \
 	$(CONTROLLERS_DIR)/gauges/malfunction_indicator.cpp \
 	$(CONTROLLERS_DIR)/system/timer/single_timer_executor.cpp \
 	$(CONTROLLERS_DIR)/system/timer/pwm_generator_logic.cpp \
+	$(CONTROLLERS_DIR)/system/timer/pwm_bank.cpp \
 	$(CONTROLLERS_DIR)/system/timer/event_queue.cpp \
+	$(CONTROLLERS_DIR)/system/timer/edge_latency.cpp \
 	$(CONTROLLERS_DIR)/settings.cpp \
 	$(CONTROLLERS_DIR)/core/error_handling.cpp \
 	$(CONTROLLERS_DIR)/engine_cycle/high_pressure_fuel_pump.cpp \
@@ -38,10 +40,12 @@ CONTROLLERS_SRC_CPP = \
 	$(CONTROLLERS_DIR)/engine_cycle/prime_injection.cpp \
 	$(CONTROLLERS_DIR)/engine_cycle/aux_valves.cpp \
 	$(CONTROLLERS_DIR)/engine_cycle/fuel_schedule.cpp \
+	$(CONTROLLERS_DIR)/engine_cycle/phase_event_ring.cpp \
 	$(CONTROLLERS_DIR)/engine_cycle/rotational_idle.cpp \
 	$(CONTROLLERS_DIR)/flash_main.cpp \
 	$(CONTROLLERS_DIR)/storage.cpp \
 	$(CONTROLLERS_DIR)/storage_flash.cpp \
+	$(CONTROLLERS_DIR)/flash_journal.cpp \
 	$(CONTROLLERS_DIR)/storage_mfs.cpp \
 	$(CONTROLLERS_DIR)/storage_sd.cpp \
 	$(CONTROLLERS_DIR)/bench_test.cpp \
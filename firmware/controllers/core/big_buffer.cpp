@@ -2,28 +2,92 @@
 
 #include "big_buffer.h"
 
-static BigBufferUser s_currentUser;
-// uint32_t type to get 4-byte alignment
+// uint64_t type to get 8-byte alignment
 // alignment is required since we sometimes allocate objects in the buffer (like Timer of CompositeBuffer)
 // we've only observed issue on F7 in -Os compiler configuration but technically all processors care
-static uint32_t s_bigBuffer[BIG_BUFFER_SIZE / sizeof(uint32_t)];
+static uint64_t s_bigBuffer[BIG_BUFFER_SIZE / sizeof(uint64_t)];
 
-#if EFI_UNIT_TEST
-BigBufferUser getBigBufferCurrentUser() {
-  return s_currentUser;
+static constexpr size_t blockAlignment = sizeof(uint64_t);
+
+static_assert(BIG_BUFFER_SIZE % blockAlignment == 0);
+static_assert(BIG_BUFFER_USER_COUNT == (size_t)BigBufferUser::KnockSpectrogram + 1);
+
+// indexed by BigBufferUser, size zero means not allocated
+static BigBufferReport::Block s_blocks[BIG_BUFFER_USER_COUNT];
+static size_t s_highWater = 0;
+static uint32_t s_failedRequests = 0;
+
+static uint8_t* arena() {
+	return reinterpret_cast<uint8_t*>(s_bigBuffer);
+}
+
+size_t getBigBufferQuota(BigBufferUser user) {
+	switch (user) {
+	case BigBufferUser::ToothLogger:
+		return BIG_BUFFER_QUOTA_TOOTH_LOGGER;
+	case BigBufferUser::PerfTrace:
+		return BIG_BUFFER_QUOTA_PERF_TRACE;
+	case BigBufferUser::TriggerScope:
+		return BIG_BUFFER_QUOTA_TRIGGER_SCOPE;
+	case BigBufferUser::KnockSpectrogram:
+		return BIG_BUFFER_SPECTROGRAM_SIZE;
+	default:
+		return 0;
+	}
+}
+
+static size_t getUsed() {
+	size_t used = 0;
+	for (size_t i = 0; i < BIG_BUFFER_USER_COUNT; i++) {
+		used += s_blocks[i].size;
+	}
+	return used;
+}
+
+/**
+ * Walks free gaps between allocated blocks in address order. With at most one block per user
+ * there are only a handful of them, no free list needed.
+ */
+template <typename TCallback>
+static void forEachFreeBlock(TCallback callback) {
+	size_t position = 0;
+
+	while (position < BIG_BUFFER_SIZE) {
+		// closest block at or after position
+		size_t nextStart = BIG_BUFFER_SIZE;
+		size_t nextEnd = BIG_BUFFER_SIZE;
+		for (size_t i = 0; i < BIG_BUFFER_USER_COUNT; i++) {
+			const auto& block = s_blocks[i];
+			if (block.size && block.offset >= position && block.offset < nextStart) {
+				nextStart = block.offset;
+				nextEnd = block.offset + block.size;
+			}
+		}
+
+		if (nextStart > position) {
+			callback(position, nextStart - position);
+		}
+
+		position = nextEnd;
+	}
 }
-#endif // EFI_UNIT_TEST
 
 static void releaseBuffer(void* bufferPtr, BigBufferUser user) {
-	if (bufferPtr != &s_bigBuffer || user != s_currentUser) {
-		// todo: panic!
+	chibios_rt::CriticalSectionLocker csl;
+
+	auto& block = s_blocks[(size_t)user];
+	if (!block.size || bufferPtr != arena() + block.offset) {
+		criticalError("Big buffer release mismatch %d", (int)user);
+		return;
 	}
 
-	s_currentUser = BigBufferUser::None;
+	block.size = 0;
+	block.offset = 0;
 }
 
-BigBufferHandle::BigBufferHandle(void* buffer, BigBufferUser user)
+BigBufferHandle::BigBufferHandle(void* buffer, size_t size, BigBufferUser user)
 	: m_bufferPtr(buffer)
+	, m_size(size)
 	, m_user(user)
 {
 }
@@ -33,6 +97,9 @@ BigBufferHandle::BigBufferHandle(BigBufferHandle&& other) {
 	m_bufferPtr = other.m_bufferPtr;
 	other.m_bufferPtr = nullptr;
 
+	m_size = other.m_size;
+	other.m_size = 0;
+
 	m_user = other.m_user;
 	other.m_user = BigBufferUser::None;
 }
@@ -46,6 +113,9 @@ BigBufferHandle& BigBufferHandle::operator= (BigBufferHandle&& other) {
 		m_bufferPtr = other.m_bufferPtr;
 		other.m_bufferPtr = nullptr;
 
+		m_size = other.m_size;
+		other.m_size = 0;
+
 		m_user = other.m_user;
 		other.m_user = BigBufferUser::None;
 	}
@@ -58,13 +128,82 @@ BigBufferHandle::~BigBufferHandle() {
 	}
 }
 
-BigBufferHandle getBigBuffer(BigBufferUser user) {
-	if (s_currentUser != BigBufferUser::None) {
-		// fatal
+BigBufferHandle getBigBuffer(BigBufferUser user, size_t minSize) {
+	chibios_rt::CriticalSectionLocker csl;
+
+	// round down, so that next block stays aligned
+	size_t quota = getBigBufferQuota(user) & ~(blockAlignment - 1);
+
+	auto& block = s_blocks[(size_t)user];
+	if (quota == 0 || block.size) {
+		s_failedRequests++;
 		return {};
 	}
 
-	s_currentUser = user;
+	// smallest free block which fits the whole quota, otherwise the largest one
+	size_t bestOffset = 0;
+	size_t bestSize = 0;
+	forEachFreeBlock([&](size_t offset, size_t size) {
+		bool fits = size >= quota;
+		bool bestFits = bestSize >= quota;
+		if ((fits && (!bestFits || size < bestSize)) || (!bestFits && size > bestSize)) {
+			bestOffset = offset;
+			bestSize = size;
+		}
+	});
+
+	size_t size = std::min(bestSize, quota);
+	if (size == 0 || size < minSize) {
+		s_failedRequests++;
+		return {};
+	}
+
+	block.offset = bestOffset;
+	block.size = size;
+
+	s_highWater = std::max(s_highWater, getUsed());
+
+	return BigBufferHandle(arena() + bestOffset, size, user);
+}
+
+BigBufferReport getBigBufferReport() {
+	chibios_rt::CriticalSectionLocker csl;
+
+	BigBufferReport report;
+	report.used = getUsed();
+	report.highWater = s_highWater;
+	report.failedRequests = s_failedRequests;
+
+	report.largestFree = 0;
+	forEachFreeBlock([&](size_t, size_t size) {
+		report.largestFree = std::max(report.largestFree, size);
+	});
+
+	for (size_t i = 0; i < BIG_BUFFER_USER_COUNT; i++) {
+		report.users[i] = s_blocks[i];
+	}
+
+	return report;
+}
+
+static void printBigBuffer() {
+	static const char* const names[BIG_BUFFER_USER_COUNT] = { "none", "tooth logger", "perf trace", "trigger scope", "knock spectrogram" };
+
+	BigBufferReport report = getBigBufferReport();
+
+	efiPrintf("big buffer: %d of %d bytes used, high water %d, largest free %d, %d failed requests",
+		(int)report.used, BIG_BUFFER_SIZE, (int)report.highWater, (int)report.largestFree, (int)report.failedRequests);
+
+	for (size_t i = 1; i < BIG_BUFFER_USER_COUNT; i++) {
+		const auto& block = report.users[i];
+		if (block.size) {
+			efiPrintf("  %s: %d bytes at %d, quota %d", names[i], (int)block.size, (int)block.offset, (int)getBigBufferQuota((BigBufferUser)i));
+		} else {
+			efiPrintf("  %s: none, quota %d", names[i], (int)getBigBufferQuota((BigBufferUser)i));
+		}
+	}
+}
 
-	return BigBufferHandle(s_bigBuffer, user);
+void initBigBuffer() {
+	addConsoleAction("bigbuffer", printBigBuffer);
 }
@@ -1,24 +1,46 @@
-// This file handles the "big buffer" - a shared buffer that can be used by multiple users depending on which function is enabled
+// This file handles the "big buffer" - a shared arena that is split between users depending on which functions are enabled
 
 #pragma once
 
+// knock spectrogram FFT work area lives in the big buffer, see SpectrogramData
+#define BIG_BUFFER_SPECTROGRAM_SIZE (12 * 1024)
+
 #ifndef BIG_BUFFER_SIZE
+#ifdef KNOCK_SPECTROGRAM
+#define BIG_BUFFER_SIZE (8192 + BIG_BUFFER_SPECTROGRAM_SIZE)
+#else
 #define BIG_BUFFER_SIZE 8192
 #endif
+#endif
+
+// maximum bytes each user gets, so that tooth logger and trigger scope can run at the same time
+#ifndef BIG_BUFFER_QUOTA_TOOTH_LOGGER
+#define BIG_BUFFER_QUOTA_TOOTH_LOGGER 4096
+#endif
+
+// perf trace takes whatever the other diagnostics leave
+#ifndef BIG_BUFFER_QUOTA_PERF_TRACE
+#define BIG_BUFFER_QUOTA_PERF_TRACE BIG_BUFFER_SIZE
+#endif
+
+#ifndef BIG_BUFFER_QUOTA_TRIGGER_SCOPE
+#define BIG_BUFFER_QUOTA_TRIGGER_SCOPE 4096
+#endif
 
 enum class BigBufferUser {
 	None,
 	ToothLogger,
 	PerfTrace,
 	TriggerScope,
-	// todo: actually start using this!
 	KnockSpectrogram,
 };
 
+#define BIG_BUFFER_USER_COUNT 5
+
 class BigBufferHandle {
 public:
 	BigBufferHandle() = default;
-	BigBufferHandle(void* buffer, BigBufferUser user);
+	BigBufferHandle(void* buffer, size_t size, BigBufferUser user);
 	~BigBufferHandle();
 
 	// But allow moving (passing ownership of the buffer)
@@ -41,12 +63,39 @@ public:
 	}
 
 	size_t size() const {
-		return BIG_BUFFER_SIZE;
+		return m_size;
 	}
 
 private:
 	void* m_bufferPtr = nullptr;
+	size_t m_size = 0;
 	BigBufferUser m_user = BigBufferUser::None;
 };
 
-BigBufferHandle getBigBuffer(BigBufferUser user);
+/**
+ * Allocates as much as user quota allows, from a single free block.
+ * Returns empty handle if the user already holds a block or less than minSize bytes are free.
+ * Space goes back to the arena once the handle is destroyed or reassigned.
+ */
+BigBufferHandle getBigBuffer(BigBufferUser user, size_t minSize = 1);
+
+size_t getBigBufferQuota(BigBufferUser user);
+
+struct BigBufferReport {
+	struct Block {
+		uint32_t offset;
+		// zero if not allocated
+		uint32_t size;
+	};
+
+	size_t used;
+	size_t highWater;
+	size_t largestFree;
+	uint32_t failedRequests;
+	Block users[BIG_BUFFER_USER_COUNT];
+};
+
+BigBufferReport getBigBufferReport();
+
+// "bigbuffer" console command
+void initBigBuffer();
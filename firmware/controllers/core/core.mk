@@ -3,3 +3,4 @@ CONTROLLERS_CORE_SRC_CPP = \
 	$(PROJECT_DIR)/controllers/core/main_loop.cpp \
 	$(PROJECT_DIR)/controllers/core/state_sequence.cpp \
 	$(PROJECT_DIR)/controllers/core/big_buffer.cpp \
+	$(PROJECT_DIR)/controllers/core/engine_module_timing.cpp \
@@ -0,0 +1,159 @@
+/**
+ * @file engine_module_timing.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "engine_module_timing.h"
+
+static constexpr size_t moduleCount = decltype(Engine::engineModules)::count();
+
+void EngineModuleTiming::record(uint32_t duration) {
+	if (calls == 0) {
+		average = duration;
+	} else {
+		average += (duration - average) / 32;
+	}
+
+	calls++;
+	last = duration;
+	max = std::max(max, duration);
+	total += duration;
+}
+
+void EngineModuleTiming::reset() {
+	calls = 0;
+	last = 0;
+	max = 0;
+	average = 0;
+	total = 0;
+}
+
+float getEngineModuleTimingCountsPerUs() {
+#if EFI_PROD_CODE
+	return CORE_CLOCK / 1e6f;
+#else
+	return US_TO_NT_MULTIPLIER;
+#endif
+}
+
+void getEngineModuleName(const char *prettyName, char *buffer, size_t size) {
+	// GCC: "const char* getEngineModuleTypeName() [with TModule = BoostController]"
+	const char *name = prettyName ? strstr(prettyName, "= ") : nullptr;
+	name = name ? name + 2 : "?";
+
+	size_t length = 0;
+	while (length + 1 < size && name[length] && name[length] != ']' && name[length] != ';') {
+		buffer[length] = name[length];
+		length++;
+	}
+	buffer[length] = 0;
+}
+
+#if EFI_ENGINE_MODULE_TIMING
+
+static EngineModuleTiming timings[ENGINE_MODULE_HOOK_COUNT][moduleCount];
+
+static const char* const hookNames[ENGINE_MODULE_HOOK_COUNT] = { "fast", "slow", "engine phase" };
+
+uint32_t getEngineModuleTimingCounter() {
+#if EFI_PROD_CODE
+	// CPU cycles
+	return port_rt_get_counter_value();
+#else
+	return (uint32_t)getTimeNowNt();
+#endif
+}
+
+void engineModuleTimingRecord(EngineModuleHook hook, size_t index, const char *prettyName, uint32_t duration) {
+	if (index >= moduleCount) {
+		return;
+	}
+
+	EngineModuleTiming &timing = timings[(size_t)hook][index];
+	timing.prettyName = prettyName;
+	timing.record(duration);
+}
+
+size_t getEngineModuleTimingCount() {
+	return moduleCount;
+}
+
+const EngineModuleTiming* getEngineModuleTiming(EngineModuleHook hook, size_t index) {
+	if ((size_t)hook >= ENGINE_MODULE_HOOK_COUNT || index >= moduleCount) {
+		return nullptr;
+	}
+
+	return &timings[(size_t)hook][index];
+}
+
+void resetEngineModuleTiming() {
+	for (size_t hook = 0; hook < ENGINE_MODULE_HOOK_COUNT; hook++) {
+		for (size_t i = 0; i < moduleCount; i++) {
+			timings[hook][i].reset();
+		}
+	}
+}
+
+static float getTotalAverageUs(EngineModuleHook hook) {
+	float sum = 0;
+	for (size_t i = 0; i < moduleCount; i++) {
+		sum += timings[(size_t)hook][i].average;
+	}
+	return sum / getEngineModuleTimingCountsPerUs();
+}
+
+void reportEngineModuleTimingToTS() {
+#if EFI_TUNER_STUDIO
+	const auto &fast = timings[(size_t)EngineModuleHook::FastCallback];
+
+	size_t heaviest = 0;
+	for (size_t i = 1; i < moduleCount; i++) {
+		if (fast[i].average > fast[heaviest].average) {
+			heaviest = i;
+		}
+	}
+
+	float countsPerUs = getEngineModuleTimingCountsPerUs();
+
+	engine->outputChannels.engineModulesFastUs = getTotalAverageUs(EngineModuleHook::FastCallback);
+	engine->outputChannels.engineModulesHeaviestFastUs = fast[heaviest].average / countsPerUs;
+	engine->outputChannels.engineModulesHeaviestFastMaxUs = fast[heaviest].max / countsPerUs;
+	engine->outputChannels.engineModulesHeaviestFastIndex = heaviest;
+	engine->outputChannels.engineModulesSlowUs = getTotalAverageUs(EngineModuleHook::SlowCallback);
+	engine->outputChannels.engineModulesPhaseUs = getTotalAverageUs(EngineModuleHook::EnginePhase);
+#endif /* EFI_TUNER_STUDIO */
+}
+
+static void printEngineModuleTiming() {
+	float countsPerUs = getEngineModuleTimingCountsPerUs();
+
+	for (size_t hook = 0; hook < ENGINE_MODULE_HOOK_COUNT; hook++) {
+		float totalUs = getTotalAverageUs((EngineModuleHook)hook);
+		efiPrintf("%s: %.2f us per call of all modules", hookNames[hook], totalUs);
+
+		for (size_t i = 0; i < moduleCount; i++) {
+			const EngineModuleTiming &timing = timings[hook][i];
+			if (timing.calls == 0) {
+				continue;
+			}
+
+			char name[40];
+			getEngineModuleName(timing.prettyName, name, sizeof(name));
+
+			float averageUs = timing.average / countsPerUs;
+			efiPrintf("  %d %s: avg %.2f max %.2f us, %.1f%%, %d calls",
+				(int)i, name, averageUs, timing.max / countsPerUs,
+				totalUs > 0 ? 100 * averageUs / totalUs : 0, (int)timing.calls);
+		}
+	}
+}
+
+void initEngineModuleTiming() {
+	addConsoleAction("moduletiming", printEngineModuleTiming);
+	addConsoleAction("reset_moduletiming", resetEngineModuleTiming);
+}
+
+#endif // EFI_ENGINE_MODULE_TIMING
@@ -0,0 +1,90 @@
+/**
+ * @file engine_module_timing.h
+ * @brief CPU time spent by each EngineModule in periodic hooks
+ *
+ * With EFI_ENGINE_MODULE_TIMING every module call made through applyAllEngineModules is timed,
+ * CPU cycles on real hardware, NT ticks elsewhere.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+enum class EngineModuleHook : uint8_t {
+	FastCallback,
+	SlowCallback,
+	EnginePhase,
+};
+
+#define ENGINE_MODULE_HOOK_COUNT 3
+
+struct EngineModuleTiming {
+	void record(uint32_t duration);
+	void reset();
+
+	// __PRETTY_FUNCTION__ of getEngineModuleTypeName, see getEngineModuleName
+	const char *prettyName;
+	uint32_t calls;
+	uint32_t last;
+	uint32_t max;
+	// exponential, about last 32 calls
+	float average;
+	uint64_t total;
+};
+
+// counts per microsecond of durations recorded by EngineModuleTiming
+float getEngineModuleTimingCountsPerUs();
+
+#if EFI_ENGINE_MODULE_TIMING
+
+uint32_t getEngineModuleTimingCounter();
+void engineModuleTimingRecord(EngineModuleHook hook, size_t index, const char *prettyName, uint32_t duration);
+
+template<typename TModule>
+const char *getEngineModuleTypeName() {
+	return __PRETTY_FUNCTION__;
+}
+
+#endif // EFI_ENGINE_MODULE_TIMING
+
+/**
+ * engineModules.apply_all which times each module when EFI_ENGINE_MODULE_TIMING is enabled
+ *
+ * With sliceCount above one only every sliceCount-th module starting with slice is invoked,
+ * that is how slow callback work is spread across main loop ticks.
+ */
+template<typename TModules, typename TFunc>
+void applyAllEngineModules(TModules& modules, EngineModuleHook hook, const TFunc& f, size_t slice = 0, size_t sliceCount = 1) {
+	size_t index = 0;
+	modules.apply_all([&](auto& m) {
+		size_t moduleIndex = index++;
+		if (moduleIndex % sliceCount != slice) {
+			return;
+		}
+
+#if EFI_ENGINE_MODULE_TIMING
+		uint32_t start = getEngineModuleTimingCounter();
+		f(m);
+		uint32_t duration = getEngineModuleTimingCounter() - start;
+
+		using module_t = std::remove_cv_t<std::remove_reference_t<decltype(m)>>;
+		engineModuleTimingRecord(hook, moduleIndex, getEngineModuleTypeName<module_t>(), duration);
+#else
+		UNUSED(hook);
+		f(m);
+#endif // EFI_ENGINE_MODULE_TIMING
+	});
+}
+
+size_t getEngineModuleTimingCount();
+// nullptr if out of range
+const EngineModuleTiming* getEngineModuleTiming(EngineModuleHook hook, size_t index);
+void resetEngineModuleTiming();
+
+// extracts module type name out of EngineModuleTiming::prettyName
+void getEngineModuleName(const char *prettyName, char *buffer, size_t size);
+
+// total and heaviest module time per hook into engineModules* output channels
+void reportEngineModuleTimingToTS();
+
+void initEngineModuleTiming();
@@ -6,9 +6,126 @@
 #include "thread_priority.h"
 #include "main_loop.h"
 #include "main_loop_controller.h"
+#include "electronic_throttle.h"
+
+// engine level work, then engine modules in two halves
+#define SLOW_CALLBACK_PARTS 3
+
+size_t RateGroupStats::getBin(efidur_t durationNt) {
+	if (durationNt < US2NT(1)) {
+		return 0;
+	}
+
+	uint32_t us = (durationNt > US2NT(1 << RATE_GROUP_HISTOGRAM_BINS)) ? (1 << RATE_GROUP_HISTOGRAM_BINS) : NT2US(durationNt);
+	// index of the highest set bit, plus one
+	size_t bin = 32 - __builtin_clz(us);
+	return std::min(bin, (size_t)RATE_GROUP_HISTOGRAM_BINS - 1);
+}
+
+static void addToHistogram(uint16_t *histogram, efidur_t durationNt) {
+	uint16_t &bin = histogram[RateGroupStats::getBin(durationNt)];
+	if (bin != UINT16_MAX) {
+		bin++;
+	}
+}
+
+RateGroup::RateGroup(const char *name, LoopPeriod period, task_t task, uint8_t partCount, float deadlineMs)
+	: m_name(name)
+	, m_period(period)
+	, m_task(task)
+	// every part needs its own tick within the period
+	, m_partCount(clampI(1, partCount, MAIN_LOOP_RATE / hzForPeriod(period)))
+	, m_deadlineNt(MS2NT(deadlineMs > 0 ? deadlineMs : loopPeriodMs(period)))
+{
+}
+
+void RateGroup::onTick(LoopPeriod flags, efitick_t nowNt) {
+	if (flags & m_period) {
+		if (m_pending) {
+			// previous release did not get all its parts in, start over
+			m_stats.overruns++;
+		}
+
+		if (m_hasReleased) {
+			efidur_t intervalNt = nowNt - m_releaseNt;
+			efidur_t jitterNt = std::abs(intervalNt - (efidur_t)MS2NT(loopPeriodMs(m_period)));
+			m_stats.maxJitterNt = std::max<uint32_t>(m_stats.maxJitterNt, jitterNt);
+			addToHistogram(m_stats.jitterHistogram, jitterNt);
+		}
+
+		m_hasReleased = true;
+		m_releaseNt = nowNt;
+		m_pending = true;
+		m_nextPart = 0;
+		m_execNt = 0;
+		m_stats.releases++;
+	}
+
+	if (!m_pending) {
+		return;
+	}
+
+	efitick_t startNt = getTimeNowNt();
+	m_task(nowNt, m_nextPart);
+	efitick_t endNt = getTimeNowNt();
+
+	m_execNt += endNt - startNt;
+	m_nextPart++;
+
+	if (m_nextPart < m_partCount) {
+		return;
+	}
+
+	m_pending = false;
+
+	m_stats.lastExecNt = m_execNt;
+	m_stats.maxExecNt = std::max<uint32_t>(m_stats.maxExecNt, m_execNt);
+	addToHistogram(m_stats.execHistogram, m_execNt);
+
+	if (endNt - m_releaseNt > m_deadlineNt) {
+		m_stats.overruns++;
+	}
+}
+
+void RateGroup::resetStats() {
+	m_stats = {};
+}
+
+static void adcTask(efitick_t nowNt, uint8_t) {
+#if HAL_USE_ADC
+	adcInputsUpdateSubscribers(nowNt);
+#else
+	UNUSED(nowNt);
+#endif // HAL_USE_ADC
+}
+
+static void etbTask(efitick_t, uint8_t) {
+#if EFI_ELECTRONIC_THROTTLE_BODY
+	updateElectronicThrottle();
+#endif // EFI_ELECTRONIC_THROTTLE_BODY
+}
+
+static void fastCallbackTask(efitick_t, uint8_t) {
+	engine->periodicFastCallback();
+}
+
+static void slowCallbackTask(efitick_t, uint8_t part) {
+#if EFI_UNIT_TEST
+	engine->periodicSlowCallbackPart(part, SLOW_CALLBACK_PARTS);
+#else
+	doPeriodicSlowCallback(part, SLOW_CALLBACK_PARTS);
+#endif
+}
 
 MainLoop::MainLoop()
 	: PeriodicController("MainLoop", PRIO_MAIN_LOOP, MAIN_LOOP_RATE)
+	, m_groups{
+		// ETB consumes sensor values published by ADC in the same tick
+		RateGroup("adc", ADC_UPDATE_RATE, adcTask),
+		RateGroup("etb", ETB_UPDATE_RATE, etbTask),
+		RateGroup("fast", FAST_CALLBACK_RATE, fastCallbackTask),
+		RateGroup("slow", SLOW_CALLBACK_RATE, slowCallbackTask, SLOW_CALLBACK_PARTS),
+	}
 {
 }
 
@@ -43,32 +160,45 @@ void MainLoop::PeriodicTask(efitick_t nowNt) {
 
 	LoopPeriod currentLoopPeriod = makePeriodFlags();
 
-#if HAL_USE_ADC
-	if (currentLoopPeriod & ADC_UPDATE_RATE) {
-		adcInputsUpdateSubscribers(nowNt);
+	for (size_t i = 0; i < efi::size(m_groups); i++) {
+		m_groups[i].onTick(currentLoopPeriod, nowNt);
 	}
-#else
- UNUSED(nowNt);
-#endif // HAL_USE_ADC
+}
 
-#if EFI_ELECTRONIC_THROTTLE_BODY
-	if (currentLoopPeriod & ETB_UPDATE_RATE) {
-		// TODO: main_loop etb callback
-	}
-#endif // EFI_ELECTRONIC_THROTTLE_BODY
+void MainLoop::printStats() const {
+	for (size_t i = 0; i < efi::size(m_groups); i++) {
+		const RateGroup &group = m_groups[i];
+		const RateGroupStats &stats = group.getStats();
+
+		efiPrintf("%s %dHz: %d runs, %d overruns, exec last %d max %d us, jitter max %d us",
+			group.getName(), hzForPeriod(group.getPeriod()), (int)stats.releases, (int)stats.overruns,
+			(int)NT2US(stats.lastExecNt), (int)NT2US(stats.maxExecNt), (int)NT2US(stats.maxJitterNt));
 
-	if (currentLoopPeriod & SLOW_CALLBACK_RATE) {
-		//TODO: main_loop slow callback
+		static_assert(RATE_GROUP_HISTOGRAM_BINS == 12);
+		for (const uint16_t *histogram : { stats.execHistogram, stats.jitterHistogram }) {
+			efiPrintf("  %s <1us %d, <2 %d, <4 %d, <8 %d, <16 %d, <32 %d, <64 %d, <128 %d, <256 %d, <512 %d, <1024 %d, more %d",
+				histogram == stats.execHistogram ? "exec" : "jitter",
+				histogram[0], histogram[1], histogram[2], histogram[3],
+				histogram[4], histogram[5], histogram[6], histogram[7],
+				histogram[8], histogram[9], histogram[10], histogram[11]);
+		}
 	}
+}
+
+void MainLoop::resetStats() {
+	chibios_rt::CriticalSectionLocker csl;
 
-	if (currentLoopPeriod & FAST_CALLBACK_RATE) {
-	   //TODO: main_loop fast callback
+	for (size_t i = 0; i < efi::size(m_groups); i++) {
+		m_groups[i].resetStats();
 	}
 }
 
 void initMainLoop() {
 	// see test_periodic_thread_controller.cpp for explanation
 #if ! EFI_UNIT_TEST
+	addConsoleAction("mainloop", [] { mainLoop.printStats(); });
+	addConsoleAction("reset_mainloop", [] { mainLoop.resetStats(); });
+
 	mainLoop.start();
 #endif
 }
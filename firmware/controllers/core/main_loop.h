@@ -18,6 +18,10 @@ inline constexpr LoopPeriod& operator|=(LoopPeriod& a, const LoopPeriod& b) {
 	return a;
 }
 
+inline constexpr LoopPeriod operator|(LoopPeriod a, LoopPeriod b) {
+	return static_cast<LoopPeriod>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
 inline constexpr bool operator&(LoopPeriod a, LoopPeriod b) {
 	return 0 != (static_cast<uint8_t>(a) & static_cast<uint8_t>(b));
 }
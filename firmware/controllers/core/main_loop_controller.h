@@ -18,11 +18,83 @@ static constexpr int loopCounts() {
     return MAIN_LOOP_RATE / hz;
 }
 
-class MainLoop : public PeriodicController<1024> {
+// bin 0 is under 1us, bin N is [2^(N-1), 2^N) us, last bin collects everything above
+#define RATE_GROUP_HISTOGRAM_BINS 12
+
+struct RateGroupStats {
+    uint32_t releases;
+    // finished after the deadline, or released again before all parts ran
+    uint32_t overruns;
+    uint32_t lastExecNt;
+    uint32_t maxExecNt;
+    // difference between actual and nominal time between two releases
+    uint32_t maxJitterNt;
+    // saturating
+    uint16_t execHistogram[RATE_GROUP_HISTOGRAM_BINS];
+    uint16_t jitterHistogram[RATE_GROUP_HISTOGRAM_BINS];
+
+    static size_t getBin(efidur_t durationNt);
+};
+
+/**
+ * Work which runs at one of LoopPeriod rates. Work can be split into parts, one part runs per main loop tick
+ * starting with the tick the group is released on, so a slow group does not land on top of faster ones all at once.
+ */
+class RateGroup {
+public:
+    using task_t = void (*)(efitick_t nowNt, uint8_t part);
+
+    // zero deadline means whole period
+    RateGroup(const char *name, LoopPeriod period, task_t task, uint8_t partCount = 1, float deadlineMs = 0);
+
+    void onTick(LoopPeriod flags, efitick_t nowNt);
+    void resetStats();
+
+    const char* getName() const {
+        return m_name;
+    }
+
+    LoopPeriod getPeriod() const {
+        return m_period;
+    }
+
+    const RateGroupStats& getStats() const {
+        return m_stats;
+    }
+
+private:
+    const char* const m_name;
+    const LoopPeriod m_period;
+    const task_t m_task;
+    const uint8_t m_partCount;
+    const efidur_t m_deadlineNt;
+
+    bool m_pending = false;
+    uint8_t m_nextPart = 0;
+    efitick_t m_releaseNt = 0;
+    bool m_hasReleased = false;
+    efidur_t m_execNt = 0;
+
+    RateGroupStats m_stats{};
+};
+
+#define MAIN_LOOP_GROUP_COUNT 4
+
+// fast and slow callbacks used to run in timer interrupt on main stack, see USE_EXCEPTIONS_STACKSIZE
+#define MAIN_LOOP_STACK_SIZE 4096
+
+class MainLoop : public PeriodicController<MAIN_LOOP_STACK_SIZE> {
 public:
     MainLoop();
     void PeriodicTask(efitick_t nowNt) override;
 
+    RateGroup& getGroup(size_t index) {
+        return m_groups[index];
+    }
+
+    void printStats() const;
+    void resetStats();
+
 #if ! EFI_UNIT_TEST
 private:
 #endif
@@ -33,6 +105,9 @@ private:
     LoopPeriod makePeriodFlags();
 
     int m_cycleCounter = 0;
+
+    // highest rate first, that is rate monotonic priority within a tick
+    RateGroup m_groups[MAIN_LOOP_GROUP_COUNT];
 };
 
-static MainLoop mainLoop CCM_OPTIONAL;
\ No newline at end of file
+static MainLoop mainLoop CCM_OPTIONAL;
@@ -58,6 +58,8 @@
 #include "start_stop.h"
 #include "dynoview.h"
 #include "vr_pwm.h"
+#include "edge_latency.h"
+#include "engine_module_timing.h"
 #include "adc_subscription.h"
 #include "gc_generic.h"
 
@@ -115,32 +117,6 @@ void initDataStructures() {
 
 #if !EFI_UNIT_TEST
 
-static void doPeriodicSlowCallback();
-
-class PeriodicFastController : public PeriodicTimerController {
-	void PeriodicTask() override {
-		engine->periodicFastCallback();
-	}
-
-	int getPeriodMs() override {
-		return FAST_CALLBACK_PERIOD_MS;
-	}
-};
-
-class PeriodicSlowController : public PeriodicTimerController {
-	void PeriodicTask() override {
-		doPeriodicSlowCallback();
-	}
-
-	int getPeriodMs() override {
-		// no reason to have this configurable, looks like everyone is happy with 20Hz
-		return SLOW_CALLBACK_PERIOD_MS;
-	}
-};
-
-static PeriodicFastController fastController;
-static PeriodicSlowController slowController;
-
 class EngineStateBlinkingTask : public PeriodicTimerController {
 	int getPeriodMs() override {
 		return 50;
@@ -176,7 +152,12 @@ static void resetAccel() {
 #endif // EFI_ENGINE_CONTROL
 }
 
-static void doPeriodicSlowCallback() {
+void doPeriodicSlowCallback(size_t part, size_t partCount) {
+	if (part > 0) {
+		engine->periodicSlowCallbackPart(part, partCount);
+		return;
+	}
+
 #if EFI_SHAFT_POSITION_INPUT
 	efiAssertVoid(ObdCode::CUSTOM_ERR_6661, getCurrentRemainingStack() > 64, "lowStckOnEv");
 
@@ -188,7 +169,7 @@ static void doPeriodicSlowCallback() {
 	}
 #endif /* EFI_SHAFT_POSITION_INPUT */
 
-	engine->periodicSlowCallback();
+	engine->periodicSlowCallbackPart(part, partCount);
 
 #if EFI_TCU
 	if (engineConfiguration->tcuEnabled && engineConfiguration->gearControllerMode != GearControllerMode::None) {
@@ -204,11 +185,6 @@ static void doPeriodicSlowCallback() {
 	tryResetWatchdog();
 }
 
-void initPeriodicEvents() {
-	slowController.start();
-	fastController.start();
-}
-
 char * getPinNameByAdcChannel(const char *msg, adc_channel_e hwChannel, char *buffer, size_t bufferSize) {
 #if HAL_USE_ADC
 	if (!isAdcChannelValid(hwChannel)) {
@@ -422,6 +398,18 @@ void commonInitEngineController() {
 	initBenchTest();
 #endif /* ! EFI_UNIT_TEST && EFI_ENGINE_CONTROL */
 
+#if ! EFI_UNIT_TEST && EFI_OUTPUT_EDGE_LATENCY
+	initEdgeLatency();
+#endif /* ! EFI_UNIT_TEST && EFI_OUTPUT_EDGE_LATENCY */
+
+#if ! EFI_UNIT_TEST
+	initBigBuffer();
+#endif /* ! EFI_UNIT_TEST */
+
+#if ! EFI_UNIT_TEST && EFI_ENGINE_MODULE_TIMING
+	initEngineModuleTiming();
+#endif /* ! EFI_UNIT_TEST && EFI_ENGINE_MODULE_TIMING */
+
 #if EFI_ALTERNATOR_CONTROL
 	initAlternatorCtrl();
 #endif /* EFI_ALTERNATOR_CONTROL */
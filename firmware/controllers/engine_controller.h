@@ -12,7 +12,10 @@
 bool validateConfigOnStartUpOrBurn();
 bool validateConfigOnStartUpOrBurn(bool isRunningOnBurn);
 char * getPinNameByAdcChannel(const char *msg, adc_channel_e hwChannel, char *buffer, size_t bufferSize);
-void initPeriodicEvents();
+/**
+ * Slow callback work, invoked by main loop with part going from zero to partCount - 1 on consecutive ticks
+ */
+void doPeriodicSlowCallback(size_t part, size_t partCount);
 // see also applyNewHardwareSettings
 void initRealHardwareEngineController();
 void commonEarlyInit();
@@ -126,8 +126,9 @@ bool InjectionEvent::updateInjectionAngle() {
 	if (result) {
 		// If injector duty cycle is high, lock injection SOI so that we
 		// don't miss injections at or above 100% duty
-		if (getEngineState()->shouldUpdateInjectionTiming) {
+		if (getEngineState()->shouldUpdateInjectionTiming && injectionStartAngle != result.Value) {
 			injectionStartAngle = result.Value;
+			getFuelSchedule()->phaseOrder.invalidate();
 		}
 
 		return true;
@@ -219,9 +220,18 @@ void FuelSchedule::onTriggerTooth(efitick_t nowNt, float currentPhase, float nex
 		return;
 	}
 
-	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
-		elements[i].onTriggerTooth(nowNt, currentPhase, nextPhase);
+	if (phaseOrder.needsRebuild() || phaseOrder.getCount() != engineConfiguration->cylindersCount) {
+		phaseOrder.beginRebuild();
+		for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+			phaseOrder.add(elements[i].injectionStartAngle, i);
+		}
+		phaseOrder.finishRebuild();
 	}
+
+	// only the injections due before the next tooth, instead of checking every cylinder
+	phaseOrder.forEachInRange(currentPhase, nextPhase, [&](uint8_t id) {
+		elements[id].scheduleInjection(nowNt, currentPhase);
+	});
 }
 
 #endif // EFI_ENGINE_CONTROL
@@ -10,6 +10,7 @@
 #include "fl_stack.h"
 #include "trigger_structure.h"
 #include "wall_fuel.h"
+#include "phase_event_ring.h"
 
 #define MAX_WIRES_COUNT 2
 
@@ -22,6 +23,9 @@ public:
 	// Call this every decoded trigger tooth.  It will schedule any relevant events for this injector.
 	void onTriggerTooth(efitick_t nowNt, float currentPhase, float nextPhase);
 
+	// Schedules this injection, caller has already checked that it is due before the next tooth
+	void scheduleInjection(efitick_t nowNt, float currentPhase);
+
 	WallFuel& getWallFuel();
 
 	void setIndex(uint8_t index) {
@@ -81,6 +85,9 @@ public:
 	 */
 	InjectionEvent elements[MAX_CYLINDER_COUNT];
 	bool isReady = false;
+
+	// injection start angles by phase, element index as id
+	PhaseEventRing phaseOrder;
 };
 
 FuelSchedule * getFuelSchedule();
@@ -40,6 +40,11 @@
 #include "event_queue.h"
 #include "injector_model.h"
 #include "injection_gpio.h"
+#include "engine_module_timing.h"
+
+#ifdef TRIGGER_SCOPE
+#include "trigger_scope.h"
+#endif // TRIGGER_SCOPE
 
 #if EFI_LAUNCH_CONTROL
 #include "launch_control.h"
@@ -76,13 +81,17 @@ static void turnInjectionPinLowStage2(InjectionEvent* event) {
 }
 
 void InjectionEvent::onTriggerTooth(efitick_t nowNt, float currentPhase, float nextPhase) {
-	auto eventAngle = injectionStartAngle;
-
 	// Determine whether our angle is going to happen before (or near) the next tooth
-	if (!isPhaseInRange(eventAngle, currentPhase, nextPhase)) {
+	if (!isPhaseInRange(injectionStartAngle, currentPhase, nextPhase)) {
 		return;
 	}
 
+	scheduleInjection(nowNt, currentPhase);
+}
+
+void InjectionEvent::scheduleInjection(efitick_t nowNt, float currentPhase) {
+	auto eventAngle = injectionStartAngle;
+
 	// Select fuel mass from the correct cylinder
 	auto injectionMassGrams = getEngineState()->injectionMass[this->cylinderNumber];
 
@@ -265,6 +274,11 @@ void mainTriggerCallback(uint32_t trgEventIndex, efitick_t edgeTimestamp, angle_
 		return;
 	}
 
+#ifdef TRIGGER_SCOPE
+	// scope is most useful while cranking, arm it before RPM is known
+	triggerScopeOnTriggerTooth(trgEventIndex);
+#endif // TRIGGER_SCOPE
+
 	float rpm = engine->rpmCalculator.getCachedRpm();
 	if (rpm == 0) {
 		// this happens while we just start cranking
@@ -286,7 +300,7 @@ void mainTriggerCallback(uint32_t trgEventIndex, efitick_t edgeTimestamp, angle_
 		}
 	}
 
-	engine->engineModules.apply_all([=](auto & m) {
+	applyAllEngineModules(engine->engineModules, EngineModuleHook::EnginePhase, [=](auto & m) {
 		m.onEnginePhase(rpm, edgeTimestamp, currentPhase, nextPhase);
 	});
 
@@ -0,0 +1,53 @@
+/**
+ * @file phase_event_ring.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "phase_event_ring.h"
+
+void PhaseEventRing::add(float angle, uint8_t id) {
+	if (std::isnan(angle) || m_count >= PHASE_EVENT_RING_SIZE) {
+		return;
+	}
+
+	m_entries[m_count++] = { angle, id };
+}
+
+void PhaseEventRing::finishRebuild() {
+	// a dozen or two entries which only move a little between rebuilds, insertion sort it is
+	for (size_t i = 1; i < m_count; i++) {
+		Entry entry = m_entries[i];
+		size_t j = i;
+		for (; j > 0 && m_entries[j - 1].angle > entry.angle; j--) {
+			m_entries[j] = m_entries[j - 1];
+		}
+		m_entries[j] = entry;
+	}
+
+	m_cursor = 0;
+}
+
+size_t PhaseEventRing::findFirstAtOrAfter(float phase) const {
+	size_t cursor = m_cursor;
+	bool isCursorValid = cursor <= m_count
+		&& (cursor == m_count || m_entries[cursor].angle >= phase)
+		&& (cursor == 0 || m_entries[cursor - 1].angle < phase);
+	if (isCursorValid) {
+		return cursor;
+	}
+
+	size_t low = 0;
+	size_t high = m_count;
+	while (low < high) {
+		size_t middle = (low + high) / 2;
+		if (m_entries[middle].angle < phase) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file phase_event_ring.h
+ * @brief Engine cycle events sorted by phase, so a trigger tooth only looks at the events due before the next tooth
+ *
+ * Owner adds one entry per event angle on rebuild, then each tooth visits entries which
+ * isPhaseInRange(angle, currentPhase, nextPhase) would accept, in the order the engine gets to them.
+ * Rebuild is requested with invalidate() whenever any of the angles change.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+
+// ignition needs a second entry per cylinder for odd cylinder wasted spark
+#define PHASE_EVENT_RING_SIZE (2 * MAX_CYLINDER_COUNT)
+
+class PhaseEventRing {
+public:
+	// safe from any context, the ring itself is only touched by the trigger tooth handler
+	void invalidate() {
+		m_needsRebuild = true;
+	}
+
+	bool needsRebuild() const {
+		return m_needsRebuild;
+	}
+
+	void beginRebuild() {
+		m_needsRebuild = false;
+		// angles have to be read after the flag is cleared, a change racing with the rebuild rebuilds again
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		m_count = 0;
+		m_rebuildCount++;
+	}
+
+	// NaN angles are never in range and are left out
+	void add(float angle, uint8_t id);
+
+	void finishRebuild();
+
+	size_t getCount() const {
+		return m_count;
+	}
+
+	// steady state engine should not have to sort again
+	uint32_t getRebuildCount() const {
+		return m_rebuildCount;
+	}
+
+	/**
+	 * Invokes callback(id) for every entry in [currentPhase, nextPhase), wrapping around the end of
+	 * the cycle when nextPhase <= currentPhase
+	 */
+	template<typename TCallback>
+	void forEachInRange(float currentPhase, float nextPhase, TCallback callback) {
+		size_t index = findFirstAtOrAfter(currentPhase);
+
+		if (nextPhase > currentPhase) {
+			for (; index < m_count && m_entries[index].angle < nextPhase; index++) {
+				callback(m_entries[index].id);
+			}
+		} else {
+			// till the end of the cycle, then from the start of the next one
+			for (; index < m_count; index++) {
+				callback(m_entries[index].id);
+			}
+			for (index = 0; index < m_count && m_entries[index].angle < nextPhase; index++) {
+				callback(m_entries[index].id);
+			}
+		}
+
+		// next tooth normally starts right where this one ended
+		m_cursor = index;
+	}
+
+private:
+	size_t findFirstAtOrAfter(float phase) const;
+
+	struct Entry {
+		float angle;
+		uint8_t id;
+	};
+
+	Entry m_entries[PHASE_EVENT_RING_SIZE];
+	size_t m_count = 0;
+	size_t m_cursor = 0;
+	uint32_t m_rebuildCount = 0;
+
+	volatile bool m_needsRebuild = true;
+};
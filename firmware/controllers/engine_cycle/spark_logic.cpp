@@ -159,6 +159,10 @@ static void prepareCylinderIgnitionSchedule(angle_t dwellAngleDuration, floatms_
 
 	assertAngleRange(dwellStartAngle, "findAngle dwellStartAngle", ObdCode::CUSTOM_ERR_6550);
 	wrapAngle(dwellStartAngle, "findAngle#7", ObdCode::CUSTOM_ERR_6550);
+	if (event->dwellAngle != dwellStartAngle) {
+		// phase sorted order only has to follow actual changes
+		engine->ignitionEvents.phaseOrder.invalidate();
+	}
 	event->dwellAngle = dwellStartAngle;
 
 #if FUEL_MATH_EXTREME_LOGGING
@@ -553,6 +557,39 @@ static void prepareIgnitionSchedule() {
 	initializeIgnitionActions();
 }
 
+static angle_t getOddCylWastedDwellAngle(angle_t dwellAngle) {
+	auto dwellAngleWastedEvent = dwellAngle + 360;
+	if (dwellAngleWastedEvent > 720) {
+		dwellAngleWastedEvent -= 720;
+	}
+	return dwellAngleWastedEvent;
+}
+
+/**
+ * Dwell angles only change once per cylinder per cycle, see prepareCylinderIgnitionSchedule(),
+ * so the phase sorted order is rebuilt then rather than every cylinder being checked on every tooth
+ */
+static void updateIgnitionPhaseOrder(IgnitionEventList *list, bool withWastedSpark) {
+	PhaseEventRing& order = list->phaseOrder;
+	size_t cylindersCount = engineConfiguration->cylindersCount;
+	size_t expectedCount = withWastedSpark ? 2 * cylindersCount : cylindersCount;
+
+	if (!order.needsRebuild() && order.getCount() == expectedCount && list->isPhaseOrderWithWastedSpark == withWastedSpark) {
+		return;
+	}
+
+	order.beginRebuild();
+	for (size_t i = 0; i < cylindersCount; i++) {
+		angle_t dwellAngle = list->elements[i].dwellAngle;
+		order.add(dwellAngle, i);
+		if (withWastedSpark) {
+			order.add(getOddCylWastedDwellAngle(dwellAngle), i + MAX_CYLINDER_COUNT);
+		}
+	}
+	order.finishRebuild();
+	list->isPhaseOrderWithWastedSpark = withWastedSpark;
+}
+
 void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentPhase, float nextPhase) {
 	ScopePerf perf(PE::OnTriggerEventSparkLogic);
 
@@ -592,53 +629,49 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 		&& getCurrentIgnitionMode() == IM_WASTED_SPARK;
 
 	if (engine->ignitionEvents.isReady) {
-		for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
-			IgnitionEvent *event = &engine->ignitionEvents.elements[i];
+		IgnitionEventList *list = &engine->ignitionEvents;
+		updateIgnitionPhaseOrder(list, enableOddCylinderWastedSpark);
+
+		// only the dwells which start before the next tooth, in the order they start
+		list->phaseOrder.forEachInRange(currentPhase, nextPhase, [&](uint8_t id) {
+			bool isOddCylWastedEvent = id >= MAX_CYLINDER_COUNT;
+			size_t i = isOddCylWastedEvent ? id - MAX_CYLINDER_COUNT : id;
+			IgnitionEvent *event = &list->elements[i];
 
 			angle_t dwellAngle = event->dwellAngle;
 
 			angle_t sparkAngle = event->sparkAngle;
 			if (std::isnan(sparkAngle)) {
 				warning(ObdCode::CUSTOM_ADVANCE_SPARK, "NaN advance");
-				continue;
+				return;
 			}
 
-			bool isOddCylWastedEvent = false;
-			if (enableOddCylinderWastedSpark) {
-				auto dwellAngleWastedEvent = dwellAngle + 360;
-				if (dwellAngleWastedEvent > 720) {
-					dwellAngleWastedEvent -= 720;
-				}
-
-				// Check whether this event hits 360 degrees out from now (ie, wasted spark),
-				// and if so, twiddle the dwell and spark angles so it happens now instead
-				isOddCylWastedEvent = isPhaseInRange(dwellAngleWastedEvent, currentPhase, nextPhase);
-
-				if (isOddCylWastedEvent) {
-					dwellAngle = dwellAngleWastedEvent;
+			if (isOddCylWastedEvent) {
+				// This event hits 360 degrees out from now (ie, wasted spark),
+				// twiddle the dwell and spark angles so it happens now instead
+				dwellAngle = getOddCylWastedDwellAngle(dwellAngle);
 
-					sparkAngle += 360;
-					if (sparkAngle > 720) {
-						sparkAngle -= 720;
-					}
+				sparkAngle += 360;
+				if (sparkAngle > 720) {
+					sparkAngle -= 720;
 				}
-			}
-
-			if (!isOddCylWastedEvent && !isPhaseInRange(dwellAngle, currentPhase, nextPhase)) {
-				continue;
+			} else if (enableOddCylinderWastedSpark
+					&& isPhaseInRange(getOddCylWastedDwellAngle(dwellAngle), currentPhase, nextPhase)) {
+				// both entries of this cylinder are due before the next tooth, wasted one wins
+				return;
 			}
 
 			if (i == 0 && engineConfiguration->artificialTestMisfire && (getRevolutionCounter() % ((int)engineConfiguration->scriptSetting[5]) == 0)) {
 				// artificial misfire on cylinder #1 for testing purposes
 				// enable artificialMisfire
 				warning(ObdCode::CUSTOM_ARTIFICIAL_MISFIRE, "artificial misfire on cylinder #1 for testing purposes %d", engine->engineState.globalSparkCounter);
-				continue;
+				return;
 			}
 #if EFI_LAUNCH_CONTROL
             bool sparkLimited = engine->softSparkLimiter.shouldSkip() || engine->hardSparkLimiter.shouldSkip();
             engine->ignitionState.luaIgnitionSkip = sparkLimited;
 			if (sparkLimited) {
-				continue;
+				return;
 			}
 #endif // EFI_LAUNCH_CONTROL
 
@@ -646,7 +679,7 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 /*
        if (engine->antilagController.isAntilagCondition) {
 			if (engine->ALSsoftSparkLimiter.shouldSkip()) {
-				continue;
+				return;
 			}
 		}
 		float throttleIntent = Sensor::getOrZero(SensorType::DriverThrottleIntent);
@@ -662,7 +695,7 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 #endif // EFI_ANTILAG_SYSTEM
 
 			scheduleSparkEvent(limitedSpark, event, rpm, dwellMs, dwellAngle, sparkAngle, edgeTimestamp, currentPhase, nextPhase);
-		}
+		});
 	}
 }
 
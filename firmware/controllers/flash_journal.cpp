@@ -0,0 +1,531 @@
+/**
+ * @file    flash_journal.cpp
+ * @brief   Log-structured storage of setting items on top of two erasable flash banks
+ *
+ * Bank layout:
+ *  [bank header][record][record]...[commit]...[record][commit][erased space]
+ * Bank header is written last when bank is compacted, bank with higher valid sequence wins.
+ * Data record carries item id, offset within item and up to maxRecordData bytes of payload.
+ * Commit record closes each store and carries total item size. Records after last commit are ignored.
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "flash_journal.h"
+#include "crc32_fast.h"
+
+#if EFI_STORAGE_INT_FLASH_JOURNAL || defined(EFI_UNIT_TEST)
+
+#define JOURNAL_BANK_MAGIC		0x4a524e4c
+#define JOURNAL_RECORD_DATA		0x5a
+#define JOURNAL_RECORD_COMMIT	0xc3
+#define JOURNAL_ERASED			0xff
+
+// compact once log is filled above this fraction of the bank
+#define JOURNAL_COMPACTION_THRESHOLD_PERCENT	75
+
+struct JournalBankHeader {
+	uint32_t magic;
+	uint32_t sequence;
+	uint32_t crc;
+};
+
+struct JournalRecordHeader {
+	uint8_t magic;
+	uint8_t id;
+	uint16_t length;
+	// offset within item for data records, total item size for commit
+	uint32_t offset;
+	// covers all fields above and payload
+	uint32_t crc;
+};
+
+// FlashJournal::m_staging reserves 16 bytes for header
+static_assert(sizeof(JournalRecordHeader) <= 16);
+
+static uint32_t getBankHeaderCrc(const JournalBankHeader &header) {
+	return crc32Fast(&header, offsetof(JournalBankHeader, crc));
+}
+
+static bool isErased(const uint8_t *ptr, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		if (ptr[i] != JOURNAL_ERASED) {
+			return false;
+		}
+	}
+	return true;
+}
+
+FlashJournal::FlashJournal(FlashJournalMedia &media)
+	: m_media(media)
+{
+}
+
+size_t FlashJournal::alignUp(size_t size) {
+	size_t align = m_media.getWriteAlignment();
+	return (size + align - 1) / align * align;
+}
+
+size_t FlashJournal::getRecordSize(size_t dataLength) {
+	return alignUp(sizeof(JournalRecordHeader) + dataLength);
+}
+
+size_t FlashJournal::getDataStart() {
+	return alignUp(sizeof(JournalBankHeader));
+}
+
+void FlashJournal::mount() {
+	m_mounted = true;
+	m_dirty = false;
+	m_activeBank = -1;
+	m_logEnd = 0;
+	m_writeOffset = 0;
+	memset(m_itemSize, 0, sizeof(m_itemSize));
+
+	for (size_t bank = 0; bank < 2; bank++) {
+		JournalBankHeader header;
+		if (!m_media.read(bank, 0, (uint8_t *)&header, sizeof(header))) {
+			continue;
+		}
+
+		if ((header.magic != JOURNAL_BANK_MAGIC) || (header.crc != getBankHeaderCrc(header))) {
+			continue;
+		}
+
+		if ((m_activeBank < 0) || ((int32_t)(header.sequence - m_sequence) > 0)) {
+			m_activeBank = bank;
+			m_sequence = header.sequence;
+		}
+	}
+
+	if (m_activeBank < 0) {
+		// blank or never formatted
+		return;
+	}
+
+	size_t bankSize = m_media.getBankSize();
+	size_t offset = getDataStart();
+	size_t committedEnd = offset;
+	size_t pendingSize[maxItems] = {};
+	memcpy(pendingSize, m_itemSize, sizeof(pendingSize));
+
+	while (offset + sizeof(JournalRecordHeader) <= bankSize) {
+		JournalRecordHeader header;
+		if (!m_media.read(m_activeBank, offset, (uint8_t *)&header, sizeof(header))) {
+			m_dirty = true;
+			break;
+		}
+
+		if (isErased((const uint8_t *)&header, sizeof(header))) {
+			// end of log
+			break;
+		}
+
+		if (((header.magic != JOURNAL_RECORD_DATA) && (header.magic != JOURNAL_RECORD_COMMIT)) ||
+			(header.id >= maxItems) || (header.length > maxRecordData)) {
+			m_dirty = true;
+			break;
+		}
+
+		size_t recordSize = getRecordSize(header.length);
+		if (offset + recordSize > bankSize) {
+			m_dirty = true;
+			break;
+		}
+
+		uint32_t crc = crc32Fast(&header, offsetof(JournalRecordHeader, crc));
+		if (header.length) {
+			if (!m_media.read(m_activeBank, offset + sizeof(header), m_chunk, header.length)) {
+				m_dirty = true;
+				break;
+			}
+			crc = crc32FastInc(m_chunk, crc, header.length);
+		}
+
+		if (crc != header.crc) {
+			// torn write
+			m_dirty = true;
+			break;
+		}
+
+		offset += recordSize;
+
+		if (header.magic == JOURNAL_RECORD_COMMIT) {
+			pendingSize[header.id] = header.offset;
+			memcpy(m_itemSize, pendingSize, sizeof(m_itemSize));
+			committedEnd = offset;
+		}
+	}
+
+	m_logEnd = committedEnd;
+	m_writeOffset = offset;
+
+	if (m_writeOffset != m_logEnd) {
+		// records of interrupted store, we cannot commit on top of them
+		m_dirty = true;
+	}
+}
+
+bool FlashJournal::appendRecord(size_t bank, size_t& offset, uint8_t magic, size_t id, size_t itemOffset, const uint8_t *data, size_t length) {
+	size_t recordSize = getRecordSize(length);
+
+	if (offset + recordSize > m_media.getBankSize()) {
+		return false;
+	}
+
+	JournalRecordHeader header;
+	header.magic = magic;
+	header.id = id;
+	header.length = length;
+	header.offset = itemOffset;
+	header.crc = crc32Fast(&header, offsetof(JournalRecordHeader, crc));
+	if (length) {
+		header.crc = crc32FastInc(data, header.crc, length);
+	}
+
+	// single write per record, so flash programming unit is never written twice
+	memset(m_staging, JOURNAL_ERASED, recordSize);
+	memcpy(m_staging, &header, sizeof(header));
+	if (length) {
+		memcpy(m_staging + sizeof(header), data, length);
+	}
+
+	bool ok = m_media.write(bank, offset, m_staging, recordSize);
+
+	// even failed write has consumed space
+	offset += recordSize;
+	m_recordsWritten++;
+	m_bytesWritten += recordSize;
+
+	return ok;
+}
+
+bool FlashJournal::appendVerifiedRecord(size_t bank, size_t& offset, uint8_t magic, size_t id, size_t itemOffset, const uint8_t *data, size_t length) {
+	size_t recordOffset = offset;
+	size_t recordSize = getRecordSize(length);
+
+	if (!appendRecord(bank, offset, magic, id, itemOffset, data, length)) {
+		return false;
+	}
+
+	// m_staging still holds the whole record
+	uint8_t readBack[16];
+	for (size_t done = 0; done < recordSize; done += sizeof(readBack)) {
+		size_t part = std::min(sizeof(readBack), recordSize - done);
+		if (!m_media.read(bank, recordOffset + done, readBack, part) ||
+			(memcmp(readBack, m_staging + done, part) != 0)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FlashJournal::applyRecords(size_t bank, size_t logEnd, size_t id, size_t itemOffset, uint8_t *dst, size_t size) {
+	size_t offset = getDataStart();
+
+	while (offset < logEnd) {
+		JournalRecordHeader header;
+		m_media.read(bank, offset, (uint8_t *)&header, sizeof(header));
+
+		if ((header.magic == JOURNAL_RECORD_DATA) && (header.id == id)) {
+			size_t start = std::max<size_t>(header.offset, itemOffset);
+			size_t end = std::min<size_t>(header.offset + header.length, itemOffset + size);
+
+			if (start < end) {
+				m_media.read(bank, offset + sizeof(header) + (start - header.offset),
+					dst + (start - itemOffset), end - start);
+			}
+		}
+
+		offset += getRecordSize(header.length);
+	}
+}
+
+void FlashJournal::setChunkChanged(size_t chunk, bool changed) {
+	if (changed) {
+		m_changedChunks[chunk / 8] |= BIT(chunk % 8);
+	} else {
+		m_changedChunks[chunk / 8] &= ~BIT(chunk % 8);
+	}
+}
+
+void FlashJournal::findChangedChunks(size_t id, const uint8_t *ptr, size_t size) {
+	size_t storedSize = m_itemSize[id];
+	size_t chunks = (size + chunkSize - 1) / chunkSize;
+
+	// stored image reads as erased where no record covers it
+	for (size_t chunk = 0; chunk < chunks; chunk++) {
+		size_t start = chunk * chunkSize;
+		size_t length = std::min(chunkSize, size - start);
+		setChunkChanged(chunk, !isErased(ptr + start, length));
+	}
+
+	// records are chunk aligned, so the last record fully covering a chunk defines its stored content
+	size_t offset = getDataStart();
+	while (offset < m_logEnd) {
+		JournalRecordHeader header;
+		m_media.read(m_activeBank, offset, (uint8_t *)&header, sizeof(header));
+
+		if ((header.magic == JOURNAL_RECORD_DATA) && (header.id == id)) {
+			size_t recordEnd = header.offset + header.length;
+
+			for (size_t chunk = header.offset / chunkSize; (chunk < chunks) && (chunk * chunkSize < recordEnd); chunk++) {
+				size_t start = chunk * chunkSize;
+				size_t end = std::min(start + chunkSize, size);
+
+				if (end > storedSize) {
+					// past stored size, handled below
+					break;
+				}
+
+				if ((header.offset > start) || (recordEnd < end)) {
+					// partially overwritten chunk, just write it again
+					setChunkChanged(chunk, true);
+					continue;
+				}
+
+				m_media.read(m_activeBank, offset + sizeof(header) + (start - header.offset), m_chunk, end - start);
+				setChunkChanged(chunk, memcmp(m_chunk, ptr + start, end - start) != 0);
+			}
+		}
+
+		offset += getRecordSize(header.length);
+	}
+
+	// chunk across the end of stored image is partially erased
+	size_t chunk = storedSize / chunkSize;
+	if ((chunk < chunks) && (std::min((chunk + 1) * chunkSize, size) > storedSize) && (storedSize % chunkSize)) {
+		setChunkChanged(chunk, true);
+	}
+}
+
+size_t FlashJournal::writeChangedRuns(size_t id, const uint8_t *ptr, size_t size, bool dryRun) {
+	size_t needed = 0;
+	size_t runStart = 0;
+	size_t runLength = 0;
+
+	auto flush = [&]() {
+		if (runLength == 0) {
+			return true;
+		}
+
+		needed += getRecordSize(runLength);
+
+		bool ok = true;
+		if (!dryRun) {
+			ok = appendRecord(m_activeBank, m_writeOffset, JOURNAL_RECORD_DATA, id, runStart, ptr + runStart, runLength);
+		}
+
+		runLength = 0;
+		return ok;
+	};
+
+	for (size_t offset = 0; offset < size; offset += chunkSize) {
+		size_t length = std::min(chunkSize, size - offset);
+
+		if (!isChunkChanged(offset / chunkSize)) {
+			if (!flush()) {
+				return 0;
+			}
+			continue;
+		}
+
+		if ((runLength != 0) && (runLength + length > maxRecordData)) {
+			if (!flush()) {
+				return 0;
+			}
+		}
+
+		if (runLength == 0) {
+			runStart = offset;
+		}
+		runLength += length;
+	}
+
+	if (!flush()) {
+		return 0;
+	}
+
+	// commit record
+	needed += getRecordSize(0);
+
+	return needed;
+}
+
+StorageStatus FlashJournal::store(size_t id, const uint8_t *ptr, size_t size) {
+	if ((id >= maxItems) || (size > maxItemSize)) {
+		return StorageStatus::NotSupported;
+	}
+
+	if (!m_mounted) {
+		mount();
+	}
+
+	if ((m_activeBank < 0) || m_dirty) {
+		return compactWith(id, ptr, size);
+	}
+
+	findChangedChunks(id, ptr, size);
+	size_t needed = writeChangedRuns(id, ptr, size, /*dryRun*/true);
+
+	if ((needed == getRecordSize(0)) && (size == m_itemSize[id])) {
+		// nothing has changed, nothing to write
+		return StorageStatus::Ok;
+	}
+
+	if (m_writeOffset + needed > m_media.getBankSize()) {
+		return compactWith(id, ptr, size);
+	}
+
+	if (writeChangedRuns(id, ptr, size, /*dryRun*/false) == 0) {
+		m_dirty = true;
+		return StorageStatus::Failed;
+	}
+
+	if (!appendRecord(m_activeBank, m_writeOffset, JOURNAL_RECORD_COMMIT, id, size, nullptr, 0)) {
+		m_dirty = true;
+		return StorageStatus::Failed;
+	}
+
+	m_logEnd = m_writeOffset;
+	m_itemSize[id] = size;
+
+	return StorageStatus::Ok;
+}
+
+StorageStatus FlashJournal::read(size_t id, uint8_t *ptr, size_t size) {
+	if (id >= maxItems) {
+		return StorageStatus::NotSupported;
+	}
+
+	if (!m_mounted) {
+		mount();
+	}
+
+	if ((m_activeBank < 0) || (m_itemSize[id] == 0)) {
+		return StorageStatus::NotFound;
+	}
+
+	memset(ptr, JOURNAL_ERASED, size);
+	applyRecords(m_activeBank, m_logEnd, id, 0, ptr, std::min(size, m_itemSize[id]));
+
+	return StorageStatus::Ok;
+}
+
+StorageStatus FlashJournal::format() {
+	bool ok = m_media.erase(0);
+	ok &= m_media.erase(1);
+
+	mount();
+
+	return ok ? StorageStatus::Ok : StorageStatus::Failed;
+}
+
+bool FlashJournal::isFormatted() {
+	if (!m_mounted) {
+		mount();
+	}
+
+	return m_activeBank >= 0;
+}
+
+bool FlashJournal::needsCompaction() {
+	if (!m_mounted) {
+		mount();
+	}
+
+	if (m_activeBank < 0) {
+		// nothing to compact, first store will format
+		return false;
+	}
+
+	return m_dirty ||
+		(m_writeOffset > m_media.getBankSize() * JOURNAL_COMPACTION_THRESHOLD_PERCENT / 100);
+}
+
+StorageStatus FlashJournal::compact() {
+	if (!m_mounted) {
+		mount();
+	}
+
+	if (m_activeBank < 0) {
+		return StorageStatus::NotFound;
+	}
+
+	return compactWith(-1, nullptr, 0);
+}
+
+StorageStatus FlashJournal::compactWith(int overrideId, const uint8_t *ptr, size_t size) {
+	size_t target = (m_activeBank < 0) ? m_initialBank : (1 - m_activeBank);
+
+	if (!m_media.erase(target)) {
+		return StorageStatus::Failed;
+	}
+
+	size_t offset = getDataStart();
+
+	for (size_t id = 0; id < maxItems; id++) {
+		bool isOverride = ((int)id == overrideId);
+		size_t itemSize = isOverride ? size : m_itemSize[id];
+
+		if (itemSize == 0) {
+			continue;
+		}
+
+		for (size_t itemOffset = 0; itemOffset < itemSize; itemOffset += maxRecordData) {
+			size_t length = std::min(maxRecordData, itemSize - itemOffset);
+			const uint8_t *src;
+
+			if (isOverride) {
+				src = ptr + itemOffset;
+			} else {
+				memset(m_chunk, JOURNAL_ERASED, length);
+				applyRecords(m_activeBank, m_logEnd, id, itemOffset, m_chunk, length);
+				src = m_chunk;
+			}
+
+			if (isErased(src, length)) {
+				// reads back as erased anyway
+				continue;
+			}
+
+			if (!appendVerifiedRecord(target, offset, JOURNAL_RECORD_DATA, id, itemOffset, src, length)) {
+				return StorageStatus::Failed;
+			}
+		}
+
+		if (!appendVerifiedRecord(target, offset, JOURNAL_RECORD_COMMIT, id, itemSize, nullptr, 0)) {
+			return StorageStatus::Failed;
+		}
+	}
+
+	// new bank becomes valid only now, everything above has been read back
+	JournalBankHeader header;
+	header.magic = JOURNAL_BANK_MAGIC;
+	header.sequence = m_sequence + 1;
+	header.crc = getBankHeaderCrc(header);
+
+	size_t headerSize = getDataStart();
+	memset(m_staging, JOURNAL_ERASED, headerSize);
+	memcpy(m_staging, &header, sizeof(header));
+	if (!m_media.write(target, 0, m_staging, headerSize)) {
+		return StorageStatus::Failed;
+	}
+
+	m_activeBank = target;
+	m_sequence = header.sequence;
+	m_logEnd = offset;
+	m_writeOffset = offset;
+	m_dirty = false;
+	if (overrideId >= 0) {
+		m_itemSize[overrideId] = size;
+	}
+	m_compactionCounter++;
+
+	return StorageStatus::Ok;
+}
+
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL || defined(EFI_UNIT_TEST)
@@ -0,0 +1,121 @@
+/**
+ * @file    flash_journal.h
+ * @brief   Log-structured storage of setting items on top of two erasable flash banks
+ *
+ * Store appends only chunks which differ from the last stored image, each record is protected by CRC and
+ * every store is closed by a commit record. Once active bank is full all live items are copied into the other
+ * bank which becomes active only after its header is written, so power loss at any point leaves the last
+ * committed image readable.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include "storage.h"
+
+class FlashJournalMedia {
+public:
+	/* size of each of two banks, in bytes */
+	virtual size_t getBankSize() = 0;
+	/* minimal programming unit, every write is aligned and padded to it */
+	virtual size_t getWriteAlignment() = 0;
+	virtual bool erase(size_t bank) = 0;
+	virtual bool write(size_t bank, size_t offset, const uint8_t *ptr, size_t size) = 0;
+	virtual bool read(size_t bank, size_t offset, uint8_t *ptr, size_t size) = 0;
+};
+
+class FlashJournal {
+public:
+	static constexpr size_t maxItems = EFI_STORAGE_TOTAL_ITEMS;
+	// granularity of change detection
+	static constexpr size_t chunkSize = 64;
+	// max payload of one record
+	static constexpr size_t maxRecordData = 256;
+	static constexpr size_t maxWriteAlignment = 32;
+	// biggest item we can track changes of
+	static constexpr size_t maxItemSize = 128 * 1024;
+	static constexpr size_t maxChunks = maxItemSize / chunkSize;
+
+	explicit FlashJournal(FlashJournalMedia &media);
+
+	/* scan both banks, pick the newest valid one and find the end of committed log */
+	void mount();
+
+	StorageStatus store(size_t id, const uint8_t *ptr, size_t size);
+	StorageStatus read(size_t id, uint8_t *ptr, size_t size);
+	StorageStatus format();
+
+	/* bank which the very first store formats, the other one is not touched until journal is valid */
+	void setInitialBank(size_t bank) {
+		m_initialBank = bank;
+	}
+
+	/* there is a valid journal bank */
+	bool isFormatted();
+
+	/* log has uncommitted tail or is filled above threshold */
+	bool needsCompaction();
+	/* move live data into the other bank */
+	StorageStatus compact();
+
+	int getActiveBank() const {
+		return m_activeBank;
+	}
+
+	size_t getUsedBytes() const {
+		return m_writeOffset;
+	}
+
+	uint32_t getRecordsWritten() const {
+		return m_recordsWritten;
+	}
+
+	uint32_t getBytesWritten() const {
+		return m_bytesWritten;
+	}
+
+	uint32_t getCompactionCounter() const {
+		return m_compactionCounter;
+	}
+
+private:
+	size_t alignUp(size_t size);
+	size_t getRecordSize(size_t dataLength);
+	size_t getDataStart();
+
+	bool appendRecord(size_t bank, size_t& offset, uint8_t magic, size_t id, size_t itemOffset, const uint8_t *data, size_t length);
+	// overlay committed data of given item window onto dst
+	void applyRecords(size_t bank, size_t logEnd, size_t id, size_t itemOffset, uint8_t *dst, size_t size);
+	// single pass over committed log, marks chunks of ptr which differ from stored image of item
+	void findChangedChunks(size_t id, const uint8_t *ptr, size_t size);
+	bool isChunkChanged(size_t chunk) const {
+		return m_changedChunks[chunk / 8] & BIT(chunk % 8);
+	}
+	void setChunkChanged(size_t chunk, bool changed);
+	// returns log space needed (dryRun) or zero on write failure, uses result of findChangedChunks
+	size_t writeChangedRuns(size_t id, const uint8_t *ptr, size_t size, bool dryRun);
+	// append and read back
+	bool appendVerifiedRecord(size_t bank, size_t& offset, uint8_t magic, size_t id, size_t itemOffset, const uint8_t *data, size_t length);
+	StorageStatus compactWith(int overrideId, const uint8_t *ptr, size_t size);
+
+	FlashJournalMedia &m_media;
+
+	bool m_mounted = false;
+	// there is something after last commit, log should be compacted before next append
+	bool m_dirty = false;
+	int m_activeBank = -1;
+	size_t m_initialBank = 0;
+	uint32_t m_sequence = 0;
+	size_t m_logEnd = 0;
+	size_t m_writeOffset = 0;
+	size_t m_itemSize[maxItems] = {};
+
+	uint32_t m_recordsWritten = 0;
+	uint32_t m_bytesWritten = 0;
+	uint32_t m_compactionCounter = 0;
+
+	uint8_t m_staging[16 + maxRecordData + maxWriteAlignment];
+	uint8_t m_chunk[maxRecordData];
+	uint8_t m_changedChunks[maxChunks / 8];
+};
@@ -1857,6 +1857,7 @@
 #define ts_command_e_TS_X14 20
 #define TS_COMMAND_F 'F'
 #define TS_COMMAND_F_char F
+#define TS_COMPOSITE_COMPACT_ENABLE 7
 #define TS_COMPOSITE_DISABLE 2
 #define TS_COMPOSITE_ENABLE 1
 #define TS_COMPOSITE_READ 3
@@ -1869,6 +1870,8 @@
 #define TS_GET_COMPOSITE_BUFFER_DONE_DIFFERENTLY_char 8
 #define TS_GET_CONFIG_ERROR 'e'
 #define TS_GET_CONFIG_ERROR_char e
+#define TS_GET_EDGE_LATENCY 'y'
+#define TS_GET_EDGE_LATENCY_char y
 #define TS_GET_FIRMWARE_VERSION 'V'
 #define TS_GET_FIRMWARE_VERSION_char V
 #define TS_GET_OUTPUTS_SIZE '4'
@@ -1889,6 +1892,8 @@
 #define TS_OUTPUT_ALL_COMMAND_char A
 #define TS_OUTPUT_COMMAND 'O'
 #define TS_OUTPUT_COMMAND_char O
+#define TS_OUTPUT_DELTA_COMMAND 'd'
+#define TS_OUTPUT_DELTA_COMMAND_char d
 #define TS_PERF_TRACE_BEGIN '_'
 #define TS_PERF_TRACE_BEGIN_char _
 #define TS_PERF_TRACE_GET_BUFFER 'b'
@@ -2160,11 +2165,12 @@
 #define TS_SIMULATE_CAN_char >
 #define TS_TEST_COMMAND 't'
 #define TS_TEST_COMMAND_char t
-#define TS_TOTAL_OUTPUT_SIZE 2084
+#define TS_TOTAL_OUTPUT_SIZE 2136
 #define TS_TRIGGER_SCOPE_CHANNEL_1_NAME "Channel 1"
 #define TS_TRIGGER_SCOPE_CHANNEL_2_NAME "Channel 2"
 #define TS_TRIGGER_SCOPE_DISABLE 5
 #define TS_TRIGGER_SCOPE_ENABLE 4
+#define TS_TRIGGER_SCOPE_ENVELOPE_ENABLE 8
 #define TS_TRIGGER_SCOPE_READ 6
 #define TsCalMode_EtbKd 5
 #define TsCalMode_EtbKi 4
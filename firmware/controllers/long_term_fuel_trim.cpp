@@ -5,6 +5,7 @@
 #include "storage.h"
 
 #include "long_term_fuel_trim.h"
+#include "tunerstudio.h"
 
 #include "board_overrides.h"
 
@@ -54,9 +55,17 @@ void LtftState::fillRandom() {
 	}
 }
 
+static void onVeChanged() {
+#if EFI_TUNER_STUDIO
+	// TS caches CRC of settings page
+	onConfigurationAreaChanged(config->veTable, sizeof(config->veTable));
+#endif // EFI_TUNER_STUDIO
+}
+
 void LtftState::applyToVe() {
 	// if we have custom implementation
 	if (call_board_override(custom_board_LtftTrimToVeApply)) {
+		onVeChanged();
 		return;
 	}
 
@@ -73,6 +82,8 @@ void LtftState::applyToVe() {
 			config->veTable[loadIndex][rpmIndex] = config->veTable[loadIndex][rpmIndex] * k;
 		}
 	}
+
+	onVeChanged();
 }
 
 void LongTermFuelTrim::init(LtftState *state) {
@@ -101,7 +112,40 @@ float LongTermFuelTrim::getMinAdjustment(const ltft_s& cfg) const {
 	return clampF(-MAX_ADJ, -PERCENT_DIV * cfg.maxRemove, 0);
 }
 
+template<class TBin, int TSize>
+static bool isFarOutside(float value, const TBin (&bins)[TSize]) {
+	float halfLow = 0.5f * (bins[1] - bins[0]);
+	float halfHigh = 0.5f * (bins[TSize - 1] - bins[TSize - 2]);
+	return (value < bins[0] - halfLow) || (value > bins[TSize - 1] + halfHigh);
+}
+
+void LtftCell::update(float rpm, float fuelLoad) {
+	// TODO: should we swap x and y here to keep aligned to wierd TS table definition?
+	// x - load, y - rpm
+	auto x = priv::getBin(fuelLoad, config->veLoadBins);
+	auto y = priv::getBin(rpm, config->veRpmBins);
+
+	loadIdx = x.Idx;
+	rpmIdx = y.Idx;
+
+	weights[0][0] = (1 - x.Frac) * (1 - y.Frac);
+	weights[0][1] = (1 - x.Frac) * y.Frac;
+	weights[1][0] = x.Frac * (1 - y.Frac);
+	weights[1][1] = x.Frac * y.Frac;
+
+	isOutside = isFarOutside(fuelLoad, config->veLoadBins) || isFarOutside(rpm, config->veRpmBins);
+}
+
+void LongTermFuelTrim::updateCell(float rpm, float fuelLoad) {
+	m_cell.update(rpm, fuelLoad);
+}
+
 void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fuelLoad) {
+	updateCell(rpm, fuelLoad);
+	learn(clResult);
+}
+
+void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult) {
 	const auto& cfg = engineConfiguration->ltft;
 
 	// LTFT uses STFT output, so if STFT is not correcting for some reason - LTFT also should not learn
@@ -111,15 +155,8 @@ void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fue
 		return;
 	}
 
-	// TODO: should we swap x and y here to keep aligned to wierd TS table definition?
-	// x - load, y - rpm
-	auto x = priv::getClosestBin(fuelLoad, config->veLoadBins);
-	auto y = priv::getClosestBin(rpm, config->veRpmBins);
-
 	// Skip learning if current load point falls far outside the table
-	if ((abs(x.Frac) > 0.5) ||
-		(abs(y.Frac) > 0.5)) {
-		// we are outside table
+	if (m_cell.isOutside) {
 		ltftCntMiss++;
 		ltftLearning = false;
 		return;
@@ -127,10 +164,9 @@ void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fue
 
 	bool adjusted = false;
 
-	// calculate weight depenting on distance from cell center
-	// Is this too heavy?
-	float weight = 1.0 - hypotf(x.Frac, y.Frac) / hypotf(0.5, 0.5);
-	float k = getIntegratorGain(cfg, clResult.region) * integrator_dt * weight;
+	float k = getIntegratorGain(cfg, clResult.region) * integrator_dt;
+	float minAdjustment = getMinAdjustment(cfg);
+	float maxAdjustment = getMaxAdjustment(cfg);
 
 	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
 		float lambdaCorrection = clResult.banks[bank] - 1.0;
@@ -140,23 +176,27 @@ void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fue
 			continue;
 		}
 
-		// get current trim
-		float trim = m_state->trims[bank][x.Idx][y.Idx];
+		// each of the four cells moves in proportion to how close the operating point is to it
+		for (size_t i = 0; i < 2; i++) {
+			for (size_t j = 0; j < 2; j++) {
+				float& trim = m_state->trims[bank][m_cell.loadIdx + i][m_cell.rpmIdx + j];
 
-		// Integrate
-		float newTrim = trim + k * (lambdaCorrection - trim);
+				// Integrate
+				float newTrim = trim + k * m_cell.weights[i][j] * (lambdaCorrection - trim);
 
-		// TODO:
-		// rise OBD code if we hit trim limit
+				// TODO:
+				// rise OBD code if we hit trim limit
 
-		// Clamp to bounds and save
-		newTrim = clampF(getMinAdjustment(cfg), newTrim, getMaxAdjustment(cfg));
+				// Clamp to bounds
+				newTrim = clampF(minAdjustment, newTrim, maxAdjustment);
 
-		// accumulate
-		ltftAccummulatedCorrection[bank] += newTrim - trim;
+				// accumulate
+				ltftAccummulatedCorrection[bank] += newTrim - trim;
 
-		// store
-		m_state->trims[bank][x.Idx][y.Idx] = newTrim;
+				// store
+				trim = newTrim;
+			}
+		}
 
 		adjusted = true;
 	}
@@ -177,6 +217,11 @@ void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fue
 }
 
 ClosedLoopFuelResult LongTermFuelTrim::getTrims(float rpm, float fuelLoad) {
+	updateCell(rpm, fuelLoad);
+	return getTrims();
+}
+
+ClosedLoopFuelResult LongTermFuelTrim::getTrims() {
 	const auto& cfg = engineConfiguration->ltft;
 
 	if ((!cfg.correctionEnabled) || (ltftLoadPending)) {
@@ -188,28 +233,20 @@ ClosedLoopFuelResult LongTermFuelTrim::getTrims(float rpm, float fuelLoad) {
 	}
 
 	// Keep calculating/applying correction even load point is far outside table
-#if 0
-	// x - load, y - rpm
-	auto x = priv::getClosestBin(fuelLoad, config->veLoadBins);
-	auto y = priv::getClosestBin(rpm, config->veRpmBins);
-
-	// do not interpolate outside table...
-	if ((abs(x.Frac) > 0.5) ||
-		(abs(y.Frac) > 0.5)) {
-		// we are outside table
-		miss++;
-		return { };
-	}
-#endif
 
 	// Is there any reason we should not apply LTFT?
 
 	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
-		ltftCorrection[bank] = 1.0f + interpolate3d(
-			m_state->trims[bank],
-			config->veLoadBins, fuelLoad,
-			config->veRpmBins, rpm
-		);
+		const auto& trims = m_state->trims[bank];
+		size_t x = m_cell.loadIdx;
+		size_t y = m_cell.rpmIdx;
+
+		// same as interpolate3d, with the bin search already done
+		ltftCorrection[bank] = 1.0f +
+			m_cell.weights[0][0] * trims[x][y] +
+			m_cell.weights[0][1] * trims[x][y + 1] +
+			m_cell.weights[1][0] * trims[x + 1][y] +
+			m_cell.weights[1][1] * trims[x + 1][y + 1];
 	}
 
 	ClosedLoopFuelResult result;
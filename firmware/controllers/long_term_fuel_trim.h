@@ -17,6 +17,21 @@ struct LtftState {
 	void fillRandom();
 };
 
+/**
+ * Where the operating point sits in the trim table: the four surrounding cells and their bilinear
+ * weights. Same for every bank, learn and apply both use it.
+ */
+struct LtftCell {
+	size_t loadIdx = 0;
+	size_t rpmIdx = 0;
+	// weights[i][j] belongs to trims[bank][loadIdx + i][rpmIdx + j], they add up to 1
+	float weights[2][2] = { { 1, 0 }, { 0, 0 } };
+	// more than half a cell outside the table, no learning there
+	bool isOutside = false;
+
+	void update(float rpm, float fuelLoad);
+};
+
 class LongTermFuelTrim : public EngineModule, public long_term_fuel_trim_state_s {
 public:
 	// EngineModule implementation
@@ -24,6 +39,10 @@ public:
 	bool needsDelayedShutoff() override;
 
 	void init(LtftState *state);
+	// once per fast callback, before learn() and getTrims()
+	void updateCell(float rpm, float fuelLoad);
+	void learn(ClosedLoopFuelResult clResult);
+	ClosedLoopFuelResult getTrims();
 	void learn(ClosedLoopFuelResult clResult, float rpm, float fuelLoad);
 	ClosedLoopFuelResult getTrims(float rpm, float fuelLoad);
 	void load();
@@ -37,6 +56,7 @@ public:
 
 private:
 	LtftState *m_state;
+	LtftCell m_cell;
 	// TODO: move to livedata and kill isVeUpdated() ?
 	bool veNeedRefresh = false;
 	bool showUpdateToUser = false;
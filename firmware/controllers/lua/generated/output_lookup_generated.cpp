@@ -898,6 +898,48 @@ float getOutputValueByHash(const int hash) {
 // transitionEventsCounter
 		case 1163075685:
 			return engine->outputChannels.transitionEventsCounter;
+// smartGpioSpiLatencyAvg
+		case 2053445653:
+			return engine->outputChannels.smartGpioSpiLatencyAvg;
+// smartGpioSpiLatencyMax
+		case 2053458045:
+			return engine->outputChannels.smartGpioSpiLatencyMax;
+// edgeLatencyInjectorMax
+		case 806989838:
+			return engine->outputChannels.edgeLatencyInjectorMax;
+// edgeLatencyInjectorMean
+		case 860864585:
+			return engine->outputChannels.edgeLatencyInjectorMean;
+// edgeLatencyCoilMax
+		case 539445143:
+			return engine->outputChannels.edgeLatencyCoilMax;
+// edgeLatencyCoilMean
+		case 621824242:
+			return engine->outputChannels.edgeLatencyCoilMean;
+// edgeLatencyQueueMax
+		case -707702059:
+			return engine->outputChannels.edgeLatencyQueueMax;
+// edgeLatencyQueueMean
+		case -1879327760:
+			return engine->outputChannels.edgeLatencyQueueMean;
+// engineModulesFastUs
+		case -1045340214:
+			return engine->outputChannels.engineModulesFastUs;
+// engineModulesHeaviestFastUs
+		case -1323389117:
+			return engine->outputChannels.engineModulesHeaviestFastUs;
+// engineModulesHeaviestFastMaxUs
+		case -471828599:
+			return engine->outputChannels.engineModulesHeaviestFastMaxUs;
+// engineModulesHeaviestFastIndex
+		case -476127405:
+			return engine->outputChannels.engineModulesHeaviestFastIndex;
+// engineModulesSlowUs
+		case -523675455:
+			return engine->outputChannels.engineModulesSlowUs;
+// engineModulesPhaseUs
+		case 145837101:
+			return engine->outputChannels.engineModulesPhaseUs;
 // baseDwell
 		case -1777838088:
 			return engine->ignitionState.baseDwell;
@@ -1087,6 +1087,10 @@ extern int luaCommandCounters[LUA_BUTTON_COUNT];
 		bool isGoodName = setConfigValueByName(propertyName, value);
 		if (isGoodName) {
 		    efiPrintf("LUA: applying [%s][%f]", propertyName, value);
+#if EFI_TUNER_STUDIO
+		    // field is not known here, TS page CRC is computed again from scratch
+		    onConfigurationAreaChanged(config, sizeof(persistent_config_s));
+#endif // EFI_TUNER_STUDIO
 		} else {
 		    efiPrintf("LUA: invalid calibration key [%s]", propertyName);
 		}
@@ -73,8 +73,59 @@ private:
 	}
 };
 
+static constexpr float inverseTableStep = 100.0f / (THROTTLE_INVERSE_TABLE_SIZE - 1);
+
+void ThrottleModelBase::buildInverseFlowTable() const {
+	// taken before reading the curve: a write during the build leaves the table stale and bumps version again
+	uint32_t version = m_effectiveAreaVersion;
+	float maxArea = 0;
+
+	for (size_t i = 0; i < THROTTLE_INVERSE_TABLE_SIZE; i++) {
+		// a dip in the curve would make inverse ambiguous, keep the highest area seen so far
+		maxArea = std::max(maxArea, effectiveArea(i * inverseTableStep));
+		m_inverseFlowTableArea[i] = maxArea;
+	}
+
+	m_inverseFlowTableVersion = version;
+}
+
 // Find the throttle position that gives the specified flow
 float ThrottleModelBase::throttlePositionForFlow(float flow, float pressureRatio, float p_up, float iat) const {
+	// Corrections do not depend on throttle position, so we only need inverse of the effective area curve
+	float flowCorrection = flowCorrections(pressureRatio, p_up, iat);
+
+	// If the target flow is more than the throttle can flow, return 100% since the throttle
+	// can't open any further
+	if (flow > partThrottleFlow(100, flowCorrection)) {
+		return 100;
+	}
+
+	if (flowCorrection <= 0) {
+		return 0;
+	}
+
+	if (m_inverseFlowTableVersion != m_effectiveAreaVersion) {
+		buildInverseFlowTable();
+	}
+
+	float area = flow / flowCorrection;
+	const float* areas = m_inverseFlowTableArea;
+
+	if (area <= areas[0]) {
+		return 0;
+	}
+
+	// first point with at least requested area, area lies between previous point and this one
+	size_t upper = std::lower_bound(areas, areas + THROTTLE_INVERSE_TABLE_SIZE, area) - areas;
+	if (upper >= THROTTLE_INVERSE_TABLE_SIZE) {
+		return 100;
+	}
+
+	size_t lower = upper - 1;
+	return interpolateClamped(areas[lower], lower * inverseTableStep, areas[upper], upper * inverseTableStep, area);
+}
+
+float ThrottleModelBase::throttlePositionForFlowSolver(float flow, float pressureRatio, float p_up, float iat) const {
 	// What does the bare throttle flow at wide open?
 	float wideOpenFlow = partThrottleFlow(100, pressureRatio, p_up, iat);
 
@@ -144,10 +195,29 @@ expected<float> ThrottleModelBase::estimateThrottleFlow(float map, float tps) {
 	return estimateThrottleFlow(tip.Value, tps, map, iat.Value);
 }
 
+void ThrottleModelBase::invalidateInverseFlowTable() {
+	m_effectiveAreaVersion = m_effectiveAreaVersion + 1;
+}
+
+void ThrottleModelBase::onConfigurationChange(engine_configuration_s const * /*previousConfig*/) {
+	invalidateInverseFlowTable();
+}
+
 void ThrottleModelBase::onSlowCallback() {
 	throttleEstimatedFlow = estimateThrottleFlow(Sensor::getOrZero(SensorType::Map), Sensor::getOrZero(SensorType::Tps1)).value_or(0);
 }
 
+void ThrottleModel::onSlowCallback() {
+	if (memcmp(m_effectiveAreaBins, config->throttleEstimateEffectiveAreaBins, sizeof(m_effectiveAreaBins)) != 0
+			|| memcmp(m_effectiveAreaValues, config->throttleEstimateEffectiveAreaValues, sizeof(m_effectiveAreaValues)) != 0) {
+		memcpy(m_effectiveAreaBins, config->throttleEstimateEffectiveAreaBins, sizeof(m_effectiveAreaBins));
+		memcpy(m_effectiveAreaValues, config->throttleEstimateEffectiveAreaValues, sizeof(m_effectiveAreaValues));
+		invalidateInverseFlowTable();
+	}
+
+	ThrottleModelBase::onSlowCallback();
+}
+
 float ThrottleModel::effectiveArea(float tps) const {
 	return interpolate2d(tps, config->throttleEstimateEffectiveAreaBins, config->throttleEstimateEffectiveAreaValues);
 }
@@ -4,11 +4,15 @@
 
 #include "throttle_model_generated.h"
 
+// inverse of effectiveArea is sampled every 1% of throttle
+#define THROTTLE_INVERSE_TABLE_SIZE 101
+
 struct ThrottleModelBase : public throttle_model_s, public EngineModule {
 public:
 	using interface_t = ThrottleModelBase;
 
 	void onSlowCallback() override;
+	void onConfigurationChange(engine_configuration_s const * previousConfig) override;
 
 	float estimateThrottleFlow(float tip, float tps, float map, float iat);
 	expected<float> estimateThrottleFlow(float map, float tps);
@@ -16,7 +20,13 @@ public:
 	float partThrottleFlow(float tps, float flowCorrection) const;
 	float partThrottleFlow(float tps, float pressureRatio, float p_up, float iat) const;
 
+	// Find the throttle position that gives the specified flow, using precomputed inverse of effectiveArea
 	float throttlePositionForFlow(float flow, float pressureRatio, float p_up, float iat) const;
+	// Same using iterative solver, slow but does not depend on inverse table resolution
+	float throttlePositionForFlowSolver(float flow, float pressureRatio, float p_up, float iat) const;
+
+	// effective area curve has changed, inverse table is rebuilt on next use
+	void invalidateInverseFlowTable();
 
 protected:
 	// Given some TPS, what is the normalized choked flow in g/s?
@@ -25,11 +35,28 @@ protected:
 	// Given some MAP, what is the most the engine can pull through a wide open throttle, in g/s?
 	virtual float maxEngineFlow(float map) const = 0;
 
+private:
+	void buildInverseFlowTable() const;
+
+	// bumped from any thread when effectiveArea may have changed, table is rebuilt on next use
+	volatile uint32_t m_effectiveAreaVersion = 1;
+	// m_effectiveAreaVersion the table was built from
+	mutable uint32_t m_inverseFlowTableVersion = 0;
+	// effectiveArea at evenly spaced throttle positions, made non-decreasing
+	mutable float m_inverseFlowTableArea[THROTTLE_INVERSE_TABLE_SIZE];
 };
 
 class ThrottleModel : public ThrottleModelBase {
+public:
+	void onSlowCallback() override;
+
+private:
 	float effectiveArea(float tps) const override;
 	float maxEngineFlow(float map) const override;
+
+	// curve the inverse table follows, TS writes change it without onConfigurationChange until burn
+	decltype(persistent_config_s::throttleEstimateEffectiveAreaBins) m_effectiveAreaBins{};
+	decltype(persistent_config_s::throttleEstimateEffectiveAreaValues) m_effectiveAreaValues{};
 };
 
 expected<float> getThrottleInletPressure();
@@ -24,6 +24,8 @@
 #include "pch.h"
 #include "exp_average.h"
 
+#include <atomic>
+
 
 #if EFI_MAP_AVERAGING && defined (MODULE_MAP_AVERAGING)
 #if !EFI_SHAFT_POSITION_INPUT
@@ -41,13 +43,6 @@
  */
 static NamedOutputPin mapAveragingPin("map");
 
-// allow smoothing up to number of cylinders
-#define MAX_MAP_BUFFER_LENGTH (MAX_CYLINDER_COUNT)
-// in MAP units, not voltage!
-static float averagedMapRunningBuffer[MAX_MAP_BUFFER_LENGTH];
-static int mapMinBufferLength = 0;
-static int averagedMapBufIdx = 0;
-
 
 static void endAveraging(MapAverager* arg);
 
@@ -71,26 +66,66 @@ void startAveraging(mapSampler* s) {
 		action_s::make<endAveraging>(&averager));
 }
 
+// all parties run on the same core, keeping the compiler from reordering sum and counter stores is enough
+static inline void windowBarrier() {
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
 void MapAverager::start(uint8_t cylinderNumber) {
-	chibios_rt::CriticalSectionLocker csl;
+	m_isAveraging = false;
+	windowBarrier();
 
+	// whatever submit() we have preempted belongs to the previous window
+	m_window = m_window + 1;
 	m_counter = 0;
-	m_sum = 0;
-	m_isAveraging = true;
 	m_cylinderNumber = cylinderNumber;
+
+	if (m_function) {
+		m_function->getInputRange(m_minVolts, m_maxVolts);
+	} else {
+		// nothing converts, nothing to average
+		m_minVolts = 0;
+		m_maxVolts = -1;
+	}
+
+	windowBarrier();
+	m_isAveraging = true;
 }
 
-SensorResult MapAverager::submit(float volts) {
-	auto result = m_function ? m_function->convert(volts) : unexpected;
+void MapAverager::submit(float volts) {
+	m_instantVolts = volts;
+
+	// same samples as per-sample conversion would have rejected
+	if (!m_isAveraging || volts < m_minVolts || volts > m_maxVolts) {
+		return;
+	}
 
-	if (m_isAveraging && result) {
-		chibios_rt::CriticalSectionLocker csl;
+	uint32_t window = m_window;
+	uint32_t counter = m_counter;
+	// first sample of a window does not look at the slots, a preempted submit() could have written them
+	float previousSum = counter ? m_sumVolts[counter & 1] : 0;
+	m_sumVolts[(counter + 1) & 1] = previousSum + volts;
+	windowBarrier();
 
-		m_counter++;
-		m_sum += result.Value;
+	// publish only once the new sum is complete, and only into the window it was added to
+	chibios_rt::CriticalSectionLocker csl;
+	if (window == m_window) {
+		m_counter = counter + 1;
 	}
+}
+
+SensorResult MapAverager::getInstant() const {
+	return m_function ? m_function->convert(m_instantVolts) : unexpected;
+}
 
-	return result;
+void MapAverager::setMinBufferLength(int length) {
+	m_bufferLength = maxI(minI(length, MAX_MAP_BUFFER_LENGTH), 1);
+	// reset index
+	m_bufferIdx = 0;
+	// fill with maximum values
+	for (int i = 0; i < m_bufferLength; i++) {
+		m_runningBuffer[i] = FLT_MAX;
+	}
 }
 
 static ExpAverage expAverage;
@@ -102,49 +137,52 @@ float filterMapValue(float value) {
 }
 
 void MapAverager::stop() {
-	chibios_rt::CriticalSectionLocker csl;
-
 	m_isAveraging = false;
+	m_window = m_window + 1;
+	windowBarrier();
 
-	if (m_counter > 0) {
-		float averageMap = m_sum / m_counter;
-		m_lastCounter = m_counter;
-
-		// TODO: this should be per-sensor, not one for all MAP sensors
-		averagedMapRunningBuffer[averagedMapBufIdx] = averageMap;
-		// increment circular running buffer index
-		averagedMapBufIdx = (averagedMapBufIdx + 1) % mapMinBufferLength;
-		// find min. value (only works for pressure values, not raw voltages!)
-		float minPressure = averagedMapRunningBuffer[0];
-		for (int i = 1; i < mapMinBufferLength; i++) {
-			if (averagedMapRunningBuffer[i] < minPressure)
-				minPressure = averagedMapRunningBuffer[i];
-		}
+	// any submit() we have preempted is writing the other slot
+	uint32_t counter = m_counter;
+	float sumVolts = m_sumVolts[counter & 1];
 
-    engine->outputChannels.mapPerCylinder[m_cylinderNumber] = minPressure;
-		setValidValue(filterMapValue(minPressure), getTimeNowNt());
-	} else {
+	if (counter == 0) {
 #if EFI_PROD_CODE
 		warning(ObdCode::CUSTOM_UNEXPECTED_MAP_VALUE, "No MAP values to average");
 #endif
+		return;
+	}
+
+	m_lastCounter = counter;
+
+	SensorResult averageMap = m_function ? m_function->convert(sumVolts / counter) : unexpected;
+	if (!averageMap) {
+		// sensor is out of range, let the value time out
+		return;
+	}
+
+	m_runningBuffer[m_bufferIdx] = averageMap.Value;
+	// increment circular running buffer index
+	m_bufferIdx = (m_bufferIdx + 1) % m_bufferLength;
+	// find min. value (only works for pressure values, not raw voltages!)
+	float minPressure = m_runningBuffer[0];
+	for (int i = 1; i < m_bufferLength; i++) {
+		if (m_runningBuffer[i] < minPressure)
+			minPressure = m_runningBuffer[i];
 	}
+
+	engine->outputChannels.mapPerCylinder[m_cylinderNumber] = minPressure;
+	setValidValue(filterMapValue(minPressure), getTimeNowNt());
 }
 
 #if HAL_USE_ADC
 
-/**
- * This method is invoked from ADC callback.
- * @note This method is invoked OFTEN, this method is a potential bottleneck - the implementation should be
- * as fast as possible
- */
-void mapAveragingAdcCallback(float instantVoltage) {
-	efiAssertVoid(ObdCode::CUSTOM_ERR_6650, hasLotsOfRemainingStack(), "lowstck#9a");
-
-	SensorResult mapResult = getMapAvg(currentMapAverager).submit(instantVoltage);
+static void updateInstantMap() {
+	auto& averager = getMapAvg(currentMapAverager);
+	SensorResult mapResult = averager.getInstant();
 
 	if (!mapResult) {
 		// hopefully this warning is not too much CPU consumption for fast ADC callback
-		warning(ObdCode::CUSTOM_INSTANT_MAP_DECODING, "Invalid MAP at %f", instantVoltage);
+		warning(ObdCode::CUSTOM_INSTANT_MAP_DECODING, "Invalid MAP at %f", averager.getInstantVolts());
 		engine->outputChannels.isMapValid = false;
 	} else {
 		engine->outputChannels.isMapValid = true;
@@ -155,6 +193,22 @@ void mapAveragingAdcCallback(float instantVoltage) {
 	engine->outputChannels.instantMAPValue = instantMap;
 #endif // EFI_TUNER_STUDIO
 }
+
+/**
+ * This method is invoked from ADC callback.
+ * @note This method is invoked OFTEN, this method is a potential bottleneck - the implementation should be
+ * as fast as possible
+ */
+void mapAveragingAdcCallback(float instantVoltage) {
+	efiAssertVoid(ObdCode::CUSTOM_ERR_6650, hasLotsOfRemainingStack(), "lowstck#9a");
+
+	getMapAvg(currentMapAverager).submit(instantVoltage);
+
+	// MAP cam decoder looks at instant MAP at specific teeth, otherwise fast callback rate is plenty
+	if (getTriggerCentral()->isDecodingMapCam) {
+		updateInstantMap();
+	}
+}
 #endif
 
 static void endAveraging(MapAverager* arg) {
@@ -165,17 +219,16 @@ static void endAveraging(MapAverager* arg) {
 }
 
 static void applyMapMinBufferLength() {
-	// check range
-	mapMinBufferLength = maxI(minI(engineConfiguration->mapMinBufferLength, MAX_MAP_BUFFER_LENGTH), 1);
-	// reset index
-	averagedMapBufIdx = 0;
-	// fill with maximum values
-	for (int i = 0; i < mapMinBufferLength; i++) {
-		averagedMapRunningBuffer[i] = FLT_MAX;
-	}
+	// each bank sensor keeps its own buffer
+	getMapAvg(0).setMinBufferLength(engineConfiguration->mapMinBufferLength);
+	getMapAvg(1).setMinBufferLength(engineConfiguration->mapMinBufferLength);
 }
 
 void MapAveragingModule::onFastCallback() {
+#if HAL_USE_ADC
+	updateInstantMap();
+#endif // HAL_USE_ADC
+
 	float rpm = Sensor::getOrZero(SensorType::Rpm);
     MAP_sensor_config_s * c = &engineConfiguration->map;
     angle_t start = interpolate2d(rpm, c->samplingAngleBins, c->samplingAngle);
@@ -8,7 +8,7 @@
 #pragma once
 #include "engine_module.h"
 #include "stored_value_sensor.h"
-#include "sensor_converter_func.h"
+#include "linear_func.h"
 #include "scheduler.h"
 
 /**
@@ -26,12 +26,19 @@ struct mapSampler {
 void mapAveragingAdcCallback(float instantVoltage);
 #endif
 
+#endif /* EFI_MAP_AVERAGING */
+
 // allow smoothing up to number of cylinders
 #define MAX_MAP_BUFFER_LENGTH (MAX_CYLINDER_COUNT)
-#endif /* EFI_MAP_AVERAGING */
 
 #define SAMPLER_DIMENSION 2
 
+/**
+ * Averages MAP within sampling window. Samples are accumulated as raw volts and converted to pressure
+ * once per window, only publishing the sample count takes a lock. Samples outside of converter valid input range are
+ * dropped like per-sample conversion used to, and MAP converter is linear, so average of converted
+ * samples equals converted average of the remaining voltages.
+ */
 class MapAverager : public StoredValueSensor {
 public:
 	MapAverager(SensorType type, efidur_t timeout)
@@ -42,22 +49,49 @@ public:
 	void start(uint8_t cylinderNumber);
 	void stop();
 
-	SensorResult submit(float sensorVolts);
+	/**
+	 * Invoked from fast ADC callback, must not be preempted by another submit().
+	 * start() and stop() may preempt it, the sample is then dropped.
+	 */
+	void submit(float sensorVolts);
+
+	// pressure of the latest submitted sample
+	SensorResult getInstant() const;
 
-	void setFunction(SensorConverter& func) {
+	float getInstantVolts() const {
+		return m_instantVolts;
+	}
+
+	void setFunction(LinearFunc& func) {
 		m_function = &func;
 	}
 
+	// minimum of that many last window averages is reported, see mapMinBufferLength
+	void setMinBufferLength(int length);
+
 	void showInfo(const char* sensorName) const override;
 
 private:
-	SensorConverter* m_function = nullptr;
-
-	bool m_isAveraging = false;
-	size_t m_counter = 0;
+	LinearFunc* m_function = nullptr;
+	// valid input range of m_function, taken at window start
+	float m_minVolts = 0;
+	float m_maxVolts = -1;
+
+	volatile bool m_isAveraging = false;
+	volatile float m_instantVolts = 0;
+	// sum of first N samples lives in m_sumVolts[N % 2], so that the slot matching published
+	// m_counter is never the one being written by submit()
+	volatile uint32_t m_counter = 0;
+	// bumped by start() and stop(), submit() only publishes into the window it has read
+	volatile uint32_t m_window = 0;
+	float m_sumVolts[2] = {};
 	size_t m_lastCounter = 0;
-	float m_sum = 0;
 	uint8_t m_cylinderNumber = 0;
+
+	// in MAP units, not voltage!
+	float m_runningBuffer[MAX_MAP_BUFFER_LENGTH] = {};
+	int m_bufferLength = 1;
+	int m_bufferIdx = 0;
 };
 
 MapAverager& getMapAvg(size_t idx);
@@ -29,3 +29,17 @@ SensorResult LinearFunc::convert(float inputValue) const {
 
 	return result;
 }
+
+void LinearFunc::getInputRange(float& minInput, float& maxInput) const {
+	if (m_a == 0) {
+		bool isValid = m_b >= m_minOutput && m_b <= m_maxOutput;
+		minInput = isValid ? -FLT_MAX : FLT_MAX;
+		maxInput = isValid ? FLT_MAX : -FLT_MAX;
+		return;
+	}
+
+	float in1 = (m_minOutput - m_b) / m_a;
+	float in2 = (m_maxOutput - m_b) / m_a;
+	minInput = std::min(in1, in2);
+	maxInput = std::max(in1, in2);
+}
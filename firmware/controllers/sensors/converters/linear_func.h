@@ -12,6 +12,9 @@ public:
 
 	void showInfo(float testRawValue) const override;
 
+	// inputs for which convert() succeeds, empty range if there are none
+	void getInputRange(float& minInput, float& maxInput) const;
+
 	float getDivideInput() const {
 		return m_divideInput;
 	}
@@ -12,12 +12,12 @@ void ResistanceFunc::configure(float supplyVoltage, float pullupResistor, bool i
 
 SensorResult ResistanceFunc::convert(float raw) const {
 	// If the voltage is very low, the sensor is a dead short.
-	if (raw < 0.05f) {
+	if (raw < getMinVoltage()) {
 		return UnexpectedCode::Low;
 	}
 
 	// If the voltage is very high (98% VCC), the sensor is open circuit.
-	if (raw > (m_supplyVoltage * 0.98f)) {
+	if (raw > getMaxVoltage()) {
 		return UnexpectedCode::High;
 	}
 
@@ -18,6 +18,15 @@ public:
 
 	void showInfo(float testInputValue) const override;
 
+	// Input range outside of which the sensor is considered shorted or open
+	float getMinVoltage() const {
+		return 0.05f;
+	}
+
+	float getMaxVoltage() const {
+		return m_supplyVoltage * 0.98f;
+	}
+
 private:
 	float m_supplyVoltage = 5.0f;
 	float m_pullupResistor = 1000.0f;
@@ -15,6 +15,10 @@ SensorResult ThermistorFunc::convert(float ohms) const {
 		return UnexpectedCode::Low;
 	}
 
+	return checkCelsius(getCelsius(ohms));
+}
+
+float ThermistorFunc::getCelsius(float ohms) const {
 	float lnR = logf(ohms);
 
 	float lnR3 = lnR * lnR * lnR;
@@ -23,8 +27,10 @@ SensorResult ThermistorFunc::convert(float ohms) const {
 
 	float kelvin = 1 / recip;
 
-	float celsius = convertKelvinToCelcius(kelvin);
+	return convertKelvinToCelcius(kelvin);
+}
 
+SensorResult ThermistorFunc::checkCelsius(float celsius) {
 	// bounds check result - please don't try to run rusEFI when colder than -50C
 	// high end limit is required as this could be an oil temp sensor on an
 	// air cooled engine
@@ -75,3 +81,70 @@ void ThermistorFunc::configure(thermistor_conf_s &cfg) {
   	  criticalError("Thermistor configuration has failed 90% test");
 	}
 }
+
+void ThermistorTableFunc::configure() {
+	const auto& resistance = get<resist>();
+	const auto& thermistor = get<therm>();
+
+	// raw within the resistance function range always gives us a positive resistance
+	auto getExactCelsius = [&](float raw) {
+		return thermistor.getCelsius(resistance.convert(raw).Value);
+	};
+	// way past the plausibility limits near shorted/open circuit, those inputs are invalid anyway
+	auto getTableCelsius = [&](float raw) {
+		return clampF(-THERMISTOR_TABLE_LIMIT, getExactCelsius(raw), THERMISTOR_TABLE_LIMIT);
+	};
+
+	m_minVoltage = resistance.getMinVoltage();
+	m_maxVoltage = resistance.getMaxVoltage();
+	float step = (m_maxVoltage - m_minVoltage) / (THERMISTOR_TABLE_SIZE - 1);
+	m_stepsPerVolt = 1 / step;
+
+	for (size_t i = 0; i < THERMISTOR_TABLE_SIZE - 1; i++) {
+		m_celsius[i] = getTableCelsius(m_minVoltage + i * step);
+	}
+	// exactly at the top of the range, no rounding past it
+	m_celsius[THERMISTOR_TABLE_SIZE - 1] = getTableCelsius(m_maxVoltage);
+
+	// interpolation error peaks somewhere inside each segment, probe a few points of each
+	constexpr int probesPerStep = 4;
+	m_maxError = 0;
+	for (size_t i = 0; i < (THERMISTOR_TABLE_SIZE - 1) * probesPerStep; i++) {
+		float raw = m_minVoltage + i * step / probesPerStep;
+		float exact = getExactCelsius(raw);
+
+		if (!ThermistorFunc::checkCelsius(exact).Valid) {
+			continue;
+		}
+
+		m_maxError = std::max(m_maxError, std::abs(interpolate(raw) - exact));
+	}
+
+	m_isConfigured = true;
+}
+
+float ThermistorTableFunc::interpolate(float raw) const {
+	float position = (raw - m_minVoltage) * m_stepsPerVolt;
+	size_t index = std::min((size_t)position, (size_t)THERMISTOR_TABLE_SIZE - 2);
+	float frac = position - index;
+
+	float low = m_celsius[index];
+	return low + frac * (m_celsius[index + 1] - low);
+}
+
+SensorResult ThermistorTableFunc::convert(float raw) const {
+	if (!m_isConfigured) {
+		return m_exact.convert(raw);
+	}
+
+	// same shorted/open circuit limits as the resistance function
+	if (raw < m_minVoltage) {
+		return UnexpectedCode::Low;
+	}
+
+	if (raw > m_maxVoltage) {
+		return UnexpectedCode::High;
+	}
+
+	return ThermistorFunc::checkCelsius(interpolate(raw));
+}
@@ -20,6 +20,12 @@ public:
 
 	void showInfo(float testRawValue) const override;
 
+	// Steinhart-Hart result without any validation, ohms must be positive
+	float getCelsius(float ohms) const;
+
+	// Plausibility check of a computed temperature
+	static SensorResult checkCelsius(float celsius);
+
 	// Steinhart-Hart coefficients
 	float m_a = 0;
 	float m_b = 0;
@@ -29,4 +35,58 @@ public:
 using resist = ResistanceFunc;
 using therm = ThermistorFunc;
 
-typedef FuncChain<resist, therm> thermistor_t;
+// about 1 deg C worst case up to CLT_UPPER_VALIDATION_LIMIT, under 0.3 deg C from -40 to 150 C
+#define THERMISTOR_TABLE_SIZE 256
+// table holds 0.02 deg C steps, clamped to what int16 can hold
+#define THERMISTOR_TABLE_LIMIT 600
+
+/**
+ * Voltage to temperature through ResistanceFunc and ThermistorFunc, sampled once at configure()
+ * time into a table evenly spaced in input voltage. Per sample that leaves a linear
+ * interpolation instead of a division, a logarithm and another division.
+ *
+ * Configure both functions via get<>() then call configure(). Until then the exact chain is used.
+ */
+class ThermistorTableFunc final : public SensorConverter {
+public:
+	SensorResult convert(float raw) const override;
+
+	void configure();
+
+	void showInfo(float testRawValue) const override;
+
+	template <typename TGet>
+	TGet &get() {
+		return m_exact.template get<TGet>();
+	}
+
+	template <typename TGet>
+	TGet *getPtr() {
+		return m_exact.template getPtr<TGet>();
+	}
+
+	// The exact conversion which the table approximates
+	SensorResult convertExact(float raw) const {
+		return m_exact.convert(raw);
+	}
+
+	// Worst difference from the exact conversion found at configure(), deg C, over inputs with a plausible temperature
+	float getMaxError() const {
+		return m_maxError;
+	}
+
+private:
+	// raw must be within the table range
+	float interpolate(float raw) const;
+
+	FuncChain<resist, therm> m_exact;
+
+	bool m_isConfigured = false;
+	float m_minVoltage = 0;
+	float m_maxVoltage = 0;
+	float m_stepsPerVolt = 0;
+	float m_maxError = 0;
+	scaled_channel<int16_t, 50> m_celsius[THERMISTOR_TABLE_SIZE]{};
+};
+
+typedef ThermistorTableFunc thermistor_t;
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "auto_generated_sensor.h"
+#include "sensor_snapshot.h"
 
 // This struct represents one sensor in the registry.
 // It stores whether the sensor should use a mock value,
@@ -176,6 +177,13 @@ void Sensor::unregister() {
  * @returns NotNull: sensor result or UnexpectedCode::Configuration if sensor is not registered
  */
 /*static*/ SensorResult Sensor::get(SensorType type) {
+	// Hot path of fast callback reads consistent values captured at the start of tick
+	const auto snapshot = getActiveSensorSnapshot();
+	SensorResult snapshotResult = UnexpectedCode::Unknown;
+	if (snapshot && snapshot->tryGet(type, snapshotResult)) {
+		return snapshotResult;
+	}
+
 	const auto entry = getEntryForType(type);
 
 	// Check if this is a valid sensor entry
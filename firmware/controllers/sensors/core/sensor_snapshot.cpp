@@ -0,0 +1,137 @@
+/**
+ * @file    sensor_snapshot.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "sensor_snapshot.h"
+
+#include <atomic>
+
+// single core MCU: compiler barrier is enough to keep stores/loads on the right side of sequence update
+static inline void sequenceBarrier() {
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+void SensorSnapshot::capture() {
+	m_sequence = m_sequence + 1;
+	sequenceBarrier();
+
+	for (size_t i = 0; i < size; i++) {
+		SensorResult result = Sensor::get(static_cast<SensorType>(i));
+		SensorSnapshotEntry &entry = m_values[i];
+		entry.Valid = result.Valid;
+		if (result.Valid) {
+			entry.Value = result.Value;
+		} else {
+			entry.Code = result.Code;
+		}
+	}
+
+	sequenceBarrier();
+	m_sequence = m_sequence + 1;
+}
+
+bool SensorSnapshot::readBegin(uint32_t &sequence) const {
+	sequence = m_sequence;
+	sequenceBarrier();
+	// odd: writer is in the middle of capture
+	return (sequence & 1) == 0;
+}
+
+bool SensorSnapshot::readRetry(uint32_t sequence) const {
+	sequenceBarrier();
+	return m_sequence != sequence;
+}
+
+bool SensorSnapshot::tryGet(SensorType type, SensorResult &result) const {
+	size_t index = static_cast<size_t>(type);
+	if (index >= size) {
+		return false;
+	}
+
+	for (int attempt = 0; attempt < maxReadAttempts; attempt++) {
+		uint32_t sequence;
+		if (!readBegin(sequence)) {
+			continue;
+		}
+
+		SensorSnapshotEntry entry = m_values[index];
+
+		if (!readRetry(sequence)) {
+			result = entry.toResult();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static SensorSnapshot sensorSnapshot;
+
+SensorSnapshot& getSensorSnapshot() {
+	return sensorSnapshot;
+}
+
+static const SensorSnapshot *activeSnapshot = nullptr;
+static bool snapshotEnabled = true;
+#if !EFI_UNIT_TEST
+static thread_t *snapshotOwner = nullptr;
+#endif
+
+const SensorSnapshot *getActiveSensorSnapshot() {
+	const SensorSnapshot *snapshot = activeSnapshot;
+	if (!snapshot) {
+		return nullptr;
+	}
+
+#if EFI_PROD_CODE
+	// interrupts keep reading live values
+	if (port_is_isr_context()) {
+		return nullptr;
+	}
+#endif
+
+#if !EFI_UNIT_TEST
+	// as well as other threads
+	if (chThdGetSelfX() != snapshotOwner) {
+		return nullptr;
+	}
+#endif
+
+	return snapshot;
+}
+
+/*static*/ void SensorSnapshotScope::setEnabled(bool enabled) {
+	snapshotEnabled = enabled;
+}
+
+SensorSnapshotScope::SensorSnapshotScope() {
+	// nested scope keeps outer snapshot
+	if (!snapshotEnabled || activeSnapshot) {
+		return;
+	}
+
+#if EFI_PROD_CODE
+	// interrupts are never served from snapshot, see getActiveSensorSnapshot()
+	if (port_is_isr_context()) {
+		return;
+	}
+#endif
+
+	sensorSnapshot.capture();
+
+#if !EFI_UNIT_TEST
+	snapshotOwner = chThdGetSelfX();
+#endif
+	activeSnapshot = &sensorSnapshot;
+	m_active = true;
+}
+
+SensorSnapshotScope::~SensorSnapshotScope() {
+	if (m_active) {
+		activeSnapshot = nullptr;
+	}
+}
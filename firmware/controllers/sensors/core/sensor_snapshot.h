@@ -0,0 +1,83 @@
+/**
+ * @file    sensor_snapshot.h
+ * @brief Consistent copy of all sensor readings, taken once per fast tick
+ *
+ * Fuel and spark math reads a dozen of sensors per tick, each going through registry entry,
+ * mock check and virtual get(), while ADC/CAN threads may update them in the middle of computation.
+ * Snapshot copies results of all registry entries into a flat array once, and while SensorSnapshotScope
+ * is alive Sensor::get() on the owner thread is served from that array.
+ *
+ * Array is guarded by a sequence lock. A reader which catches capture in progress retries a few times and
+ * then falls back to the live registry, so a reader preempting the writer can not spin forever.
+ *
+ * Capture is only taken in thread context: interrupts are not routed to the snapshot, so capture from
+ * an ISR would never be read.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include "sensor.h"
+
+struct SensorSnapshotEntry {
+	float Value;
+	UnexpectedCode Code;
+	bool Valid;
+
+	SensorResult toResult() const {
+		if (Valid) {
+			return Value;
+		}
+		return Code;
+	}
+};
+
+class SensorSnapshot {
+public:
+	// Writer side, copy current readings of all sensors
+	void capture();
+
+	// Single reading from last capture, false if capture is in progress or type is out of range
+	bool tryGet(SensorType type, SensorResult &result) const;
+
+	uint32_t getCaptureCounter() const {
+		return m_sequence / 2;
+	}
+
+	static constexpr size_t size = static_cast<size_t>(SensorType::PlaceholderLast);
+	// reader gives up after this many attempts
+	static constexpr int maxReadAttempts = 4;
+
+private:
+	bool readBegin(uint32_t &sequence) const;
+	bool readRetry(uint32_t sequence) const;
+
+#ifdef EFI_UNIT_TEST
+public:
+#endif
+	// odd while capture is in progress
+	volatile uint32_t m_sequence = 0;
+
+	alignas(32) SensorSnapshotEntry m_values[size];
+};
+
+SensorSnapshot& getSensorSnapshot();
+
+/**
+ * Captures the snapshot and routes Sensor::get() of current thread to it until destroyed.
+ */
+class SensorSnapshotScope {
+public:
+	SensorSnapshotScope();
+	~SensorSnapshotScope();
+
+	// for A/B comparison against live registry reads
+	static void setEnabled(bool enabled);
+
+private:
+	bool m_active = false;
+};
+
+// nullptr unless some SensorSnapshotScope is alive
+const SensorSnapshot *getActiveSensorSnapshot();
@@ -16,14 +16,11 @@
 #define COMPRESSED_SPECTRUM_PROTOCOL_SIZE 16 // 16 * 4 = 64 byte for transport to TS
 #define START_SPECTRORGAM_FREQUENCY 4000 // magic minimum Hz for draw spectrogram, use near value +next 64 freqs from fft
 
-static size_t spectrogramStartIndex = 0;
-static SpectrogramData spectrogramData0;
-static SpectrogramData* spectrogramData = &spectrogramData0;
+static_assert(sizeof(SpectrogramData) <= BIG_BUFFER_SPECTROGRAM_SIZE);
 
-// TODO: use big_buffer
-//static volatile bool enableKnockSpectrogram = false;
-//static BigBufferHandle buffer;
-//static SpectrogramData* spectrogramData = nullptr;
+static size_t spectrogramStartIndex = 0;
+static BigBufferHandle spectrogramBuffer;
+static SpectrogramData* spectrogramData = nullptr;
 #endif //KNOCK_SPECTROGRAM
 
 
@@ -104,15 +101,20 @@ void initSoftwareKnock() {
 		knockFilter.configureBandpass(KNOCK_SAMPLE_RATE, frequencyHz, 3);
 
 	#ifdef KNOCK_SPECTROGRAM
+		// give back block from previous init, one block per user
+		spectrogramData = nullptr;
+		spectrogramBuffer = {};
+
 		if (engineConfiguration->enableKnockSpectrogram) {
+			spectrogramBuffer = getBigBuffer(BigBufferUser::KnockSpectrogram, sizeof(SpectrogramData));
+			if (!spectrogramBuffer) {
+				// knock detection itself still works, spectrogram stays empty until space is available on next init
+				warning(ObdCode::CUSTOM_ERR_BUFF_INIT_ERROR, "Knock spectrogram: no big buffer space");
+			}
+		}
 
-			// TODO: use big buffer
-			//buffer = getBigBuffer(BigBufferUser::KnockSpectrogram);
-			// if (!buffer) {
-			// 	engineConfiguration->enableKnockSpectrogram = false;
-			//  	return;
-			//  }
-			//spectrogramData = buffer.get<SpectrogramData>();
+		if (spectrogramBuffer) {
+			spectrogramData = spectrogramBuffer.get<SpectrogramData>();
 
 			fft::blackmanharris(spectrogramData->window, FFT_SIZE, true);
 
@@ -199,7 +201,7 @@ static void processLastKnockEvent() {
 	knockNeedsProcess = false;
 
 #ifdef KNOCK_SPECTROGRAM
-	if (engineConfiguration->enableKnockSpectrogram) {
+	if (engineConfiguration->enableKnockSpectrogram && spectrogramData) {
 		ScopePerf perf(PE::KnockAnalyzer);
 
 		if (engineConfiguration->enableKnockSpectrogramFilter) {
@@ -100,6 +100,13 @@ void ThermistorFunc::showInfo(float testInputValue) const {
 	efiPrintf("    %.1f ohms -> valid: %s. %.1f deg C", testInputValue, boolToString(value.Valid), value.Value);
 }
 
+void ThermistorTableFunc::showInfo(float testInputValue) const {
+	const auto value = convert(testInputValue);
+	efiPrintf("    Thermistor table %d points, worst error %.2f deg C: %.2f volts -> valid: %s. %.1f deg C",
+		THERMISTOR_TABLE_SIZE, m_maxError, testInputValue, boolToString(value.Valid), value.Value);
+	m_exact.showInfo(testInputValue);
+}
+
 void IdentityFunction::showInfo(float /*testInputValue*/) const {
 	efiPrintf("    Identity function passes along value.");
 }
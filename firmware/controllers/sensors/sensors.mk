@@ -5,6 +5,7 @@ CONTROLLERS_SENSORS_SRC_CPP = \
 	$(PROJECT_DIR)/controllers/sensors/core/functional_sensor.cpp \
 	$(PROJECT_DIR)/controllers/sensors/core/fuel_level_sensor.cpp \
 	$(PROJECT_DIR)/controllers/sensors/core/sensor.cpp \
+	$(PROJECT_DIR)/controllers/sensors/core/sensor_snapshot.cpp \
  	$(PROJECT_DIR)/controllers/sensors/thermistors.cpp \
 	$(PROJECT_DIR)/controllers/sensors/allsensors.cpp \
 	$(PROJECT_DIR)/controllers/sensors/auto_generated_sensor.cpp \
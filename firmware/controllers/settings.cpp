@@ -17,6 +17,7 @@
 #include "alternator_controller.h"
 #include "trigger_emulator_algo.h"
 #include "value_lookup.h"
+#include "tunerstudio.h"
 #if EFI_RTC
 #include "rtc_helper.h"
 #endif // EFI_RTC
@@ -629,6 +630,10 @@ static void setValue(const char *paramStr, const char *valueStr) {
 	bool isGoodName = setConfigValueByName(paramStr, valueF);
     if (isGoodName) {
        efiPrintf("Settings: applying [%s][%f]", paramStr, valueF);
+#if EFI_TUNER_STUDIO
+       // field is not known here, TS page CRC is computed again from scratch
+       onConfigurationAreaChanged(config, sizeof(persistent_config_s));
+#endif // EFI_TUNER_STUDIO
     }
 
 	engine->resetEngineSnifferIfInTestMode();
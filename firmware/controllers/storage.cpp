@@ -24,7 +24,12 @@ bool storageAllowWriteID(StorageItemId id)
 {
 #if (EFI_STORAGE_INT_FLASH == TRUE) || defined(EFI_UNIT_TEST)
 	if ((id == EFI_SETTINGS_RECORD_ID) ||
-		(id == EFI_SETTINGS_BACKUP_RECORD_ID)) {
+		(id == EFI_SETTINGS_BACKUP_RECORD_ID)
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+		// journal keeps LTFT in internal flash too
+		|| (id == EFI_LTFT_RECORD_ID)
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+		) {
 		// special case, settings can be stored in internal flash
 
 		// writing internal flash can cause cpu freeze
@@ -356,6 +361,15 @@ static void storageManagerThread(void*) {
 				pendingWrites &= ~BIT(id);
 			}
 		}
+
+		// let storages compact/cleanup when there is nothing pending
+		if (pendingWrites == 0) {
+			for_all_storages {
+				if (storage->isReady()) {
+					storage->maintenance();
+				}
+			}
+		}
 	}
 }
 
@@ -32,6 +32,8 @@ public:
 	virtual StorageStatus read(size_t id, uint8_t *ptr, size_t size) = 0;
 	/* format/esare storage */
 	virtual StorageStatus format() = 0;
+	/* background housekeeping, called periodically from storage manager thread */
+	virtual void maintenance() {}
 };
 
 enum StorageType {
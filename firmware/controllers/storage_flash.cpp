@@ -15,6 +15,61 @@
 #include "mpu_util.h"
 #include "flash_int.h"
 
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+#include "flash_journal.h"
+
+#if EFI_ACTIVE_CONFIGURATION_IN_FLASH
+#error "EFI_STORAGE_INT_FLASH_JOURNAL does not keep raw configuration image in flash"
+#endif
+
+#ifndef EFI_STORAGE_INT_FLASH_JOURNAL_BANK_SIZE
+#define EFI_STORAGE_INT_FLASH_JOURNAL_BANK_SIZE	(128 * 1024)
+#endif
+
+// flash word on H7 is 256 bits and can be programmed only once
+#ifdef STM32H7XX
+#define FLASH_JOURNAL_WRITE_ALIGNMENT	32
+#else
+#define FLASH_JOURNAL_WRITE_ALIGNMENT	8
+#endif
+
+class FlashJournalMediaInt : public FlashJournalMedia {
+public:
+	size_t getBankSize() override {
+		return EFI_STORAGE_INT_FLASH_JOURNAL_BANK_SIZE;
+	}
+
+	size_t getWriteAlignment() override {
+		return FLASH_JOURNAL_WRITE_ALIGNMENT;
+	}
+
+	bool erase(size_t bank) override {
+		return intFlashErase(getBankAddress(bank), getBankSize()) == FLASH_RETURN_SUCCESS;
+	}
+
+	bool write(size_t bank, size_t offset, const uint8_t *ptr, size_t size) override {
+		return intFlashWrite(getBankAddress(bank) + offset, (const char *)ptr, size) == FLASH_RETURN_SUCCESS;
+	}
+
+	bool read(size_t bank, size_t offset, uint8_t *ptr, size_t size) override {
+		return intFlashRead(getBankAddress(bank) + offset, (char *)ptr, size) == FLASH_RETURN_SUCCESS;
+	}
+
+private:
+	flashaddr_t getBankAddress(size_t bank) {
+		return (bank == 0) ? getFlashAddrFirstCopy() : getFlashAddrSecondCopy();
+	}
+};
+
+static FlashJournalMediaInt journalMedia;
+static FlashJournal journal(journalMedia);
+
+// journal needs both sectors, single sector MCUs keep legacy raw layout
+static bool useJournal() {
+	return getFlashAddrSecondCopy() != 0;
+}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 class SettingStorageFlash : public SettingStorageBase {
 public:
 	bool isReady() override;
@@ -22,9 +77,13 @@ public:
 	StorageStatus store(size_t id, const uint8_t *ptr, size_t size) override;
 	StorageStatus read(size_t id, uint8_t *ptr, size_t size) override;
 	StorageStatus format() override;
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	void maintenance() override;
+#endif
 
 private:
 	flashaddr_t getIdAddress(size_t id);
+	StorageStatus storeRaw(flashaddr_t addr, const uint8_t *ptr, size_t size);
 };
 
 flashaddr_t SettingStorageFlash::getIdAddress(size_t id) {
@@ -42,10 +101,51 @@ bool SettingStorageFlash::isReady() {
 }
 
 bool SettingStorageFlash::isIdSupported(size_t id) {
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	if (useJournal()) {
+		// journal has its own redundancy, backup copy is needed only to read legacy layout
+		return (id == EFI_SETTINGS_RECORD_ID) || (id == EFI_LTFT_RECORD_ID) ||
+			((id == EFI_SETTINGS_BACKUP_RECORD_ID) && !journal.isFormatted());
+	}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 	return (getIdAddress(id) != 0);
 }
 
 StorageStatus SettingStorageFlash::store(size_t id, const uint8_t *ptr, size_t size) {
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	if (useJournal()) {
+		if (!isIdSupported(id) || (id == EFI_SETTINGS_BACKUP_RECORD_ID)) {
+			return StorageStatus::NotSupported;
+		}
+
+		efiPrintf("Flash: Journaling storage ID %d ... %d bytes", id, size);
+		efitick_t startNt = getTimeNowNt();
+		uint32_t compactions = journal.getCompactionCounter();
+		uint32_t bytesWritten = journal.getBytesWritten();
+
+		// store may end up compacting and erasing a whole sector
+		if (!mcuCanFlashWhileRunning()) {
+			startWatchdog(WATCHDOG_FLASH_TIMEOUT_MS);
+		}
+
+		StorageStatus status = journal.store(id, ptr, size);
+
+		if (!mcuCanFlashWhileRunning()) {
+			startWatchdog();
+		}
+
+		int elapsed_Ms = US2MS(NT2US(getTimeNowNt() - startNt));
+		efiPrintf("Flash: Journal %s after %d mS, %lu bytes written%s, %d bytes used",
+			(status == StorageStatus::Ok) ? "done" : "FAILED", elapsed_Ms,
+			journal.getBytesWritten() - bytesWritten,
+			(journal.getCompactionCounter() != compactions) ? " with compaction" : "",
+			journal.getUsedBytes());
+
+		return status;
+	}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 	flashaddr_t addr = getIdAddress(id);
 
 	if (addr == 0) {
@@ -53,6 +153,11 @@ StorageStatus SettingStorageFlash::store(size_t id, const uint8_t *ptr, size_t s
 	}
 
 	efiPrintf("Flash: Writing storage ID %d  @0x%x... %d bytes", id, addr, size);
+
+	return storeRaw(addr, ptr, size);
+}
+
+StorageStatus SettingStorageFlash::storeRaw(flashaddr_t addr, const uint8_t *ptr, size_t size) {
 	efitick_t startNt = getTimeNowNt();
 
 	if (!mcuCanFlashWhileRunning()) {
@@ -91,6 +196,24 @@ StorageStatus SettingStorageFlash::store(size_t id, const uint8_t *ptr, size_t s
 }
 
 StorageStatus SettingStorageFlash::read(size_t id, uint8_t *ptr, size_t size) {
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	if (useJournal()) {
+		if (!isIdSupported(id)) {
+			return StorageStatus::NotSupported;
+		}
+
+		StorageStatus status = journal.read(id, ptr, size);
+		if ((status != StorageStatus::NotFound) || (id == EFI_LTFT_RECORD_ID) || journal.isFormatted()) {
+			return status;
+		}
+
+		// No journal yet, read legacy raw copy. First store formats journal in the sector of the other copy,
+		// so the copy we have used last stays readable until journal is committed. If it was the backup one,
+		// the first copy has failed validation anyway.
+		journal.setInitialBank((id == EFI_SETTINGS_RECORD_ID) ? 1 : 0);
+	}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 	flashaddr_t addr = getIdAddress(id);
 
 	if (addr == 0) {
@@ -107,11 +230,44 @@ StorageStatus SettingStorageFlash::read(size_t id, uint8_t *ptr, size_t size) {
 }
 
 StorageStatus SettingStorageFlash::format() {
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+	if (useJournal()) {
+		return journal.format();
+	}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 	/* TODO: actually erase settings erea(s)? */
 
 	return StorageStatus::NotSupported;
 }
 
+#if EFI_STORAGE_INT_FLASH_JOURNAL
+void SettingStorageFlash::maintenance() {
+	if (!useJournal() || !journal.needsCompaction()) {
+		return;
+	}
+
+	// same rules as for settings write, compaction erases a sector
+	if (!storageAllowWriteID(EFI_SETTINGS_RECORD_ID)) {
+		return;
+	}
+
+	efiPrintf("Flash: Compacting journal, %d bytes used", journal.getUsedBytes());
+
+	if (!mcuCanFlashWhileRunning()) {
+		startWatchdog(WATCHDOG_FLASH_TIMEOUT_MS);
+	}
+
+	StorageStatus status = journal.compact();
+
+	if (!mcuCanFlashWhileRunning()) {
+		startWatchdog();
+	}
+
+	efiPrintf("Flash: Compaction %s, %d bytes used", (status == StorageStatus::Ok) ? "done" : "FAILED", journal.getUsedBytes());
+}
+#endif // EFI_STORAGE_INT_FLASH_JOURNAL
+
 static SettingStorageFlash storageFlash;
 
 bool initStorageFlash() {
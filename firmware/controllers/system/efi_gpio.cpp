@@ -20,6 +20,10 @@
 #include "electronic_throttle.h"
 #endif /* EFI_ELECTRONIC_THROTTLE_BODY */
 
+#if EFI_OUTPUT_EDGE_LATENCY
+#include "edge_latency.h"
+#endif // EFI_OUTPUT_EDGE_LATENCY
+
 // todo: clean this mess, this should become 'static'/private
 EnginePins enginePins;
 
@@ -504,6 +508,9 @@ IgnitionOutputPin::IgnitionOutputPin() {
 
 void IgnitionOutputPin::setHigh() {
 	NamedOutputPin::setHigh();
+#if EFI_OUTPUT_EDGE_LATENCY
+	edgeLatencyRecordCoil(coilIndex);
+#endif // EFI_OUTPUT_EDGE_LATENCY
 	// this is NASTY but what's the better option? bytes? At cost of 22 extra bytes in output status packet?
 	switch (coilIndex) {
 	case 0:
@@ -529,6 +536,9 @@ void IgnitionOutputPin::setHigh() {
 
 void IgnitionOutputPin::setLow() {
 	NamedOutputPin::setLow();
+#if EFI_OUTPUT_EDGE_LATENCY
+	edgeLatencyRecordCoil(coilIndex);
+#endif // EFI_OUTPUT_EDGE_LATENCY
 	// this is NASTY but what's the better option? bytes? At cost of 22 extra bytes in output status packet?
 	switch (coilIndex) {
 	case 0:
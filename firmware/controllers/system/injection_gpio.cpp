@@ -4,6 +4,8 @@
 
 #include "pch.h"
 
+#include "edge_latency.h"
+
 extern bool printFuelDebug;
 
 void startSimultaneousInjection() {
@@ -85,6 +87,9 @@ void InjectorOutputPin::close(efitick_t nowNt) {
 
 void InjectorOutputPin::setHigh() {
     NamedOutputPin::setHigh();
+#if EFI_OUTPUT_EDGE_LATENCY
+	edgeLatencyRecordInjector(injectorIndex);
+#endif // EFI_OUTPUT_EDGE_LATENCY
     TunerStudioOutputChannels *state = getTunerStudioOutputChannels();
 	// this is NASTY but what's the better option? bytes? At cost of 22 extra bytes in output status packet?
 	switch (injectorIndex) {
@@ -111,6 +116,9 @@ void InjectorOutputPin::setHigh() {
 
 void InjectorOutputPin::setLow() {
     NamedOutputPin::setLow();
+#if EFI_OUTPUT_EDGE_LATENCY
+	edgeLatencyRecordInjector(injectorIndex);
+#endif // EFI_OUTPUT_EDGE_LATENCY
     TunerStudioOutputChannels *state = getTunerStudioOutputChannels();
 	// this is NASTY but what's the better option? bytes? At cost of 22 extra bytes in output status packet?
 	switch (injectorIndex) {
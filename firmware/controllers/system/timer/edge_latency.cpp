@@ -0,0 +1,176 @@
+/**
+ * @file    edge_latency.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "edge_latency.h"
+
+#if EFI_OUTPUT_EDGE_LATENCY
+
+static EdgeLatencyReport report;
+
+static efitick_t executingMomentNt = 0;
+static bool isExecutingEvent = false;
+
+size_t EdgeLatency::getBucketIndex(efidur_t lateNt) {
+	if (lateNt < US2NT(1)) {
+		return 0;
+	}
+
+	uint32_t lateUs = (lateNt > US2NT(1 << EDGE_LATENCY_BUCKETS)) ? (1 << EDGE_LATENCY_BUCKETS) : NT2US(lateNt);
+	// index of the highest set bit, plus one
+	size_t index = 32 - __builtin_clz(lateUs);
+	return std::min(index, (size_t)EDGE_LATENCY_BUCKETS - 1);
+}
+
+static int32_t clampToInt32(efidur_t value) {
+	return (int32_t)std::clamp<efidur_t>(value, INT32_MIN, INT32_MAX);
+}
+
+void EdgeLatency::record(efidur_t lateNt) {
+	int32_t late32 = clampToInt32(lateNt);
+
+	if (count == 0) {
+		minNt = maxNt = late32;
+	} else {
+		minNt = std::min(minNt, late32);
+		maxNt = std::max(maxNt, late32);
+	}
+
+	count++;
+	sumNt += lateNt;
+
+	uint16_t &bucket = buckets[getBucketIndex(lateNt)];
+	if (bucket != UINT16_MAX) {
+		bucket++;
+	}
+}
+
+void EdgeLatency::reset() {
+	sumNt = 0;
+	count = 0;
+	minNt = 0;
+	maxNt = 0;
+	reserved = 0;
+	for (size_t i = 0; i < efi::size(buckets); i++) {
+		buckets[i] = 0;
+	}
+}
+
+float EdgeLatency::getMeanUs() const {
+	if (count == 0) {
+		return 0;
+	}
+
+	return NT2US((float)sumNt / count);
+}
+
+ScheduledEventScope::ScheduledEventScope(efitick_t momentNt)
+	: m_previousMomentNt(executingMomentNt)
+	, m_previousActive(isExecutingEvent)
+{
+	executingMomentNt = momentNt;
+	isExecutingEvent = true;
+
+	report.queue.record(getTimeNowNt() - momentNt);
+}
+
+ScheduledEventScope::~ScheduledEventScope() {
+	executingMomentNt = m_previousMomentNt;
+	isExecutingEvent = m_previousActive;
+}
+
+static void recordOutput(EdgeLatency *outputs, int8_t index) {
+	// pins toggled outside of the queue (bench test, simultaneous cranking priming) are not scheduled edges
+	if (!isExecutingEvent || index < 0 || index >= MAX_CYLINDER_COUNT) {
+		return;
+	}
+
+	outputs[index].record(getTimeNowNt() - executingMomentNt);
+}
+
+void edgeLatencyRecordInjector(int8_t injectorIndex) {
+	recordOutput(report.injectors, injectorIndex);
+}
+
+void edgeLatencyRecordCoil(int8_t coilIndex) {
+	recordOutput(report.coils, coilIndex);
+}
+
+EdgeLatencyReport& getEdgeLatencyReport() {
+	report.ticksPerUs = US_TO_NT_MULTIPLIER;
+	report.outputCount = MAX_CYLINDER_COUNT;
+	return report;
+}
+
+void resetEdgeLatency() {
+	chibios_rt::CriticalSectionLocker csl;
+
+	report.queue.reset();
+	for (size_t i = 0; i < MAX_CYLINDER_COUNT; i++) {
+		report.injectors[i].reset();
+		report.coils[i].reset();
+	}
+}
+
+static const EdgeLatency& getWorst(const EdgeLatency *outputs) {
+	const EdgeLatency *worst = &outputs[0];
+	for (size_t i = 1; i < engineConfiguration->cylindersCount; i++) {
+		if (outputs[i].maxNt > worst->maxNt) {
+			worst = &outputs[i];
+		}
+	}
+	return *worst;
+}
+
+void reportEdgeLatencyToTS() {
+#if EFI_TUNER_STUDIO
+	const EdgeLatency &injector = getWorst(report.injectors);
+	const EdgeLatency &coil = getWorst(report.coils);
+
+	engine->outputChannels.edgeLatencyInjectorMax = NT2US((float)injector.maxNt);
+	engine->outputChannels.edgeLatencyInjectorMean = injector.getMeanUs();
+	engine->outputChannels.edgeLatencyCoilMax = NT2US((float)coil.maxNt);
+	engine->outputChannels.edgeLatencyCoilMean = coil.getMeanUs();
+	engine->outputChannels.edgeLatencyQueueMax = NT2US((float)report.queue.maxNt);
+	engine->outputChannels.edgeLatencyQueueMean = report.queue.getMeanUs();
+#endif /* EFI_TUNER_STUDIO */
+}
+
+static void printEdgeLatency(const char *name, int index, const EdgeLatency &stats) {
+	static_assert(EDGE_LATENCY_BUCKETS == 12);
+
+	if (stats.count == 0) {
+		return;
+	}
+
+	efiPrintf("%s%d: %d edges, late min %.1f max %.1f mean %.2f us",
+		name, index, (int)stats.count,
+		NT2US((float)stats.minNt), NT2US((float)stats.maxNt), stats.getMeanUs());
+	efiPrintf("  <1us %d, <2 %d, <4 %d, <8 %d, <16 %d, <32 %d, <64 %d, <128 %d, <256 %d, <512 %d, <1024 %d, more %d",
+		stats.buckets[0], stats.buckets[1], stats.buckets[2], stats.buckets[3],
+		stats.buckets[4], stats.buckets[5], stats.buckets[6], stats.buckets[7],
+		stats.buckets[8], stats.buckets[9], stats.buckets[10], stats.buckets[11]);
+}
+
+static void printEdgeLatencies() {
+	printEdgeLatency("queue", 0, report.queue);
+	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+		printEdgeLatency("injector", i + 1, report.injectors[i]);
+	}
+	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+		printEdgeLatency("coil", i + 1, report.coils[i]);
+	}
+}
+
+void initEdgeLatency() {
+	resetEdgeLatency();
+
+	addConsoleAction("edgelatency", printEdgeLatencies);
+	addConsoleAction("reset_edgelatency", resetEdgeLatency);
+}
+
+#endif /* EFI_OUTPUT_EDGE_LATENCY */
@@ -0,0 +1,68 @@
+/**
+ * @file    edge_latency.h
+ * @brief   Scheduled vs actual time of injector and coil edges
+ *
+ * Event queue publishes target moment of the action being executed, outputs toggled from that
+ * action record how late they are compared to it.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+// bucket 0 is on time (less than 1us late, or early), bucket N is [2^(N-1), 2^N) us late,
+// last bucket collects everything above
+#define EDGE_LATENCY_BUCKETS 12
+
+struct EdgeLatency {
+	void record(efidur_t lateNt);
+	void reset();
+
+	float getMeanUs() const;
+
+	static size_t getBucketIndex(efidur_t lateNt);
+
+	// layout is sent as is by TS_GET_EDGE_LATENCY
+	int64_t sumNt;
+	uint32_t count;
+	int32_t minNt;
+	int32_t maxNt;
+	uint32_t reserved;
+	// saturating
+	uint16_t buckets[EDGE_LATENCY_BUCKETS];
+};
+
+static_assert(sizeof(EdgeLatency) == 48);
+
+struct EdgeLatencyReport {
+	uint32_t ticksPerUs;
+	uint32_t outputCount;
+	// lateness of every event queue action
+	EdgeLatency queue;
+	EdgeLatency injectors[MAX_CYLINDER_COUNT];
+	EdgeLatency coils[MAX_CYLINDER_COUNT];
+};
+
+/**
+ * Marks event queue action being executed, restores outer one on exit so nested queues work
+ */
+class ScheduledEventScope {
+public:
+	explicit ScheduledEventScope(efitick_t momentNt);
+	~ScheduledEventScope();
+
+private:
+	const efitick_t m_previousMomentNt;
+	const bool m_previousActive;
+};
+
+void edgeLatencyRecordInjector(int8_t injectorIndex);
+void edgeLatencyRecordCoil(int8_t coilIndex);
+
+EdgeLatencyReport& getEdgeLatencyReport();
+void resetEdgeLatency();
+
+// worst injector, coil and queue latency into edgeLatency* output channels
+void reportEdgeLatencyToTS();
+
+void initEdgeLatency();
@@ -15,6 +15,7 @@
 
 #include "event_queue.h"
 #include "efitime.h"
+#include "edge_latency.h"
 
 #ifndef EFI_UNIT_TEST_VERBOSE_ACTION
 #define EFI_UNIT_TEST_VERBOSE_ACTION 0
@@ -261,6 +262,10 @@ extern bool unitTestBusyWaitHack;
 		UNIT_TEST_BUSY_WAIT_CALLBACK();
 	}
 
+#if EFI_OUTPUT_EDGE_LATENCY
+	efitick_t momentNt = current->getMomentNt();
+#endif // EFI_OUTPUT_EDGE_LATENCY
+
 	// step the head forward, unlink this element, clear scheduled flag
 	m_head = current->next;
 	current->next = nullptr;
@@ -278,6 +283,10 @@ extern bool unitTestBusyWaitHack;
 	// Execute the current element
 	{
 		ScopePerf perf2(PE::EventQueueExecuteCallback);
+#if EFI_OUTPUT_EDGE_LATENCY
+		// outputs toggled by this action compare themselves to the target moment
+		ScheduledEventScope edgeScope(momentNt);
+#endif // EFI_OUTPUT_EDGE_LATENCY
 #if EFI_DETAILED_LOGGING && EFI_UNIT_TEST_VERBOSE_ACTION
 		std::cout << "EventQueue::executeOne: " << action.getCallbackName() << "(" << reinterpret_cast<uintptr_t>(action.getCallback()) << ") with raw arg = " << action.getArgumentRaw() << std::endl;
 #endif
@@ -0,0 +1,172 @@
+/**
+ * @file    pwm_bank.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "pwm_bank.h"
+
+// guard against channel which keeps scheduling itself into the past
+#define PWM_BANK_MAX_EDGES_PER_PASS 64
+
+PwmBank::PwmBank(efidur_t mergeWindowNt)
+	: m_mergeWindowNt(mergeWindowNt)
+{
+}
+
+void PwmBank::setExecutor(Scheduler *executor) {
+	m_executor = executor;
+}
+
+int PwmBank::size() const {
+	int result = 0;
+	for (scheduling_s *current = m_head; current; current = current->next) {
+		result++;
+	}
+	return result;
+}
+
+void PwmBank::unlink(scheduling_s *scheduling) {
+	scheduling_s **link = &m_head;
+	while (*link) {
+		if (*link == scheduling) {
+			*link = scheduling->next;
+			scheduling->next = nullptr;
+			return;
+		}
+		link = &(*link)->next;
+	}
+}
+
+void PwmBank::schedule(const char *msg, scheduling_s *scheduling, efitick_t targetTime, action_s const& action) {
+	efiAssertVoid(ObdCode::CUSTOM_ERR_ASSERT, scheduling != nullptr, "PWM bank needs scheduling");
+
+	chibios_rt::CriticalSectionLocker csl;
+
+	// same contract as EventQueue: already scheduled event is left as is
+	if (scheduling->action) {
+		return;
+	}
+
+	scheduling->setMomentNt(targetTime);
+	scheduling->action = action;
+
+	bool isNewHead = !m_head || targetTime < m_head->getMomentNt();
+	if (isNewHead) {
+		scheduling->next = m_head;
+		m_head = scheduling;
+	} else {
+		scheduling_s *insertPosition = m_head;
+		while (insertPosition->next && insertPosition->next->getMomentNt() <= targetTime) {
+			insertPosition = insertPosition->next;
+		}
+		scheduling->next = insertPosition->next;
+		insertPosition->next = scheduling;
+	}
+
+	// new edge may extend merged cluster of the head, that moves the slot later
+	bool isInHeadCluster = targetTime <= m_head->getMomentNt() + m_mergeWindowNt;
+	// while executing, slot is rescheduled once at the end of the pass
+	if ((isNewHead || isInHeadCluster) && !m_isExecuting) {
+		rescheduleBank();
+	}
+
+	(void)msg;
+}
+
+void PwmBank::cancel(scheduling_s* scheduling) {
+	chibios_rt::CriticalSectionLocker csl;
+
+	if (!scheduling->action) {
+		return;
+	}
+
+	bool wasHead = scheduling == m_head;
+	unlink(scheduling);
+	scheduling->action = {};
+
+	// slot could be targeting cancelled edge or the cluster it was merged into
+	if (wasHead && !m_isExecuting) {
+		rescheduleBank();
+	}
+}
+
+static void pwmBankCallback(PwmBank *bank) {
+	bank->onBankCallback();
+}
+
+void PwmBank::onBankCallback() {
+	chibios_rt::CriticalSectionLocker csl;
+
+	bankCallbackCounter++;
+	m_isExecuting = true;
+
+	// slot is scheduled at the last edge of merged cluster so nothing is applied ahead of its moment
+	efitick_t nowNt = getTimeNowNt();
+	uint32_t edges = 0;
+
+	while (m_head && m_head->getMomentNt() <= nowNt) {
+		scheduling_s *current = m_head;
+		m_head = current->next;
+		current->next = nullptr;
+
+		// clear action so that channel can reschedule itself from the callback
+		auto const action{ std::move(current->action) };
+		action.execute();
+
+		edges++;
+		if (edges >= PWM_BANK_MAX_EDGES_PER_PASS) {
+			warning(ObdCode::CUSTOM_ERR_LOCK_ISSUE, "PWM bank pass too long");
+			break;
+		}
+	}
+
+	executeCounter += edges;
+	maxEdgesPerPass = std::max(maxEdgesPerPass, edges);
+
+	m_isExecuting = false;
+	rescheduleBank();
+}
+
+/*
+ * invoked under lock
+ */
+void PwmBank::rescheduleBank() {
+	if (!m_executor) {
+		firmwareError(ObdCode::CUSTOM_NULL_EXECUTOR, "PWM bank without executor");
+		return;
+	}
+
+	// drop previous slot, head has changed
+	m_executor->cancel(&m_bankScheduling);
+
+	if (!m_head) {
+		return;
+	}
+
+	// edges within merge window of the head are delayed to the latest of them, never applied early
+	efitick_t deadline = m_head->getMomentNt() + m_mergeWindowNt;
+	efitick_t targetTime = m_head->getMomentNt();
+	for (scheduling_s *current = m_head->next; current && current->getMomentNt() <= deadline; current = current->next) {
+		targetTime = current->getMomentNt();
+	}
+
+	m_executor->schedule("pwm bank", &m_bankScheduling, targetTime, action_s::make<pwmBankCallback>(this));
+}
+
+Scheduler *getPwmScheduler(Scheduler *executor, float periodNt) {
+#if EFI_PWM_BANK
+	// NaN period (paused PWM) is not routed
+	bool isSlow = periodNt >= USF2NT(frequency2periodUs(PWM_BANK_MAX_FREQUENCY));
+	// unit tests run PWM on their own executors without engine
+	if (isSlow && engine && executor == &engine->scheduler) {
+		engine->pwmBank.setExecutor(executor);
+		return &engine->pwmBank;
+	}
+#else
+	(void)periodNt;
+#endif // EFI_PWM_BANK
+	return executor;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file    pwm_bank.h
+ * @brief   Shared scheduling slot for slow software PWM channels
+ *
+ * Each software PWM channel reschedules itself on every edge. Slow channels (idle, boost, VVT, GPPWM,
+ * alternator, tachometer...) do not need their own entries in the main event queue next to injector and
+ * coil events: bank keeps their edges in its own sorted list and holds a single entry in the underlying
+ * scheduler. Edges within merge window of the earliest one are applied in one pass at the moment of the
+ * latest of them: an edge may be delayed by up to the merge window but is never applied before its moment.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include "scheduler.h"
+
+// Software PWM at or below this frequency is driven by the bank
+#ifndef PWM_BANK_MAX_FREQUENCY
+#define PWM_BANK_MAX_FREQUENCY 1000
+#endif
+
+// Edges this close to the earliest pending one are applied in the same pass
+#ifndef PWM_BANK_MERGE_WINDOW_US
+#define PWM_BANK_MERGE_WINDOW_US 5
+#endif
+
+class PwmBank final : public Scheduler {
+public:
+	explicit PwmBank(efidur_t mergeWindowNt = US2NT(PWM_BANK_MERGE_WINDOW_US));
+
+	void setExecutor(Scheduler *executor);
+	Scheduler *getExecutor() const {
+		return m_executor;
+	}
+
+	void schedule(const char *msg, scheduling_s *scheduling, efitick_t targetTime, action_s const& action) override;
+	void cancel(scheduling_s* scheduling) override;
+
+	void onBankCallback();
+
+	// number of pending channel edges
+	int size() const;
+
+	// times bank slot has fired in the underlying scheduler
+	uint32_t bankCallbackCounter = 0;
+	// channel edges applied
+	uint32_t executeCounter = 0;
+	// largest number of edges applied in one pass
+	uint32_t maxEdgesPerPass = 0;
+
+private:
+	void unlink(scheduling_s *scheduling);
+	void rescheduleBank();
+
+	Scheduler *m_executor = nullptr;
+	const efidur_t m_mergeWindowNt;
+
+	// sorted by moment
+	scheduling_s *m_head = nullptr;
+	scheduling_s m_bankScheduling;
+	bool m_isExecuting = false;
+};
+
+/**
+ * Returns the bank wrapping given scheduler if PWM with given period qualifies, original scheduler otherwise
+ * Only to be invoked while channel has nothing scheduled, see PwmConfig::selectExecutor
+ */
+Scheduler *getPwmScheduler(Scheduler *executor, float periodNt);
@@ -10,6 +10,7 @@
 
 #include "pch.h"
 
+#include "pwm_bank.h"
 
 #if EFI_PROD_CODE
 #include "mpu_util.h"
@@ -129,6 +130,11 @@ void PwmConfig::setFrequency(float frequency) {
 	periodNt = USF2NT(frequency2periodUs(frequency));
 }
 
+void PwmConfig::selectExecutor() {
+	// slow channels share one scheduling slot instead of each keeping own entry in the main queue
+	m_executor = getPwmScheduler(m_baseExecutor, periodNt);
+}
+
 void PwmConfig::stop() {
 	isStopRequested = true;
 }
@@ -263,6 +269,8 @@ static void timerCallback(PwmConfig *state) {
 		// we are here when PWM gets stopped
 		return;
 	}
+	// setFrequency takes effect on the next edge, that is also when channel may change executor
+	state->selectExecutor();
 	if (state->m_executor == nullptr) {
 		firmwareError(ObdCode::CUSTOM_NULL_EXECUTOR, "exec on %s", state->m_name);
 		return;
@@ -290,7 +298,8 @@ void copyPwmParameters(PwmConfig *state, MultiChannelStateSequence const * seq)
 void PwmConfig::weComplexInit(Scheduler *executor,
 		MultiChannelStateSequence const * seq,
 		pwm_cycle_callback *pwmCycleCallback, pwm_gen_callback *stateChangeCallback) {
-	m_executor = executor;
+	m_baseExecutor = executor;
+	selectExecutor();
 	isStopRequested = false;
 
     // NaN is 'not initialized' but zero is not expected
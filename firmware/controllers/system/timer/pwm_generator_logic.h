@@ -58,6 +58,14 @@ public:
 			pwm_gen_callback *callback);
 
 	Scheduler *m_executor = nullptr;
+	// executor as given to weComplexInit, m_executor may be the PWM bank wrapping it
+	Scheduler *m_baseExecutor = nullptr;
+
+	/**
+	 * Picks m_executor for current period, invoked on each edge while nothing is scheduled
+	 * so that frequency change can move channel in or out of the PWM bank
+	 */
+	void selectExecutor();
 
 	/**
 	 * We need to handle zero duty cycle and 100% duty cycle in a special way
@@ -10,12 +10,8 @@
 
 // Main loop gets highest priority - it does all the critical
 // non-interrupt work to actually run the engine
-#define PRIO_MAIN_LOOP (NORMALPRIO + 10) //TODO: main_loop should be NORMALPRIO + 10
-
-// TODO: main_loop remove this 2 after migrating to main_loop
-// ADC and ETB get highest priority - not much else actually runs the engine
-#define PRIO_ADC (NORMALPRIO + 10)
-#define PRIO_ETB (NORMALPRIO + 9)
+// ADC, ETB, fast and slow callbacks all run there, see MainLoop rate groups
+#define PRIO_MAIN_LOOP (NORMALPRIO + 10)
 
 // GPIO chips should be fast and go right back to sleep, plus can be timing sensitive
 #define PRIO_GPIOCHIP (NORMALPRIO + 8)
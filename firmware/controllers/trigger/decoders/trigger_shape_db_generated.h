@@ -0,0 +1,121 @@
+// was generated automatically by rusEFI unit test suite, see test_trigger_shape_db.cpp
+// do not edit manually, run 'make trigger_shape_db' in unit_tests
+#pragma once
+
+static constexpr std::array<TriggerShapeDbEntry, 115> triggerShapeDb = {{
+	{ 0x02f0f00b, 41, 0 }, // TT_FIAT_IAW_P8
+	{ 0x037f70ce, 2, 0 }, // TT_DODGE_NEON_1995
+	{ 0x037f70ce, 39, 0 }, // TT_DODGE_NEON_1995_ONLY_CRANK
+	{ 0x038e0913, 7, 0 }, // TT_MAZDA_SOHC_4
+	{ 0x04f2709d, 75, 2 }, // TT_60_2_2_F3R
+	{ 0x0ac23909, 26, 8 }, // TT_ROVER_K
+	{ 0x0df9b58c, 9, 0 }, // TT_TOOTHED_WHEEL_36_1
+	{ 0x0eec0894, 94, 2 }, // TT_SUBARU_7_6_CRANK
+	{ 0x0eec0894, 95, 2 }, // TT_UNUSED_95
+	{ 0x0eec0894, 96, 2 }, // TT_UNUSED_96
+	{ 0x10a34c1b, 17, 0 }, // TT_VVT_TOYOTA_3_TOOTH
+	{ 0x17aafdc3, 50, 13 }, // TT_SUZUKI_K6A
+	{ 0x18760232, 58, 2 }, // TT_NISSAN_VQ35
+	{ 0x19187b21, 31, 0 }, // TT_3_1_CAM
+	{ 0x1d6513fa, 25, 0 }, // TT_2JZ_3_34_SIMULATION_ONLY
+	{ 0x1fe5daab, 9, 0 }, // TT_TOOTHED_WHEEL_36_1
+	{ 0x208d4551, 45, 40 }, // TT_RENIX_66_2_2_2
+	{ 0x290ca08b, 90, 20 }, // TT_CHRYSLER_PHASER
+	{ 0x2addd4a0, 37, 24 }, // TT_JEEP_18_2_2_2
+	{ 0x2b1200cd, 69, 0 }, // TT_TOOTHED_WHEEL_32_2
+	{ 0x2c176978, 62, 4 }, // TT_VVT_MITSUBISHI_3A92
+	{ 0x2d262b92, 43, 1 }, // TT_VVT_MIATA_NB
+	{ 0x30917391, 42, 4 }, // TT_FORD_ST170
+	{ 0x358a3490, 13, 2 }, // TT_VVT_MAZDA_SKYACTIV
+	{ 0x35e9dba9, 92, 36 }, // TT_JEEP_EVD_36_2_2
+	{ 0x3668eaba, 73, 0 }, // TT_VVT_TOYOTA_4_1
+	{ 0x39649861, 71, 0 }, // TT_36_2_1_1
+	{ 0x3d4071db, 8, 0 }, // TT_TOOTHED_WHEEL_60_2
+	{ 0x3fbaa370, 14, 6 }, // TT_DODGE_NEON_2003_CAM
+	{ 0x3fbaa370, 32, 6 }, // TT_DODGE_NEON_2003_CRANK
+	{ 0x40af437a, 35, 12 }, // TT_MAZDA_MIATA_VVT_TEST
+	{ 0x4521e4c1, 10, 0 }, // TT_MERCEDES_2_SEGMENT
+	{ 0x46116d58, 69, 0 }, // TT_TOOTHED_WHEEL_32_2
+	{ 0x46e84323, 29, 2 }, // TT_NISSAN_K11
+	{ 0x471b7c1b, 54, 106 }, // TT_GM_60_2_2_2
+	{ 0x47660402, 17, 0 }, // TT_VVT_TOYOTA_3_TOOTH
+	{ 0x4ab81d98, 12, 1 }, // TT_SUBARU_EZ30
+	{ 0x4bf37e50, 5, 0 }, // TT_GM_7X
+	{ 0x4c1a53e3, 46, 2 }, // TT_HONDA_K_CRANK_12_1
+	{ 0x50241ad9, 53, 0 }, // TT_TRI_TACH
+	{ 0x5272234e, 49, 11 }, // TT_SUBARU_SVX
+	{ 0x5272234e, 63, 11 }, // TT_SUBARU_SVX_CRANK_1
+	{ 0x5272234e, 64, 11 }, // TT_SUBARU_SVX_CAM_VVT
+	{ 0x5314f77f, 73, 0 }, // TT_VVT_TOYOTA_4_1
+	{ 0x56ac18cf, 20, 114 }, // TT_60_2_WRONG_POLARITY
+	{ 0x5abf5d6f, 38, 1 }, // TT_12_TOOTH_CRANK
+	{ 0x5b965151, 79, 7 }, // TT_VVT_MITSU_6G72
+	{ 0x5db444ef, 23, 1 }, // TT_36_2_2_2
+	{ 0x61642120, 8, 0 }, // TT_TOOTHED_WHEEL_60_2
+	{ 0x6277236c, 30, 30 }, // TT_CHRYSLER_NGC_36_2_2
+	{ 0x66b0765d, 91, 0 }, // TT_TOYOTA_3_TOOTH_UZ
+	{ 0x6a6aaf85, 33, 3 }, // TT_MIATA_VVT
+	{ 0x6e159941, 77, 0 }, // TT_60DEG_TOOTH
+	{ 0x7560777c, 48, 0 }, // TT_TOOTHED_WHEEL_36_2
+	{ 0x7657d653, 85, 22 }, // TT_ARCTIC_CAT
+	{ 0x771ae22a, 27, 40 }, // TT_GM_24x_5
+	{ 0x7735f49f, 4, 12 }, // TT_VVT_FORD_COYOTE
+	{ 0x7735f49f, 83, 12 }, // TT_DEV
+	{ 0x79e38881, 24, 2 }, // TT_NISSAN_SR20VE
+	{ 0x7acd37ca, 66, 2 }, // TT_SUZUKI_G13B
+	{ 0x7bd10875, 3, 4 }, // TT_MAZDA_MIATA_NA
+	{ 0x7beaf217, 36, 28 }, // TT_SUBARU_7_6
+	{ 0x7e191103, 60, 0 }, // TT_NISSAN_VQ30
+	{ 0x80a0d382, 21, 0 }, // TT_BENELLI_TRE
+	{ 0x8115bedb, 22, 0 }, // TT_DODGE_STRATUS
+	{ 0x8558eee0, 11, 0 }, // TT_NARROW_SINGLE_TOOTH
+	{ 0x8731e6be, 87, 13 }, // TT_HONDA_J30A2_24_1_1
+	{ 0x942f6b5c, 68, 2 }, // TT_NISSAN_MR18_CRANK
+	{ 0x984e8c29, 52, 0 }, // TT_NISSAN_MR18_CAM_VVT
+	{ 0x98cdfd37, 11, 0 }, // TT_NARROW_SINGLE_TOOTH
+	{ 0x9cfb989f, 18, 0 }, // TT_HALF_MOON
+	{ 0x9cfb989f, 88, 0 }, // TT_CUSTOM_1
+	{ 0x9cfb989f, 89, 0 }, // TT_CUSTOM_2
+	{ 0xa2ce8a7d, 8, 0 }, // TT_TOOTHED_WHEEL_60_2
+	{ 0xa3e7da99, 11, 0 }, // TT_NARROW_SINGLE_TOOTH
+	{ 0xa7d1bf31, 18, 0 }, // TT_HALF_MOON
+	{ 0xa7d1bf31, 88, 0 }, // TT_CUSTOM_1
+	{ 0xa7d1bf31, 89, 0 }, // TT_CUSTOM_2
+	{ 0xab1d58e6, 19, 16 }, // TT_DODGE_RAM
+	{ 0xaf598134, 65, 2 }, // TT_FORD_TFI_PIP
+	{ 0xb0f937a4, 70, 32 }, // TT_36_2_1
+	{ 0xb122f7ba, 48, 0 }, // TT_TOOTHED_WHEEL_36_2
+	{ 0xb461322d, 61, 2 }, // TT_NISSAN_QR25
+	{ 0xb4c3aa06, 57, 0 }, // TT_KAWA_KX450F
+	{ 0xb92bcb97, 34, 0 }, // TT_MITSU_4G63_CAM
+	{ 0xba44ace6, 18, 0 }, // TT_HALF_MOON
+	{ 0xba44ace6, 88, 0 }, // TT_CUSTOM_1
+	{ 0xba44ace6, 89, 0 }, // TT_CUSTOM_2
+	{ 0xbcee5c06, 51, 6 }, // TT_VVT_SUBARU_7_WITHOUT_6
+	{ 0xbdfb0cf5, 59, 10 }, // TT_VVT_NISSAN_VQ35
+	{ 0xbfa504d9, 67, 0 }, // TT_HONDA_K_CAM_4_1
+	{ 0xc8268612, 76, 0 }, // TT_MITSU_4G63_CRANK
+	{ 0xcad86061, 72, 1 }, // TT_3_TOOTH_CRANK
+	{ 0xcb13d45f, 78, 0 }, // TT_VVT_MITSUBISHI_4G69
+	{ 0xcd0d71f6, 86, 2 }, // TT_NISSAN_HR_CAM_IN
+	{ 0xd303b7d9, 48, 0 }, // TT_TOOTHED_WHEEL_36_2
+	{ 0xd5ab7727, 15, 0 }, // TT_MAZDA_DOHC_1_4
+	{ 0xdb0dde6f, 55, 4 }, // TT_SKODA_FAVORIT
+	{ 0xdd6c0bcd, 84, 19 }, // TT_NISSAN_HR
+	{ 0xdf927b43, 28, 1 }, // TT_HONDA_CBR_600
+	{ 0xe23d8d97, 1, 4 }, // TT_FORD_ASPIRE
+	{ 0xe3fba50b, 81, 0 }, // TT_DAIHATSU_4_CYL
+	{ 0xe7814051, 6, 0 }, // TT_DAIHATSU_3_CYL
+	{ 0xe8ec9430, 17, 0 }, // TT_VVT_TOYOTA_3_TOOTH
+	{ 0xe96e6778, 73, 0 }, // TT_VVT_TOYOTA_4_1
+	{ 0xe9c63656, 93, 2 }, // TT_JEEPRENIX_66_2_2_2
+	{ 0xeabd0c37, 74, 40 }, // TT_GM_24x_3
+	{ 0xec817ad2, 56, 4 }, // TT_VVT_BARRA_3_PLUS_1
+	{ 0xeda9b3a2, 82, 6 }, // TT_VVT_MAZDA_L
+	{ 0xeebcea43, 80, 1 }, // TT_6_TOOTH_CRANK
+	{ 0xf02b3527, 69, 0 }, // TT_TOOTHED_WHEEL_32_2
+	{ 0xf39e06bb, 44, 40 }, // TT_RENIX_44_2_2
+	{ 0xf90ace8e, 40, 16 }, // TT_JEEP_4_CYL
+	{ 0xfb536e18, 9, 0 }, // TT_TOOTHED_WHEEL_36_1
+	{ 0xfe7739a1, 16, 0 }, // TT_ONE_PLUS_ONE
+}};
@@ -26,4 +26,6 @@ TRIGGER_DECODERS_SRC_CPP = \
 
 TRIGGER_SRC_CPP = \
 	$(CONTROLLERS_DIR)/trigger/trigger_emulator_algo.cpp \
+	$(CONTROLLERS_DIR)/trigger/trigger_emulator_timeline.cpp \
+	$(CONTROLLERS_DIR)/trigger/trigger_shape_db.cpp \
 	$(CONTROLLERS_DIR)/trigger/trigger_central.cpp
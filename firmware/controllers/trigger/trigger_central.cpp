@@ -23,6 +23,7 @@
 #include "status_loop.h"
 #include "engine_sniffer.h"
 #include "auto_generated_sync_edge.h"
+#include "trigger_shape_db.h"
 
 #if EFI_TUNER_STUDIO
 #include "tunerstudio.h"
@@ -1107,6 +1108,19 @@ void onConfigurationChangeTriggerCallback() {
 	getTriggerCentral()->triggerConfigChangedOnLastConfigurationChange = getTriggerCentral()->triggerConfigChangedOnLastConfigurationChange || changed;
 }
 
+static void initializeSyncPoint(TriggerWaveform& shape, const TriggerConfiguration& triggerConfiguration, TriggerDecoderBase& initState) {
+#if EFI_TRIGGER_SHAPE_DB && !EFI_UNIT_TEST
+	// unit tests look into initState after this, test_all_triggers compares the table with simulation
+	expected<uint32_t> syncIndex = lookupTriggerSyncIndex(shape, triggerConfiguration.TriggerType.type);
+	if (syncIndex) {
+		shape.triggerShapeSynchPointIndex = syncIndex.Value;
+		return;
+	}
+#endif // EFI_TRIGGER_SHAPE_DB
+
+	shape.initializeSyncPoint(initState, triggerConfiguration);
+}
+
 static void initVvtShape(int camIndex, TriggerWaveform& shape, const TriggerConfiguration& p_config, TriggerDecoderBase &initState) {
 	shape.initializeTriggerWaveform(FOUR_STROKE_CAM_SENSOR, p_config.TriggerType, /*isCrank*/ false);
 	if (camIndex == 0) {
@@ -1114,7 +1128,7 @@ static void initVvtShape(int camIndex, TriggerWaveform& shape, const TriggerConf
 	  // nasty code: this implicitly adjusts 'shape' parameter
 	  getTriggerCentral()->applyCamGapOverride();
 	}
-	shape.initializeSyncPoint(initState, p_config);
+	initializeSyncPoint(shape, p_config, initState);
 }
 
 void TriggerCentral::validateCamVvtCounters() {
@@ -1139,7 +1153,7 @@ static void calculateTriggerSynchPoint(
 	efiAssertVoid(ObdCode::CUSTOM_TRIGGER_STACK, hasLotsOfRemainingStack(), "calc s");
 #endif
 
-	shape.initializeSyncPoint(initState, primaryTriggerConfiguration);
+	initializeSyncPoint(shape, primaryTriggerConfiguration, initState);
 
 	if (shape.getSize() >= PWM_PHASE_MAX_COUNT) {
 		// todo: by the time we are here we had already modified a lot of RAM out of bounds!
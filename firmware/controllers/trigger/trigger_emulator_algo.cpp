@@ -37,6 +37,7 @@ bool needEvent(const int currentIndex, const MultiChannelStateSequence & mcss, i
 #include "trigger_emulator_algo.h"
 #include "trigger_central.h"
 #include "trigger_simulator.h"
+#include "trigger_emulator_timeline.h"
 
 TriggerEmulatorHelper::TriggerEmulatorHelper() {
 }
@@ -47,21 +48,26 @@ void TriggerEmulatorHelper::handleEmulatorCallback(int channel, const MultiChann
 	efitick_t stamp = getTimeNowNt();
 
 	// todo: code duplication with TriggerStimulatorHelper::feedSimulatedEvent?
-#if EFI_SHAFT_POSITION_INPUT
 	for (size_t i = 0; i < PWM_PHASE_MAX_WAVE_PER_PWM; i++) {
 		if (needEvent(stateIndex, multiChannelStateSequence, i)) {
 			bool isRise = TriggerValue::RISE == multiChannelStateSequence.getChannelState(/*phaseIndex*/i, stateIndex);
+			handleEmulatorEdge(channel, i, isRise, stamp);
+		}
+	}
+}
 
-			isRise ^= (i == 0 && engineConfiguration->invertPrimaryTriggerSignal);
-			isRise ^= (i == 1 && engineConfiguration->invertSecondaryTriggerSignal);
+void TriggerEmulatorHelper::handleEmulatorEdge(int channel, int waveIndex, bool isRise, efitick_t stamp) {
+#if EFI_SHAFT_POSITION_INPUT
+	isRise ^= (waveIndex == 0 && engineConfiguration->invertPrimaryTriggerSignal);
+	isRise ^= (waveIndex == 1 && engineConfiguration->invertSecondaryTriggerSignal);
 
-			if (channel == 0) {
-				handleShaftSignal(i, isRise, stamp);
-			} else {
-				handleVvtCamSignal(isRise ? TriggerValue::RISE : TriggerValue::FALL, stamp, INDEX_BY_BANK_CAM(channel - 1, i));
-			}
-		}
+	if (channel == 0) {
+		handleShaftSignal(waveIndex, isRise, stamp);
+	} else {
+		handleVvtCamSignal(isRise ? TriggerValue::RISE : TriggerValue::FALL, stamp, INDEX_BY_BANK_CAM(channel - 1, waveIndex));
 	}
+#else
+	UNUSED(channel); UNUSED(waveIndex); UNUSED(isRise); UNUSED(stamp);
 #endif // EFI_SHAFT_POSITION_INPUT
 }
 
@@ -69,7 +75,198 @@ void TriggerEmulatorHelper::handleEmulatorCallback(int channel, const MultiChann
 PwmConfig triggerEmulatorSignals[NUM_EMULATOR_CHANNELS];
 TriggerWaveform *triggerEmulatorWaveforms[NUM_EMULATOR_CHANNELS];
 
+#if !EFI_TRIGGER_EMULATOR_TIMELINE
 static int atTriggerVersions[NUM_EMULATOR_CHANNELS] = { 0 };
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
+
+static TriggerEmulatorHelper helper;
+static bool hasStimPins = false;
+
+#if EFI_PROD_CODE
+PUBLIC_API_WEAK void onTriggerEmulatorPinState(int, int) { }
+#endif /* EFI_PROD_CODE */
+
+#if EFI_TRIGGER_EMULATOR_TIMELINE
+
+/**
+ * Plays all emulator channels from one timeline, one scheduler slot walks edges with a cursor
+ */
+class TriggerEmulatorPlayer {
+public:
+	void start() {
+		if (m_isRunning) {
+			return;
+		}
+
+		m_isRunning = true;
+		compile();
+		restartCycle(getTimeNowNt());
+		scheduleNext();
+	}
+
+	void stop() {
+		m_isRunning = false;
+		engine->scheduler.cancel(&m_scheduling);
+	}
+
+	/**
+	 * Thread context only: compiling sorts the whole timeline, too slow for scheduler callback
+	 */
+	void updateTimeline() {
+		if (!m_isRunning || !isTimelineOutdated()) {
+			return;
+		}
+
+		efiPrintf("Stimulator: updating timeline");
+		stop();
+		start();
+	}
+
+	// zero stops the edges but keeps the player alive
+	void setRpm(int rpm) {
+		// timeline cycle is one cam revolution
+		m_cyclePeriodNt = rpm == 0 ? 0 : US2NT(120LL * 1000000 / rpm);
+	}
+
+	void onEdge() {
+		if (!m_isRunning) {
+			return;
+		}
+
+		efitick_t nowNt = getTimeNowNt();
+		efidur_t cyclePeriodNt = m_cyclePeriodNt;
+
+		if (cyclePeriodNt == 0 || m_timeline.size() == 0) {
+			// nothing to play, check again later
+			restartCycle(nowNt);
+			engine->scheduler.schedule("trgEmu", &m_scheduling, nowNt + MS2NT(100), action_s::make<onEdgeCallback>(this));
+			return;
+		}
+
+		applyEdge(m_timeline[m_cursor], nowNt);
+
+		m_cursor++;
+		if (m_cursor == m_timeline.size()) {
+			m_cursor = 0;
+			m_cycleStartNt += cyclePeriodNt;
+			m_position = m_timeline.getFirstEdgeTicks();
+		} else {
+			m_position += m_timeline[m_cursor].deltaTicks;
+		}
+
+		// If we're very far behind schedule, restart the cycle fresh to avoid a huge pile of edges all at once
+		if (getEdgeTimeNt(cyclePeriodNt) < nowNt - MS2NT(10)) {
+			restartCycle(nowNt);
+		}
+
+		scheduleNext();
+	}
+
+private:
+	static void onEdgeCallback(TriggerEmulatorPlayer *instance) {
+		instance->onEdge();
+	}
+
+	efitick_t getEdgeTimeNt(efidur_t cyclePeriodNt) const {
+		return m_cycleStartNt + (int64_t)m_position * cyclePeriodNt / TriggerEmulatorTimeline::cycleTicks;
+	}
+
+	void restartCycle(efitick_t nowNt) {
+		m_cursor = 0;
+		m_cycleStartNt = nowNt;
+		m_position = m_timeline.getFirstEdgeTicks();
+
+		for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
+			// so that first edge of the channel gets its first phase
+			m_stateIndex[channel] = -1;
+		}
+	}
+
+	void scheduleNext() {
+		engine->scheduler.schedule("trgEmu", &m_scheduling, getEdgeTimeNt(m_cyclePeriodNt), action_s::make<onEdgeCallback>(this));
+	}
+
+	void applyEdge(const TriggerEmulatorEdge &edge, efitick_t nowNt) {
+		for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
+			if (!((edge.setMask | edge.resetMask) & TRIGGER_EMULATOR_CHANNEL_MASK(channel))) {
+				continue;
+			}
+
+			// same stateIndex PWM based emulator used to report, from the timeline since scheduler
+			// callbacks keep running while the waveform itself is being rebuilt
+			int stateIndex = m_timeline.getNextEventPhase(channel, m_stateIndex[channel]);
+			m_stateIndex[channel] = stateIndex;
+
+			for (int waveIndex = 0; waveIndex < PWM_PHASE_MAX_WAVE_PER_PWM; waveIndex++) {
+				uint16_t bit = TRIGGER_EMULATOR_PIN_BIT(channel, waveIndex);
+				if (!((edge.setMask | edge.resetMask) & bit)) {
+					continue;
+				}
+
+				bool isRise = edge.setMask & bit;
+
+				if (engine->triggerCentral.directSelfStimulation) {
+					helper.handleEmulatorEdge(channel, waveIndex, isRise, nowNt);
+				}
+#if EFI_PROD_CODE
+				else if (hasStimPins) {
+					emulatorOutputs[channel][waveIndex].setValue(engine->isPwmEnabled && isRise);
+				}
+#endif /* EFI_PROD_CODE */
+			}
+
+#if EFI_PROD_CODE
+			if (!engine->triggerCentral.directSelfStimulation && hasStimPins) {
+				// this allows any arbitrary code to synchronize with the trigger emulator
+				onTriggerEmulatorPinState(stateIndex, channel);
+			}
+#else
+			UNUSED(stateIndex);
+#endif /* EFI_PROD_CODE */
+		}
+	}
+
+	void compile() {
+		const MultiChannelStateSequence *waveforms[NUM_EMULATOR_CHANNELS];
+		for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
+			waveforms[channel] = &triggerEmulatorWaveforms[channel]->wave;
+			m_versions[channel] = triggerEmulatorWaveforms[channel]->version;
+		}
+
+		m_mode = getEngineRotationState()->getOperationMode();
+		int repetitions[NUM_EMULATOR_CHANNELS];
+		getTriggerEmulatorRepetitions(m_mode, repetitions);
+
+		if (!m_timeline.compile(waveforms, repetitions)) {
+			warning(ObdCode::CUSTOM_ERR_TRIGGER_WAVEFORM_TOO_LONG, "trigger emulator timeline too long");
+		}
+	}
+
+	bool isTimelineOutdated() const {
+		bool isChanged = m_mode != getEngineRotationState()->getOperationMode();
+		for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
+			isChanged |= m_versions[channel] != triggerEmulatorWaveforms[channel]->version;
+		}
+		return isChanged;
+	}
+
+	TriggerEmulatorTimeline m_timeline;
+	scheduling_s m_scheduling;
+	bool m_isRunning = false;
+	size_t m_cursor = 0;
+	efitick_t m_cycleStartNt = 0;
+	// from cycle start to the edge at cursor, in timeline ticks
+	uint32_t m_position = 0;
+	volatile efidur_t m_cyclePeriodNt = 0;
+	operation_mode_e m_mode = OM_NONE;
+	int m_versions[NUM_EMULATOR_CHANNELS] = {};
+	// phase of each channel waveform at the last edge
+	int m_stateIndex[NUM_EMULATOR_CHANNELS] = {};
+};
+
+static TriggerEmulatorPlayer player;
+
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
 
 /**
  * todo: why is this method NOT reciprocal to getCrankDivider?!
@@ -111,12 +308,16 @@ void setTriggerEmulatorRPM(int rpm) {
 		}
 		triggerEmulatorSignals[channel].setFrequency(rPerSecond);
 	}
+#if EFI_TRIGGER_EMULATOR_TIMELINE
+	player.setRpm(rpm);
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
 
 	engine->resetEngineSnifferIfInTestMode();
 
 	efiPrintf("Emulating position sensor(s). RPM=%d", rpm);
 }
 
+#if !EFI_TRIGGER_EMULATOR_TIMELINE
 static void updateTriggerWaveformIfNeeded(PwmConfig *state) {
 	for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
 		if (state != &triggerEmulatorSignals[channel])
@@ -132,18 +333,13 @@ static void updateTriggerWaveformIfNeeded(PwmConfig *state) {
 		}
 	}
 }
-
-static TriggerEmulatorHelper helper;
-static bool hasStimPins = false;
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
 
 static bool hasInitTriggerEmulator = false;
 
-#if EFI_PROD_CODE
-PUBLIC_API_WEAK void onTriggerEmulatorPinState(int, int) { }
-#endif /* EFI_PROD_CODE */
-
 # if !EFI_UNIT_TEST
 
+#if !EFI_TRIGGER_EMULATOR_TIMELINE
 static void emulatorApplyPinState(int stateIndex, PwmConfig *state) /* pwm_gen_callback */ {
     assertStackVoid("emulator", ObdCode::STACK_USAGE_MISC, EXPECTED_REMAINING_STACK);
 	if (engine->triggerCentral.directSelfStimulation) {
@@ -173,6 +369,7 @@ static void emulatorApplyPinState(int stateIndex, PwmConfig *state) /* pwm_gen_c
 	}
 #endif /* EFI_PROD_CODE */
 }
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
 
 static void startSimulatedTriggerSignal() {
 	// No need to start more than once
@@ -188,6 +385,9 @@ static void startSimulatedTriggerSignal() {
 
 	setTriggerEmulatorRPM(engineConfiguration->triggerSimulatorRpm);
 
+#if EFI_TRIGGER_EMULATOR_TIMELINE
+	player.start();
+#else
 	for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
 		TriggerWaveform *s = triggerEmulatorWaveforms[channel];
 		if (s->getSize() == 0)
@@ -197,6 +397,7 @@ static void startSimulatedTriggerSignal() {
 			&s->wave,
 			updateTriggerWaveformIfNeeded, emulatorApplyPinState);
 	}
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
 	hasInitTriggerEmulator = true;
 }
 
@@ -221,14 +422,23 @@ void enableExternalTriggerStimulator() {
 
 void disableTriggerStimulator() {
 	engine->triggerCentral.directSelfStimulation = false;
+#if EFI_TRIGGER_EMULATOR_TIMELINE
+	player.stop();
+#else
 	for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
 		triggerEmulatorSignals[channel].stop();
 	}
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
 	hasInitTriggerEmulator = false;
     incrementGlobalConfigurationVersion("disTrg");
 }
 
 void onConfigurationChangeRpmEmulatorCallback(engine_configuration_s *previousConfiguration) {
+#if EFI_TRIGGER_EMULATOR_TIMELINE
+	// trigger waveforms have been updated by now
+	player.updateTimeline();
+#endif // EFI_TRIGGER_EMULATOR_TIMELINE
+
 	if (engineConfiguration->triggerSimulatorRpm ==
 			previousConfiguration->triggerSimulatorRpm) {
 		return;
@@ -28,6 +28,7 @@ class TriggerEmulatorHelper {
 public:
     TriggerEmulatorHelper();
 	void handleEmulatorCallback(int channel, const MultiChannelStateSequence& mcss, int stateIndex);
+	void handleEmulatorEdge(int channel, int waveIndex, bool isRise, efitick_t stamp);
 };
 
 int getPreviousIndex(const int currentIndex, const int size);
@@ -0,0 +1,116 @@
+/**
+ * @file trigger_emulator_timeline.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "trigger_emulator_timeline.h"
+
+void getTriggerEmulatorRepetitions(operation_mode_e mode, int repetitions[NUM_EMULATOR_CHANNELS]) {
+	// crank channel runs getRpmMultiplier() times engine speed, cams at half of it
+	repetitions[0] = mode == TWO_STROKE ? 2 : getCrankDivider(mode);
+
+	for (int channel = 1; channel < NUM_EMULATOR_CHANNELS; channel++) {
+		repetitions[channel] = 1;
+	}
+}
+
+void TriggerEmulatorTimeline::addEdge(uint32_t ticks, uint16_t bit, bool isRise) {
+	if (m_size == efi::size(m_edges)) {
+		m_overflow = true;
+		return;
+	}
+
+	// absolute position for now, turned into delta once sorted
+	m_edges[m_size++] = { ticks, isRise ? bit : (uint16_t)0, isRise ? (uint16_t)0 : bit };
+}
+
+bool TriggerEmulatorTimeline::compile(const MultiChannelStateSequence * const waveforms[NUM_EMULATOR_CHANNELS],
+		const int repetitions[NUM_EMULATOR_CHANNELS]) {
+	m_size = 0;
+	m_firstEdgeTicks = 0;
+	m_overflow = false;
+	memset(m_phaseCount, 0, sizeof(m_phaseCount));
+	memset(m_eventPhases, 0, sizeof(m_eventPhases));
+
+	for (int channel = 0; channel < NUM_EMULATOR_CHANNELS; channel++) {
+		const MultiChannelStateSequence *wave = waveforms[channel];
+		if (!wave || wave->phaseCount == 0 || repetitions[channel] < 1) {
+			continue;
+		}
+
+		m_phaseCount[channel] = std::min<int>(wave->phaseCount, PWM_PHASE_MAX_COUNT);
+
+		int waveCount = std::min<int>(wave->waveCount, PWM_PHASE_MAX_WAVE_PER_PWM);
+		for (int waveIndex = 0; waveIndex < waveCount; waveIndex++) {
+			uint16_t bit = TRIGGER_EMULATOR_PIN_BIT(channel, waveIndex);
+
+			for (int loop = 0; loop < repetitions[channel]; loop++) {
+				for (int phase = 0; phase < m_phaseCount[channel]; phase++) {
+					if (!needEvent(phase, *wave, waveIndex)) {
+						continue;
+					}
+
+					m_eventPhases[channel][phase / 32] |= 1u << (phase % 32);
+
+					// same rounding as getSimulatedEventTime
+					uint32_t ticks = (uint32_t)(cycleTicks * (loop + wave->getSwitchTime(phase)) / repetitions[channel]);
+					addEdge(ticks, bit, wave->getChannelState(waveIndex, phase) == TriggerValue::RISE);
+				}
+			}
+		}
+	}
+
+	if (m_overflow) {
+		m_size = 0;
+		memset(m_phaseCount, 0, sizeof(m_phaseCount));
+		return false;
+	}
+
+	std::sort(m_edges, m_edges + m_size, [](const TriggerEmulatorEdge &a, const TriggerEmulatorEdge &b) {
+		return a.deltaTicks < b.deltaTicks;
+	});
+
+	// edges of all channels at the same time become one
+	size_t merged = 0;
+	for (size_t i = 0; i < m_size; i++) {
+		if (merged > 0 && m_edges[merged - 1].deltaTicks == m_edges[i].deltaTicks) {
+			m_edges[merged - 1].setMask |= m_edges[i].setMask;
+			m_edges[merged - 1].resetMask |= m_edges[i].resetMask;
+		} else {
+			m_edges[merged++] = m_edges[i];
+		}
+	}
+	m_size = merged;
+
+	if (m_size == 0) {
+		return true;
+	}
+
+	m_firstEdgeTicks = m_edges[0].deltaTicks;
+
+	uint32_t previous = m_edges[m_size - 1].deltaTicks;
+	for (size_t i = 0; i < m_size; i++) {
+		uint32_t position = m_edges[i].deltaTicks;
+		// wraps around for the first edge
+		m_edges[i].deltaTicks = (i == 0) ? position + cycleTicks - previous : position - previous;
+		previous = position;
+	}
+
+	return true;
+}
+
+int TriggerEmulatorTimeline::getNextEventPhase(int channel, int phase) const {
+	int phaseCount = m_phaseCount[channel];
+
+	for (int i = 0; i < phaseCount; i++) {
+		phase = (phase + 1) % phaseCount;
+		if (m_eventPhases[channel][phase / 32] & (1u << (phase % 32))) {
+			return phase;
+		}
+	}
+
+	return phase;
+}
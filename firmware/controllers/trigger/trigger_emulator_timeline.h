@@ -0,0 +1,87 @@
+/**
+ * @file trigger_emulator_timeline.h
+ * @brief All trigger emulator channels flattened into one sorted list of edges
+ *
+ * Timeline cycle is one cam revolution, SIMULATION_CYCLE_PERIOD units long, same time base as
+ * TriggerStimulatorHelper uses. Crank waveform repeats as many times as it fits into the cycle.
+ * Edges of different channels which happen at the same time share one entry, so a single timer
+ * walking the list with a cursor replaces one PWM generator per channel.
+ *
+ * Set and reset masks have the same layout as the two halves of GPIO BSRR, so a port which has all
+ * emulator pins on one GPIO could stream them by DMA.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include "trigger_emulator_algo.h"
+#include "trigger_simulator.h"
+
+#ifndef TRIGGER_EMULATOR_TIMELINE_SIZE
+// 60-2 crank repeated twice plus a couple of cam teeth fits with room to spare
+#define TRIGGER_EMULATOR_TIMELINE_SIZE 512
+#endif
+
+#define TRIGGER_EMULATOR_PIN_BIT(channel, wave) (1 << ((channel) * PWM_PHASE_MAX_WAVE_PER_PWM + (wave)))
+#define TRIGGER_EMULATOR_CHANNEL_MASK(channel) (((1 << PWM_PHASE_MAX_WAVE_PER_PWM) - 1) << ((channel) * PWM_PHASE_MAX_WAVE_PER_PWM))
+
+static_assert(NUM_EMULATOR_CHANNELS * PWM_PHASE_MAX_WAVE_PER_PWM <= 16, "pin masks are 16 bit");
+
+struct TriggerEmulatorEdge {
+	// since previous edge, first edge counts from the last edge of previous cycle
+	uint32_t deltaTicks;
+	uint16_t setMask;
+	uint16_t resetMask;
+};
+
+class TriggerEmulatorTimeline {
+public:
+	/**
+	 * @param waveforms one per emulator channel, crank first, null or empty ones are skipped
+	 * @param repetitions how many times each waveform repeats within timeline cycle
+	 * @return false if edges do not fit, timeline is empty then
+	 * Sorts all edges, so thread context only, not from scheduler callbacks.
+	 */
+	bool compile(const MultiChannelStateSequence * const waveforms[NUM_EMULATOR_CHANNELS],
+			const int repetitions[NUM_EMULATOR_CHANNELS]);
+
+	size_t size() const {
+		return m_size;
+	}
+
+	const TriggerEmulatorEdge& operator[](size_t index) const {
+		return m_edges[index];
+	}
+
+	// time from cycle start to the first edge
+	uint32_t getFirstEdgeTicks() const {
+		return m_firstEdgeTicks;
+	}
+
+	/**
+	 * Phase of channel waveform which the next edge of that channel comes from, edges of a channel
+	 * come in phase order and phases which change none of the played pins have no edge.
+	 * Only looks at what was compiled, so it is fine while the waveform itself is being rebuilt.
+	 */
+	int getNextEventPhase(int channel, int phase) const;
+
+	static constexpr uint32_t cycleTicks = SIMULATION_CYCLE_PERIOD;
+
+private:
+	void addEdge(uint32_t ticks, uint16_t bit, bool isRise);
+
+	TriggerEmulatorEdge m_edges[TRIGGER_EMULATOR_TIMELINE_SIZE];
+	size_t m_size = 0;
+	uint32_t m_firstEdgeTicks = 0;
+	bool m_overflow = false;
+
+	int m_phaseCount[NUM_EMULATOR_CHANNELS] = {};
+	// bit per phase which has an edge
+	uint32_t m_eventPhases[NUM_EMULATOR_CHANNELS][(PWM_PHASE_MAX_COUNT + 31) / 32] = {};
+};
+
+/**
+ * How many times each channel repeats within one cam revolution for given operation mode
+ */
+void getTriggerEmulatorRepetitions(operation_mode_e mode, int repetitions[NUM_EMULATOR_CHANNELS]);
@@ -0,0 +1,82 @@
+/**
+ * @file trigger_shape_db.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#if EFI_TRIGGER_SHAPE_DB
+
+#include "trigger_shape_db.h"
+#include "crc32_fast.h"
+
+#include <array>
+
+#include "trigger_shape_db_generated.h"
+
+/**
+ * Switch times and gap ratios are floats computed on the host for the table and on the MCU at
+ * runtime, coarse fixed point keeps last bit differences out of the hash.
+ */
+static int32_t quantize(float value) {
+	return std::isnan(value) ? -1 : (int32_t)(value * 10000 + 0.5f);
+}
+
+uint32_t getTriggerShapeHash(const TriggerWaveform& shape) {
+	uint32_t hash = 0;
+	auto add = [&hash](int32_t value) {
+		hash = crc32FastInc(&value, hash, sizeof(value));
+	};
+
+	add(shape.getWheelOperationMode());
+	add(shape.wave.phaseCount);
+	add(shape.wave.waveCount);
+
+	for (int phase = 0; phase < shape.wave.phaseCount; phase++) {
+		int32_t states = 0;
+		for (int wave = 0; wave < shape.wave.waveCount; wave++) {
+			states |= (shape.wave.getChannelState(wave, phase) == TriggerValue::RISE) << wave;
+		}
+
+		add(quantize(shape.wave.getSwitchTime(phase)));
+		add(states);
+	}
+
+	add(shape.gapTrackingLength);
+	for (int i = 0; i < shape.gapTrackingLength; i++) {
+		add(quantize(shape.synchronizationRatioFrom[i]));
+		add(quantize(shape.synchronizationRatioTo[i]));
+	}
+
+	add((int32_t)shape.syncEdge);
+	add(shape.isSynchronizationNeeded);
+	add(shape.useOnlyPrimaryForSync);
+	add(shape.useOnlyRisingEdges);
+
+	return hash;
+}
+
+expected<uint32_t> lookupTriggerSyncIndex(const TriggerWaveform& shape, trigger_type_e type) {
+	if (shape.shapeDefinitionError) {
+		return unexpected;
+	}
+
+	uint32_t hash = getTriggerShapeHash(shape);
+
+	// table is sorted by hash
+	auto it = std::lower_bound(triggerShapeDb.begin(), triggerShapeDb.end(), hash,
+		[](const TriggerShapeDbEntry& entry, uint32_t value) {
+			return entry.shapeHash < value;
+		});
+
+	for (; it != triggerShapeDb.end() && it->shapeHash == hash; it++) {
+		if (it->triggerType == (uint16_t)type && it->syncIndex < shape.getSize()) {
+			return it->syncIndex;
+		}
+	}
+
+	return unexpected;
+}
+
+#endif // EFI_TRIGGER_SHAPE_DB
@@ -0,0 +1,23 @@
+/**
+ * @file trigger_shape_db.h
+ * @brief Sync point indexes of all known trigger shapes, computed by the unit test suite
+ *
+ * Finding the sync point means running the decoder over simulated revolutions of the shape, which
+ * is the expensive part of trigger initialization. Shapes are looked up by a hash of everything the
+ * decoder looks at while syncing, so a shape with gap overrides, or one which was changed without
+ * regenerating the table, simply misses and falls back to the simulation.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+struct TriggerShapeDbEntry {
+	uint32_t shapeHash;
+	uint16_t triggerType;
+	uint16_t syncIndex;
+};
+
+uint32_t getTriggerShapeHash(const TriggerWaveform& shape);
+
+expected<uint32_t> lookupTriggerSyncIndex(const TriggerWaveform& shape, trigger_type_e type);
@@ -32,10 +32,10 @@ struct TraceEntry
 // Ensure that the struct is the size we think it is - the binary layout is important
 static_assert(sizeof(TraceEntry) == 8);
 
-#define TRACE_BUFFER_LENGTH (BIG_BUFFER_SIZE / sizeof(TraceEntry))
-
 // This buffer stores a trace - we write the full buffer once, then disable tracing
 static BigBufferHandle s_traceBuffer;
+// entries, depends on how much of the big buffer is free
+static size_t s_traceLength = 0;
 static size_t s_nextIdx = 0;
 
 static bool s_isTracing = false;
@@ -73,7 +73,7 @@ static void perfEventImpl(PE event, EPhase phase) {
 		__disable_irq();
 
 		idx = s_nextIdx++;
-		if (s_nextIdx >= TRACE_BUFFER_LENGTH) {
+		if (s_nextIdx >= s_traceLength) {
 			stopTrace();
 		}
 
@@ -121,15 +121,9 @@ void perfEventInstantGlobal(PE event) {
 }
 
 void perfTraceEnable() {
-#if EFI_TOOTH_LOGGER
-	// force release of the buffer if occupied by the tooth logger
-	if (IsToothLoggerEnabled()) {
-		// don't worry, it will be automatically enabled
-		// when the next TS_GET_COMPOSITE_BUFFER_DONE_DIFFERENTLY command arrives
-		DisableToothLogger();
-	}
-#endif // EFI_TOOTH_LOGGER
-	s_traceBuffer = getBigBuffer(BigBufferUser::PerfTrace);
+	s_traceBuffer = {};
+	s_traceBuffer = getBigBuffer(BigBufferUser::PerfTrace, sizeof(TraceEntry));
+	s_traceLength = s_traceBuffer.size() / sizeof(TraceEntry);
 	s_isTracing = true;
 }
 
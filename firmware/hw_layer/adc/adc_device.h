@@ -9,12 +9,18 @@
 
 #if HAL_USE_ADC
 
+#ifndef ADC_MAX_CHANNELS_COUNT
+#define ADC_MAX_CHANNELS_COUNT 16
+#endif /* ADC_MAX_CHANNELS_COUNT */
+
 class AdcDevice {
 public:
 	explicit AdcDevice(ADCDriver *p_adcp, ADCConversionGroup* p_hwConfig, volatile adcsample_t *p_buf, size_t p_depth);
 	int enableChannel(adc_channel_e hwChannel);
 	/* Should be called from ISR context */
 	void startConversionI(void);
+	/* Should be called from ISR context once DMA buffer is complete */
+	void onConversionDoneI(void);
 	adc_channel_e getAdcChannelByInternalIndex(int index) const;
 	adcsample_t getAvgAdcValue(adc_channel_e hwChannel);
 	adcsample_t getAdcValueByToken(AdcToken token)
@@ -34,6 +40,8 @@ private:
 	volatile adcsample_t *samples;
 	size_t depth;
 	uint8_t internalAdcIndexByHardwareIndex[EFI_ADC_TOTAL_CHANNELS];
+	/* per logical channel, updated once per complete buffer */
+	volatile adcsample_t averages[ADC_MAX_CHANNELS_COUNT] = {};
 	/**
 	 * Number of ADC channels in use
 	 */
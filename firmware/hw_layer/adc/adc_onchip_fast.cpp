@@ -28,10 +28,7 @@
 #include "mpu_util.h"
 #include "periodic_thread_controller.h"
 #include "protected_gpio.h"
-
-#ifndef ADC_MAX_CHANNELS_COUNT
-#define ADC_MAX_CHANNELS_COUNT 16
-#endif /* ADC_MAX_CHANNELS_COUNT */
+#include "adc_accumulate.h"
 
 #if EFI_USE_FAST_ADC
 
@@ -125,7 +122,8 @@ static ADCConversionGroup adcgrpcfgFast = {
 #endif /* ADC_MAX_CHANNELS_COUNT */
 };
 
-static volatile NO_CACHE adcsample_t fastAdcSampleBuf[ADC_BUF_DEPTH_FAST * ADC_MAX_CHANNELS_COUNT];
+// word aligned so accumulation can take two samples per load
+alignas(4) static volatile NO_CACHE adcsample_t fastAdcSampleBuf[ADC_BUF_DEPTH_FAST * ADC_MAX_CHANNELS_COUNT];
 
 AdcDevice fastAdc(&ADC_FAST_DEVICE, &adcgrpcfgFast, fastAdcSampleBuf, ADC_BUF_DEPTH_FAST);
 
@@ -141,6 +139,7 @@ static void fastAdcDoneCB(ADCDriver *adcp) {
 		engine->outputChannels.fastAdcPeriod = (uint32_t)diff;
 		engine->outputChannels.fastAdcConversionCount++;
 
+		fastAdc.onConversionDoneI();
 		onFastAdcComplete(adcp->samples);
 	}
 
@@ -269,29 +268,37 @@ void AdcDevice::startConversionI()
 	chSysUnlockFromISR();
 }
 
+void AdcDevice::onConversionDoneI() {
+	static_assert(sizeof(adcsample_t) == sizeof(uint16_t));
+	uint32_t sums[ADC_MAX_CHANNELS_COUNT];
+	size_t numChannels = size();
+
+	/* drop volatile type qualifier - buffer is complete, same as at conversion start */
+	uint16_t orAll = adcAccumulateInterleaved((const uint16_t *)samples, numChannels, depth, sums, ADC_MAX_VALUE);
+
+	// ADC_MAX_VALUE is all ones, so single compare of OR-ed samples covers every sample
+	if (orAll > ADC_MAX_VALUE) {
+		// 12bit ADC expected right now. An error here usually means major RAM corruption?
+		criticalError("ADC unexpected sample %d at %ld uptime.",
+			orAll,
+			(uint32_t)getTimeNowS());
+		return;
+	}
+
+	for (size_t ch = 0; ch < numChannels; ch++) {
+		// this truncation is guaranteed to not be lossy - the average can't be larger than adcsample_t
+		averages[ch] = static_cast<adcsample_t>(sums[ch] / depth);
+	}
+}
+
 adcsample_t AdcDevice::getAvgAdcValue(adc_channel_e hwChannel) {
-	uint32_t result = 0;
-	int numChannels = size();
-	int index = fastAdc.internalAdcIndexByHardwareIndex[hwChannel];
+	int index = internalAdcIndexByHardwareIndex[hwChannel];
 	if (index == 0xff) {
 		criticalError("Fast ADC attempt to read unconfigured input %d.", hwChannel);
 		return 0;
 	}
 
-	for (size_t i = 0; i < depth; i++) {
-		adcsample_t sample = samples[index];
-		if (sample > ADC_MAX_VALUE) {
-		  // 12bit ADC expected right now. An error here usually means major RAM corruption?
- 			criticalError("ADC unexpected sample %d at %ld uptime.",
-				sample,
-				(uint32_t)getTimeNowS());
-		}
-		result += sample;
-		index += numChannels;
-	}
-
-	// this truncation is guaranteed to not be lossy - the average can't be larger than adcsample_t
-	return static_cast<adcsample_t>(result / depth);
+	return averages[index];
 }
 
 adc_channel_e AdcDevice::getAdcChannelByInternalIndex(int hwChannel) const {
@@ -0,0 +1,87 @@
+/**
+ * @file	adc_accumulate.h
+ * @brief	Per-channel accumulation of interleaved ADC DMA buffer
+ *
+ * DMA buffer layout is buf[row * channels + channel]. Whole buffer is summed once per conversion
+ * so readers do not have to walk it on every call.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+#ifndef ADC_ACCUMULATE_MAX_CHANNELS
+#define ADC_ACCUMULATE_MAX_CHANNELS 32
+#endif
+
+/**
+ * Sum of each channel over all rows into sums[0..channels).
+ * @return bitwise OR of all samples, so caller can range check whole buffer with one compare
+ */
+static inline uint16_t adcAccumulateScalar(const uint16_t *buf, size_t channels, size_t depth, uint32_t *sums) {
+	uint16_t orAll = 0;
+
+	for (size_t ch = 0; ch < channels; ch++) {
+		sums[ch] = 0;
+	}
+
+	for (size_t row = 0; row < depth; row++) {
+		const uint16_t *rowSamples = buf + row * channels;
+		for (size_t ch = 0; ch < channels; ch++) {
+			sums[ch] += rowSamples[ch];
+			orAll |= rowSamples[ch];
+		}
+	}
+
+	return orAll;
+}
+
+#if defined(__ARM_FEATURE_SIMD32)
+/**
+ * Two channels per 32 bit word with UADD16, halfword lanes do not overflow as long as
+ * depth * maxSample < 65536 (16 rows of 12 bit samples)
+ */
+static inline uint16_t adcAccumulatePacked(const uint16_t *buf, size_t channels, size_t depth, uint32_t *sums) {
+	const uint32_t *words = reinterpret_cast<const uint32_t *>(buf);
+	size_t wordsPerRow = channels / 2;
+	uint32_t acc[ADC_ACCUMULATE_MAX_CHANNELS / 2] = {};
+	uint32_t orAll = 0;
+
+	for (size_t row = 0; row < depth; row++) {
+		const uint32_t *rowWords = words + row * wordsPerRow;
+		for (size_t w = 0; w < wordsPerRow; w++) {
+			uint32_t word = rowWords[w];
+			acc[w] = __uadd16(acc[w], word);
+			orAll |= word;
+		}
+	}
+
+	for (size_t w = 0; w < wordsPerRow; w++) {
+		// little endian: lower halfword is the lower channel index
+		sums[2 * w] = acc[w] & 0xffff;
+		sums[2 * w + 1] = acc[w] >> 16;
+	}
+
+	return (orAll | (orAll >> 16)) & 0xffff;
+}
+#endif
+
+static inline uint16_t adcAccumulateInterleaved(const uint16_t *buf, size_t channels, size_t depth, uint32_t *sums, uint16_t maxSample = 4095) {
+#if defined(__ARM_FEATURE_SIMD32)
+	bool packedFits = (depth * maxSample) <= 0xffff;
+	bool wordAligned = ((channels & 1) == 0) && ((reinterpret_cast<uintptr_t>(buf) & 3) == 0);
+	if (packedFits && wordAligned && channels <= ADC_ACCUMULATE_MAX_CHANNELS) {
+		return adcAccumulatePacked(buf, channels, depth, sums);
+	}
+#else
+	(void)maxSample;
+#endif
+	return adcAccumulateScalar(buf, channels, depth, sums);
+}
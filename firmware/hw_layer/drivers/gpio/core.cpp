@@ -40,6 +40,14 @@ struct gpiochip {
 
 static gpiochip chips[BOARD_EXT_GPIOCHIPS];
 
+#define EXT_PIN_FIRST		((int)BRAIN_PIN_ONCHIP_LAST + 1)
+#define EXT_PIN_COUNT		((int)BRAIN_PIN_LAST - (int)BRAIN_PIN_ONCHIP_LAST)
+
+static_assert(BOARD_EXT_GPIOCHIPS < 255, "chip index does not fit lookup table");
+
+/* index + 1 of chip owning each external pin, 0 - no chip */
+static uint8_t chipByExtPin[EXT_PIN_COUNT];
+
 #if EFI_PROD_CODE
 
 /* TODO: move inside gpio chip driver? */
@@ -90,19 +98,31 @@ static external_hardware_pwm extPwms[5];
 /* Local functions.															*/
 /*==========================================================================*/
 
+static void gpiochip_setLookup(brain_pin_e base, size_t size, uint8_t value)
+{
+	int first = (int)base - EXT_PIN_FIRST;
+
+	for (size_t i = 0; i < size; i++)
+		chipByExtPin[first + i] = value;
+}
+
 /**
  * @return pointer to GPIO device for specified pin
+ * @details called for every smart GPIO write, so this is a table load instead of walking all chips
  */
 static gpiochip *gpiochip_find(brain_pin_e pin)
 {
-	for (int i = 0; i < BOARD_EXT_GPIOCHIPS; i++) {
-		gpiochip *chip = &chips[i];
+	unsigned int offset = (int)pin - EXT_PIN_FIRST;
 
-		if ((pin >= chip->base) && (pin < (chip->base + chip->size)))
-			return chip;
-	}
+	/* on-chip pins wrap to large unsigned values */
+	if (offset >= (unsigned int)EXT_PIN_COUNT)
+		return nullptr;
 
-	return nullptr;
+	uint8_t index = chipByExtPin[offset];
+	if (!index)
+		return nullptr;
+
+	return &chips[index - 1];
 }
 
 #if EFI_PROD_CODE
@@ -225,6 +245,8 @@ int gpiochip_register(brain_pin_e base, const char *name, GpioChip& gpioChip, si
 	chip->size = size;
 	chip->gpio_names = nullptr;
 
+	gpiochip_setLookup(base, size, chip - chips + 1);
+
 	// TODO: this cast seems wrong?
 	return (int)base;
 }
@@ -247,6 +269,8 @@ int gpiochip_unregister(brain_pin_e base)
 	if (chip->base != base)
 		return -106;
 
+	gpiochip_setLookup(chip->base, chip->size, 0);
+
 	/* unregister chip */
 	chip->name = nullptr;
 	chip->chip = nullptr;
@@ -296,6 +320,7 @@ int gpiochips_init(void) {
 			    // todo: adjust unit tests to validate this fatal
 			    criticalError("Failed to init chip %d: %d", i, ret);
 			#else
+    			gpiochip_setLookup(chip->base, chip->size, 0);
     			chip->base = Gpio::Unassigned;
       #endif
 		} else {
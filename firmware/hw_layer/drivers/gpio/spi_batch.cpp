@@ -0,0 +1,242 @@
+/**
+ * @file	spi_batch.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "gpio/spi_batch.h"
+
+static_assert(SPI_BATCH_MAX_CLIENTS < 32, "pending mask is 32 bit");
+
+SpiBatchEngine::SpiBatchEngine(SpiBatchBus *bus)
+	: m_bus(bus)
+{
+}
+
+int SpiBatchEngine::addClient(SpiBatchClient *client) {
+	if (m_clientCount >= SPI_BATCH_MAX_CLIENTS) {
+		return -1;
+	}
+
+	m_clients[m_clientCount] = client;
+	return m_clientCount++;
+}
+
+bool SpiBatchEngine::request(int id) {
+	if ((id < 0) || (id >= m_clientCount)) {
+		return false;
+	}
+
+	chibios_rt::CriticalSectionLocker csl;
+
+	uint32_t mask = 1 << id;
+	bool wasIdle = (m_pending == 0);
+
+	if (m_pending & mask) {
+		// chip will pick up latest output state anyway
+		coalescedCounter++;
+		return false;
+	}
+
+	m_pending = m_pending | mask;
+	m_requestNt[id] = getTimeNowNt();
+	requestCounter++;
+
+	return wasIdle;
+}
+
+bool SpiBatchEngine::requestAll() {
+	chibios_rt::CriticalSectionLocker csl;
+
+	bool wasIdle = (m_pending == 0);
+	efitick_t nowNt = getTimeNowNt();
+
+	for (int i = 0; i < m_clientCount; i++) {
+		if (!(m_pending & (1 << i))) {
+			m_requestNt[i] = nowNt;
+		}
+	}
+	m_pending = (1u << m_clientCount) - 1;
+
+	return wasIdle;
+}
+
+int SpiBatchEngine::flush() {
+	uint32_t pending;
+	efitick_t requestNt[SPI_BATCH_MAX_CLIENTS];
+
+	{
+		chibios_rt::CriticalSectionLocker csl;
+
+		pending = m_pending;
+		// requests arriving while we talk to the chips start next batch
+		m_pending = 0;
+		for (int i = 0; i < m_clientCount; i++) {
+			requestNt[i] = m_requestNt[i];
+		}
+	}
+
+	if (!pending || !m_bus) {
+		return 0;
+	}
+
+	int flushed = 0;
+
+	m_bus->acquire();
+
+	for (int i = 0; i < m_clientCount; i++) {
+		if (!(pending & (1 << i))) {
+			continue;
+		}
+
+		if (m_clients[i]->flushOutputs() != 0) {
+			errorCounter++;
+		}
+		flushed++;
+
+		efidur_t latencyNt = getTimeNowNt() - requestNt[i];
+		lastLatencyNt = latencyNt;
+		maxLatencyNt = std::max(maxLatencyNt, latencyNt);
+		totalLatencyNt += latencyNt;
+	}
+
+	m_bus->release();
+
+	flushCounter++;
+	clientFlushCounter += flushed;
+
+	return flushed;
+}
+
+void SpiBatchEngine::printStats(const char *name) const {
+	// latency goes to smartGpioSpiLatency* output channels, see reportSpiBatchToTS
+	efiPrintf("%s: %d requests, %d coalesced, %d bus transactions, %d chip updates, %d errors",
+		name, requestCounter, coalescedCounter, flushCounter, clientFlushCounter, errorCounter);
+}
+
+#if EFI_PROD_CODE && HAL_USE_SPI
+
+#include "thread_controller.h"
+
+/* one engine per SPI peripheral carrying smart GPIO chips, never more than there are chips using it */
+#ifndef SPI_BATCH_MAX_BUSES
+#define SPI_BATCH_MAX_BUSES	(BOARD_TLE6240_COUNT < 3 ? BOARD_TLE6240_COUNT : 3)
+#endif
+
+class ChibiSpiBatchBus : public SpiBatchBus {
+public:
+	void acquire() override {
+		spiAcquireBus(spi);
+	}
+
+	void release() override {
+		spiReleaseBus(spi);
+	}
+
+	SPIDriver *spi = nullptr;
+};
+
+class SpiBatchThread : public ThreadController<256> {
+public:
+	SpiBatchThread()
+		: ThreadController("spi batch", PRIO_GPIOCHIP)
+	{
+		chBSemObjectInit(&m_wake, true);
+		engine.setBus(&bus);
+	}
+
+	void wakeI() {
+		chBSemSignalI(&m_wake);
+	}
+
+	ChibiSpiBatchBus bus;
+	SpiBatchEngine engine;
+
+protected:
+	void ThreadTask() override {
+		while (true) {
+			msg_t msg = chBSemWaitTimeout(&m_wake, TIME_MS2I(SPI_BATCH_POLL_INTERVAL_MS));
+
+			if (msg == MSG_TIMEOUT) {
+				/* periodic diagnostic refresh */
+				engine.requestAll();
+			}
+
+			engine.flush();
+		}
+	}
+
+private:
+	binary_semaphore_t m_wake;
+};
+
+#if SPI_BATCH_MAX_BUSES > 0
+/* threads and their stacks only exist on boards with chips using the engine */
+static SpiBatchThread spiBatchThreads[SPI_BATCH_MAX_BUSES];
+
+SpiBatchEngine *spiBatchGetEngine(SPIDriver *spi) {
+	for (size_t i = 0; i < efi::size(spiBatchThreads); i++) {
+		SpiBatchThread &thread = spiBatchThreads[i];
+
+		if (thread.bus.spi == spi) {
+			return &thread.engine;
+		}
+
+		if (!thread.bus.spi) {
+			thread.bus.spi = spi;
+			thread.start();
+			return &thread.engine;
+		}
+	}
+
+	criticalError("Run out of SPI batch engines");
+	return nullptr;
+}
+
+void spiBatchRequest(SpiBatchEngine *engine, int id) {
+	if (!engine->request(id)) {
+		return;
+	}
+
+	for (size_t i = 0; i < efi::size(spiBatchThreads); i++) {
+		if (&spiBatchThreads[i].engine == engine) {
+			/* Entering a reentrant critical zone.*/
+			chibios_rt::CriticalSectionLocker csl;
+
+			spiBatchThreads[i].wakeI();
+			if (!port_is_isr_context()) {
+				/**
+				 * chBSemSignalI above requires rescheduling
+				 * interrupt handlers have implicit rescheduling
+				 */
+				chSchRescheduleS();
+			}
+			return;
+		}
+	}
+}
+
+#endif /* SPI_BATCH_MAX_BUSES */
+
+void reportSpiBatchToTS() {
+#if EFI_TUNER_STUDIO && SPI_BATCH_MAX_BUSES > 0
+	uint32_t flushes = 0;
+	efidur_t totalNt = 0;
+	efidur_t maxNt = 0;
+
+	for (size_t i = 0; i < efi::size(spiBatchThreads); i++) {
+		const SpiBatchEngine &batch = spiBatchThreads[i].engine;
+		flushes += batch.clientFlushCounter;
+		totalNt += batch.totalLatencyNt;
+		maxNt = std::max(maxNt, batch.maxLatencyNt);
+	}
+
+	efidur_t averageNt = flushes ? totalNt / flushes : 0;
+	engine->outputChannels.smartGpioSpiLatencyAvg = std::min<efidur_t>(NT2US(averageNt), UINT16_MAX);
+	engine->outputChannels.smartGpioSpiLatencyMax = std::min<efidur_t>(NT2US(maxNt), UINT16_MAX);
+#endif /* EFI_TUNER_STUDIO && SPI_BATCH_MAX_BUSES */
+}
+
+#endif /* EFI_PROD_CODE && HAL_USE_SPI */
@@ -0,0 +1,120 @@
+/**
+ * @file	spi_batch.h
+ * @brief	Shared SPI update engine for smart GPIO chips
+ *
+ * Each smart switch driver used to own a thread which woke up on every writePad() and re-acquired
+ * SPI bus for every 16 bit frame. Chips sitting on the same bus now register as clients of one
+ * engine: writePad() only marks the chip pending, engine wakes once and flushes all pending
+ * chips back-to-back while holding the bus. Several writes to the same chip between two flushes
+ * are coalesced into one output register update.
+ *
+ * Chips keep their own chip select, so frames of different chips can not be merged into a single
+ * transfer; what is merged is the bus ownership and the wakeup.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include "rusefi_types.h"
+
+#ifndef SPI_BATCH_MAX_CLIENTS
+#define SPI_BATCH_MAX_CLIENTS	8
+#endif
+
+/* engine refreshes all clients (diagnostic) at least this often */
+#ifndef SPI_BATCH_POLL_INTERVAL_MS
+#define SPI_BATCH_POLL_INTERVAL_MS	100
+#endif
+
+class SpiBatchClient {
+public:
+	/**
+	 * Send pending output state to the chip and read back diagnostic.
+	 * Called from engine context with bus already acquired.
+	 */
+	virtual int flushOutputs() = 0;
+};
+
+class SpiBatchBus {
+public:
+	virtual void acquire() = 0;
+	virtual void release() = 0;
+};
+
+class SpiBatchEngine {
+public:
+	explicit SpiBatchEngine(SpiBatchBus *bus = nullptr);
+
+	void setBus(SpiBatchBus *bus) {
+		m_bus = bus;
+	}
+
+	/**
+	 * @return client id or -1 if no slots left
+	 */
+	int addClient(SpiBatchClient *client);
+
+	/**
+	 * Mark client pending, safe from ISR.
+	 * @return true if engine was idle and needs to be woken up
+	 */
+	bool request(int id);
+	bool requestAll();
+
+	/**
+	 * Flush all pending clients in one bus acquisition.
+	 * @return number of clients flushed
+	 */
+	int flush();
+
+	bool hasPending() const {
+		return m_pending != 0;
+	}
+
+	void printStats(const char *name) const;
+
+	// writePad() calls which marked client pending
+	uint32_t requestCounter = 0;
+	// writePad() calls coalesced into an already pending update
+	uint32_t coalescedCounter = 0;
+	// bus acquisitions
+	uint32_t flushCounter = 0;
+	// chip updates sent
+	uint32_t clientFlushCounter = 0;
+	uint32_t errorCounter = 0;
+
+	// request to SPI complete, published as smartGpioSpiLatency* output channels
+	efidur_t lastLatencyNt = 0;
+	efidur_t maxLatencyNt = 0;
+	efidur_t totalLatencyNt = 0;
+
+private:
+	SpiBatchBus *m_bus;
+	SpiBatchClient *m_clients[SPI_BATCH_MAX_CLIENTS] = {};
+	int m_clientCount = 0;
+
+	// bit per client
+	volatile uint32_t m_pending = 0;
+	// time of the first request since client was last flushed
+	efitick_t m_requestNt[SPI_BATCH_MAX_CLIENTS] = {};
+};
+
+#if EFI_PROD_CODE && HAL_USE_SPI
+
+/**
+ * @return engine serving given bus, started on first use
+ */
+SpiBatchEngine *spiBatchGetEngine(SPIDriver *spi);
+
+/**
+ * Mark client pending and wake its engine
+ */
+void spiBatchRequest(SpiBatchEngine *engine, int id);
+
+/**
+ * Publish request to SPI completion latency of all engines to output channels
+ */
+void reportSpiBatchToTS();
+
+#endif /* EFI_PROD_CODE && HAL_USE_SPI */
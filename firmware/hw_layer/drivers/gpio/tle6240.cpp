@@ -24,6 +24,7 @@
 
 #include "gpio/gpio_ext.h"
 #include "gpio/tle6240.h"
+#include "gpio/spi_batch.h"
 
 #if defined(BOARD_TLE6240_COUNT) && (BOARD_TLE6240_COUNT > 0)
 
@@ -46,8 +47,6 @@
 
 #define DRIVER_NAME				"tle6240"
 
-static bool drv_task_ready = false;
-
 typedef enum {
 	TLE6240_DISABLED = 0,
 	TLE6240_WAIT_INIT,
@@ -76,16 +75,15 @@ typedef enum {
 /* Driver local variables and types.										*/
 /*==========================================================================*/
 
-/* OS */
-SEMAPHORE_DECL(tle6240_wake, 10 /* or BOARD_TLE6240_COUNT ? */);
-static THD_WORKING_AREA(tle6240_thread_1_wa, 256);
-
 /* Driver */
-struct Tle6240 : public GpioChip {
+struct Tle6240 : public GpioChip, public SpiBatchClient {
 	int init() override;
 
 	int writePad(size_t pin, int value) override;
 	brain_pin_diag_e getDiag(size_t pin) override;
+	void debug() override;
+
+	int flushOutputs() override;
 
 
 	// internal functions
@@ -95,6 +93,11 @@ struct Tle6240 : public GpioChip {
 
 
 	const tle6240_config	*cfg;
+	/* shared update engine of our SPI bus */
+	SpiBatchEngine				*engine;
+	int							engine_id;
+	/* bus is held by engine for the whole batch */
+	bool						bus_acquired;
 	/* cached output state - state last send to chip */
 	uint16_t					o_state_cached;
 	/* state to be sended to chip */
@@ -135,7 +138,8 @@ int Tle6240::spi_rw(uint16_t tx, uint16_t *rx)
 	SPIDriver *spi = cfg->spi_bus;
 
 	/* Acquire ownership of the bus. */
-	spiAcquireBus(spi);
+	if (!bus_acquired)
+		spiAcquireBus(spi);
 	/* Setup transfer parameters. */
 	spiStart(spi, &cfg->spi_config);
 	/* Slave Select assertion. */
@@ -145,7 +149,8 @@ int Tle6240::spi_rw(uint16_t tx, uint16_t *rx)
 	/* Slave Select de-assertion. */
 	spiUnselect(spi);
 	/* Ownership release. */
-	spiReleaseBus(spi);
+	if (!bus_acquired)
+		spiReleaseBus(spi);
 
 	if (rx)
 		*rx = rxb;
@@ -303,62 +308,27 @@ err_gpios:
 }
 
 /**
- * @brief TLE6240 chip driver wakeup.
- * @details Wake up driver. Will cause output register and
- * diagnostic update.
+ * @brief TLE6240 output update from SPI batch engine.
+ * @details Called with SPI bus already acquired, together with other chips on the same bus.
  */
 
-static int tle6240_wake_driver()
+int Tle6240::flushOutputs()
 {
-	/* Entering a reentrant critical zone.*/
-	chibios_rt::CriticalSectionLocker csl;
-
-	chSemSignalI(&tle6240_wake);
-	if (!port_is_isr_context()) {
-		/**
-		 * chSemSignalI above requires rescheduling
-		 * interrupt handlers have implicit rescheduling
-		 */
-		chSchRescheduleS();
-	}
-
-	return 0;
-}
-
-/*==========================================================================*/
-/* Driver thread.															*/
-/*==========================================================================*/
-
-static THD_FUNCTION(tle6240_driver_thread, p)
-{
-	int i;
-	msg_t msg;
-
-	(void)p;
-
-	chRegSetThreadName(DRIVER_NAME);
-
-	while(1) {
-		msg = chSemWaitTimeout(&tle6240_wake, TIME_MS2I(TLE6240_POLL_INTERVAL_MS));
-
-		/* should we care about msg == MSG_TIMEOUT? */
-		(void)msg;
+	int ret;
 
-		for (i = 0; i < BOARD_TLE6240_COUNT; i++) {
-			int ret;
-			Tle6240& chip = chips[i];
+	if ((drv_state == TLE6240_DISABLED) ||
+		(drv_state == TLE6240_FAILED))
+		return 0;
 
-			if (!chip.cfg ||
-				(chip.drv_state == TLE6240_DISABLED) ||
-				(chip.drv_state == TLE6240_FAILED))
-				continue;
+	bus_acquired = true;
+	ret = update_output_and_diag();
+	bus_acquired = false;
 
-			ret = chip.update_output_and_diag();
-			if (ret) {
-				/* set state to TLE6240_FAILED? */
-			}
-		}
+	if (ret) {
+		/* set state to TLE6240_FAILED? */
 	}
+
+	return ret;
 }
 
 /*==========================================================================*/
@@ -396,8 +366,8 @@ int Tle6240::writePad(unsigned int pin, int value)
 		else
 			palClearPort(cfg->direct_io[n].port,
 					   PAL_PORT_BIT(cfg->direct_io[n].pad));
-	} else {
-		tle6240_wake_driver();
+	} else if (engine) {
+		spiBatchRequest(engine, engine_id);
 	}
 
 	return 0;
@@ -431,17 +401,24 @@ int Tle6240::init()
 	if (ret)
 		return ret;
 
-	drv_state = TLE6240_READY;
+	engine = spiBatchGetEngine(cfg->spi_bus);
+	if (!engine)
+		return -6;
+	engine_id = engine->addClient(this);
+	if (engine_id < 0)
+		return -7;
 
-	if (!drv_task_ready) {
-		chThdCreateStatic(tle6240_thread_1_wa, sizeof(tle6240_thread_1_wa),
-						  PRIO_GPIOCHIP, tle6240_driver_thread, nullptr);
-		drv_task_ready = true;
-	}
+	drv_state = TLE6240_READY;
 
 	return 0;
 }
 
+void Tle6240::debug()
+{
+	if (engine)
+		engine->printStats(DRIVER_NAME);
+}
+
 /**
  * @brief TLE6240 driver add.
  * @details Checks for valid config
@@ -469,6 +446,9 @@ int tle6240_add(brain_pin_e base, unsigned int index, const tle6240_config *cfg)
 		return -1;
 
 	chip->cfg = cfg;
+	chip->engine = nullptr;
+	chip->engine_id = -1;
+	chip->bus_acquired = false;
 	chip->o_state = 0;
 	chip->o_state_cached = 0;
 	chip->o_direct_mask = 0;
@@ -17,6 +17,7 @@
 #include "sent.h"
 #include "init.h"
 #include "sent_decoder.h"
+#include "sent_pulse_buffer.h"
 
 #ifndef SENT_CHANNELS_NUM
 #define SENT_CHANNELS_NUM		4 // Number of sent channels
@@ -62,58 +63,99 @@ void sent_channel::Info() {
 /* Decoder thread settings.													*/
 /*==========================================================================*/
 
-/* 4 per channel should be enough */
-#define SENT_MB_SIZE		(4 * SENT_CHANNELS_NUM)
+/* Frame is 9..10 pulses, decoder thread is woken once per frame so this holds several frames */
+#ifndef SENT_PULSE_BUFFER_SIZE
+#define SENT_PULSE_BUFFER_SIZE		64
+#endif
+
+/* Wake decoder anyway if this many pulses are pending without frame boundary detected (unit time not known yet) */
+#define SENT_PULSES_PER_WAKEUP		10
+
+/* Timer fallback: pending pulses are decoded at least this often */
+#define SENT_DECODER_POLL_MS		5
+
+static SentPulseBuffer<SENT_PULSE_BUFFER_SIZE> pulseBuffers[SENT_CHANNELS_NUM];
+static uint8_t pulsesSinceWakeup[SENT_CHANNELS_NUM];
 
-static msg_t sent_mb_buffer[SENT_MB_SIZE];
-static MAILBOX_DECL(sent_mb, sent_mb_buffer, SENT_MB_SIZE);
+static binary_semaphore_t sentDecoderSem;
 
 static THD_WORKING_AREA(waSentDecoderThread, 256);
 
+/* Decoded message listeners */
+#define SENT_MAX_LISTENERS		4
+
+static SentListener listeners[SENT_MAX_LISTENERS];
+static size_t listenersCount = 0;
+
+bool sentSubscribe(SentListener listener) {
+	chibios_rt::CriticalSectionLocker csl;
+
+	for (size_t i = 0; i < listenersCount; i++) {
+		if (listeners[i] == listener) {
+			/* already subscribed, init may be called again on config change */
+			return true;
+		}
+	}
+
+	if (listenersCount >= SENT_MAX_LISTENERS) {
+		firmwareError(ObdCode::CUSTOM_ERR_6520, "Too many SENT listeners");
+		return false;
+	}
+
+	listeners[listenersCount] = listener;
+	listenersCount++;
+
+	return true;
+}
+
 void SENT_ISR_Handler(uint8_t channel, uint16_t clocks, uint8_t flags) {
-	/* encode to fit msg_t */
-	msg_t msg = (flags << 24) | (channel << 16) | clocks;
+	if (channel >= SENT_CHANNELS_NUM) {
+		return;
+	}
+
+	/* called from ISR, just store the pulse, decoding is done in batches */
+	pulseBuffers[channel].push(clocks, flags);
 
-	/* called from ISR */
-	chSysLockFromISR();
-	chMBPostI(&sent_mb, msg);
-	chSysUnlockFromISR();
+	/* decoder thread is the only writer of tick time, 32 bit read is atomic */
+	pulsesSinceWakeup[channel]++;
+	if ((sentIsFrameBoundary(channels[channel].getTickTime(), clocks)) ||
+		(pulsesSinceWakeup[channel] >= SENT_PULSES_PER_WAKEUP)) {
+		pulsesSinceWakeup[channel] = 0;
+
+		chSysLockFromISR();
+		chBSemSignalI(&sentDecoderSem);
+		chSysUnlockFromISR();
+	}
 }
 
 static void SentDecoderThread(void*) {
 	while (true) {
-		msg_t ret;
-		msg_t msg;
-
-		ret = chMBFetchTimeout(&sent_mb, &msg, TIME_INFINITE);
-
-		if (ret == MSG_OK) {
-			uint16_t tick = msg & 0xffff;
-			uint8_t n = (msg >> 16) & 0xff;
-			uint8_t flags = (msg >> 24) & 0xff;
-
-			if (n < SENT_CHANNELS_NUM) {
-				sent_channel &channel = channels[n];
-
-				if (channel.Decoder(tick, flags) > 0) {
-					/* report only for first channel */
-					if (n == 0) {
-						uint16_t sig0, sig1;
-						channel.GetSignals(NULL, &sig0, &sig1);
-						engine->sent_state.value0 = sig0;
-						engine->sent_state.value1 = sig1;
-
-						#if SENT_STATISTIC_COUNTERS
-						    engine->sent_state.errorRate = 100.0 * channel.statistic.getErrorRate();
-						#endif // SENT_STATISTIC_COUNTERS
-					}
-
-					SentInput input = static_cast<SentInput>((size_t)SentInput::INPUT1 + n);
-					/* Call high level decoder from here */
-					/* TODO: implemnet subscribers, like it is done for ADC */
-					sentTpsDecode(input);
-					sentPressureDecode(input);
-				}
+		/* timeout is fine: pick up tail of the frame if ISR did not wake us */
+		chBSemWaitTimeout(&sentDecoderSem, TIME_MS2I(SENT_DECODER_POLL_MS));
+
+		for (size_t n = 0; n < SENT_CHANNELS_NUM; n++) {
+			sent_channel &channel = channels[n];
+
+			if (sentDecodePending(pulseBuffers[n], channel) == 0) {
+				continue;
+			}
+
+			/* report only for first channel */
+			if (n == 0) {
+				uint16_t sig0, sig1;
+				channel.GetSignals(NULL, &sig0, &sig1);
+				engine->sent_state.value0 = sig0;
+				engine->sent_state.value1 = sig1;
+
+				#if SENT_STATISTIC_COUNTERS
+				    engine->sent_state.errorRate = 100.0 * channel.statistic.getErrorRate();
+				#endif // SENT_STATISTIC_COUNTERS
+			}
+
+			/* Call high level decoders once per batch, they use latest decoded message */
+			SentInput input = static_cast<SentInput>((size_t)SentInput::INPUT1 + n);
+			for (size_t i = 0; i < listenersCount; i++) {
+				listeners[i](input);
 			}
 		}
 	}
@@ -126,6 +168,7 @@ static void printSentInfo() {
         const char * pinName = getBoardSpecificPinName(engineConfiguration->sentInputPins[i]);
 		efiPrintf("---- SENT input %d ---- on %s", i + 1, pinName);
 		channel.Info();
+		efiPrintf("Pulse buffer overflows %lu", pulseBuffers[i].getOverflowCounter());
 		efiPrintf("--------------------");
 	}
 }
@@ -165,8 +208,7 @@ int getSentValues(SentInput input, uint16_t *sig0, uint16_t *sig1) {
 
 /* Should be called once */
 void initSent(void) {
-	/* init interval mailbox */
-	chMBObjectInit(&sent_mb, sent_mb_buffer, SENT_MB_SIZE);
+	chBSemObjectInit(&sentDecoderSem, true);
 
 	chThdCreateStatic(waSentDecoderThread, sizeof(waSentDecoderThread), NORMALPRIO, SentDecoderThread, nullptr);
 
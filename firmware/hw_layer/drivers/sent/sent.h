@@ -26,4 +26,10 @@ void stopSent();
 float getSentValue(SentInput input);
 int getSentValues(SentInput input, uint16_t *sig0, uint16_t *sig1);
 
+/* Called from decoder thread once per batch of pulses which produced at least one new fast message */
+typedef void (*SentListener)(SentInput input);
+
+/* Safe to call several times with same listener */
+bool sentSubscribe(SentListener listener);
+
 #endif /* EFI_SENT_SUPPORT */
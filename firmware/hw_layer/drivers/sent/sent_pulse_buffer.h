@@ -0,0 +1,100 @@
+/*
+ * sent_pulse_buffer.h
+ *
+ * Lock-free ring of captured SENT pulses between capture ISR (single producer)
+ * and decoder thread (single consumer). ISR only stores pulse width, all decoding
+ * is done in batches from thread context.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include "sent_decoder.h"
+
+/* Sync pulse is 56 units, longest data nibble is 27 units, anything above this is sync or pause */
+#define SENT_SYNC_DETECT_UNITS		40
+
+template <size_t TSize>
+class SentPulseBuffer {
+	static_assert((TSize & (TSize - 1)) == 0, "SENT pulse buffer size should be power of 2");
+
+public:
+	/* ISR context. Returns false if buffer is full and pulse was dropped */
+	bool push(uint16_t clocks, uint8_t flags) {
+		uint32_t head = m_head;
+
+		if (head - m_tail >= TSize) {
+			m_overflowCounter++;
+			/* decoder has lost sync, let it know with next pulse */
+			m_overflowPending = true;
+			return false;
+		}
+
+		if (m_overflowPending) {
+			flags |= SENT_FLAG_HW_OVERFLOW;
+			m_overflowPending = false;
+		}
+
+		m_data[head & (TSize - 1)] = ((uint32_t)flags << 16) | clocks;
+		/* publish only after data is stored */
+		m_head = head + 1;
+
+		return true;
+	}
+
+	/* Thread context */
+	bool pop(uint16_t &clocks, uint8_t &flags) {
+		uint32_t tail = m_tail;
+
+		if (tail == m_head) {
+			return false;
+		}
+
+		uint32_t data = m_data[tail & (TSize - 1)];
+		m_tail = tail + 1;
+
+		clocks = data & 0xffff;
+		flags = (data >> 16) & 0xff;
+
+		return true;
+	}
+
+	size_t getCount() const {
+		return m_head - m_tail;
+	}
+
+	uint32_t getOverflowCounter() const {
+		return m_overflowCounter;
+	}
+
+private:
+	volatile uint32_t m_data[TSize];
+	volatile uint32_t m_head = 0;
+	volatile uint32_t m_tail = 0;
+
+	/* producer-only state */
+	bool m_overflowPending = false;
+	uint32_t m_overflowCounter = 0;
+};
+
+/* ISR side hint: true if pulse is long enough to be sync (or pause) pulse, i.e. previous frame is complete */
+static inline bool sentIsFrameBoundary(uint32_t tickPerUnit, uint16_t clocks) {
+	return (tickPerUnit != 0) && (clocks > tickPerUnit * SENT_SYNC_DETECT_UNITS);
+}
+
+/* Feed all pending pulses to decoder, returns number of decoded fast messages */
+template <size_t TSize>
+int sentDecodePending(SentPulseBuffer<TSize> &buffer, sent_channel &channel) {
+	int messages = 0;
+	uint16_t clocks;
+	uint8_t flags;
+
+	while (buffer.pop(clocks, flags)) {
+		if (channel.Decoder(clocks, flags) > 0) {
+			messages++;
+		}
+	}
+
+	return messages;
+}
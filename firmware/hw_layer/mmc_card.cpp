@@ -1002,8 +1002,8 @@ static int sdTriggerLogger() {
 
 	// can return nullptr
 	if (buffer) {
-		toWrite = buffer->nextIdx * sizeof(composite_logger_s);
-		logBuffer.write(reinterpret_cast<const char*>(buffer->buffer), toWrite);
+		toWrite = buffer->getSizeBytes();
+		logBuffer.write(reinterpret_cast<const char*>(buffer->getData()), toWrite);
 		if (logBuffer.failed) {
 			return -1;
 		}
@@ -79,6 +79,9 @@ void initFluidPressure() {
 #if EFI_SENT_SUPPORT
 	if ((engineConfiguration->FuelHighPressureSentType != SentFuelHighPressureType::NONE) &&
 		(engineConfiguration->FuelHighPressureSentInput != SentInput::NONE)) {
+#if EFI_PROD_CODE
+		sentSubscribe(sentPressureDecode);
+#endif
 		if (engineConfiguration->FuelHighPressureSentType == SentFuelHighPressureType::GM_TYPE) {
 			/* This sensor sends two pressure signals:
 			 * Sig0 occupies 3 first nibbles
@@ -45,6 +45,7 @@ static SensorConverter& configureTempSensorFunction(const char *msg,
 
 		p.thermistor.get<resist>().configure(5.0f, cfg.bias_resistor, isPulldown);
 		p.thermistor.get<therm>().configure(cfg);
+		p.thermistor.configure();
 
 		return p.thermistor;
 	}
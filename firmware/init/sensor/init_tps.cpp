@@ -7,6 +7,7 @@
 #include "proxy_sensor.h"
 #include "linear_func.h"
 #include "tps.h"
+#include "sent.h"
 #include "auto_generated_sensor.h"
 #include "defaults.h"
 
@@ -221,6 +222,9 @@ void initTps() {
 
 #if EFI_SENT_SUPPORT
         if (isDigitalTps1()) {
+#if EFI_PROD_CODE
+            sentSubscribe(sentTpsDecode);
+#endif
             sentTps.Register();
         } else
 #endif
@@ -1522,8 +1522,91 @@ struct output_channels_s {
 	 * offset 872
 	 */
 	uint8_t mapPerCylinder[MAX_CYLINDER_COUNT] = {};
+	/**
+	 * Smart GPIO: SPI latency avg
+	 * units: us
+	 * offset 884
+	 */
+	uint16_t smartGpioSpiLatencyAvg = (uint16_t)0;
+	/**
+	 * Smart GPIO: SPI latency max
+	 * units: us
+	 * offset 886
+	 */
+	uint16_t smartGpioSpiLatencyMax = (uint16_t)0;
+	/**
+	 * Timing: injector edge late max
+	 * units: us
+	 * offset 888
+	 */
+	float edgeLatencyInjectorMax = (float)0;
+	/**
+	 * Timing: injector edge late mean
+	 * units: us
+	 * offset 892
+	 */
+	float edgeLatencyInjectorMean = (float)0;
+	/**
+	 * Timing: coil edge late max
+	 * units: us
+	 * offset 896
+	 */
+	float edgeLatencyCoilMax = (float)0;
+	/**
+	 * Timing: coil edge late mean
+	 * units: us
+	 * offset 900
+	 */
+	float edgeLatencyCoilMean = (float)0;
+	/**
+	 * Timing: scheduler late max
+	 * units: us
+	 * offset 904
+	 */
+	float edgeLatencyQueueMax = (float)0;
+	/**
+	 * Timing: scheduler late mean
+	 * units: us
+	 * offset 908
+	 */
+	float edgeLatencyQueueMean = (float)0;
+	/**
+	 * Timing: modules fast callback
+	 * units: us
+	 * offset 912
+	 */
+	float engineModulesFastUs = (float)0;
+	/**
+	 * Timing: heaviest module fast callback
+	 * units: us
+	 * offset 916
+	 */
+	float engineModulesHeaviestFastUs = (float)0;
+	/**
+	 * Timing: heaviest module fast callback max
+	 * units: us
+	 * offset 920
+	 */
+	float engineModulesHeaviestFastMaxUs = (float)0;
+	/**
+	 * Timing: heaviest module index
+	 * offset 924
+	 */
+	uint32_t engineModulesHeaviestFastIndex = (uint32_t)0;
+	/**
+	 * Timing: modules slow callback
+	 * units: us
+	 * offset 928
+	 */
+	float engineModulesSlowUs = (float)0;
+	/**
+	 * Timing: modules engine phase
+	 * units: us
+	 * offset 932
+	 */
+	float engineModulesPhaseUs = (float)0;
 };
-static_assert(sizeof(output_channels_s) == 884);
+static_assert(sizeof(output_channels_s) == 936);
 
 // end
 // this section was generated automatically by rusEFI tool config_definition_base-all.jar based on (unknown script) console/binary/output_channels.txt
@@ -245,7 +245,6 @@ void runRusEfi() {
 	initEfiWithConfig();
 
 	// periodic events need to be initialized after fuel&spark pins to avoid a warning
-	initPeriodicEvents();
 	initMainLoop();
 
 	runMainLoop();
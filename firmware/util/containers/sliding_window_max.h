@@ -0,0 +1,80 @@
+/**
+ * @file sliding_window_max.h
+ * @brief Maximum of the last N added values, O(1) query and amortized O(1) add
+ *
+ * Monotonic deque: values which can never be the maximum again, because a newer value is at least
+ * as big, are dropped on add. Ties resolve to the newest value.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+template <typename T, size_t TMaxWindow>
+class SlidingWindowMax {
+public:
+	// clears
+	void setWindow(size_t window) {
+		m_window = window < 1 ? 1 : (window > TMaxWindow ? TMaxWindow : window);
+		clear();
+	}
+
+	size_t getWindow() const {
+		return m_window;
+	}
+
+	void clear() {
+		m_head = 0;
+		m_length = 0;
+		m_addedCount = 0;
+	}
+
+	void add(T value) {
+		uint32_t sequence = m_addedCount++;
+
+		// at most one value leaves the window per add, drop it first so a full window has room
+		if (m_length > 0 && sequence - m_entries[m_head].sequence >= m_window) {
+			m_head = (m_head + 1) % TMaxWindow;
+			m_length--;
+		}
+
+		while (m_length > 0 && back().value <= value) {
+			m_length--;
+		}
+
+		m_entries[(m_head + m_length) % TMaxWindow] = { value, sequence };
+		m_length++;
+	}
+
+	bool isEmpty() const {
+		return m_length == 0;
+	}
+
+	T getMax() const {
+		return m_entries[m_head].value;
+	}
+
+	// how many values ago the maximum was added, 0 for the latest one
+	uint32_t getMaxAge() const {
+		return m_addedCount - 1 - m_entries[m_head].sequence;
+	}
+
+private:
+	struct Entry {
+		T value;
+		uint32_t sequence;
+	};
+
+	const Entry& back() const {
+		return m_entries[(m_head + m_length - 1) % TMaxWindow];
+	}
+
+	Entry m_entries[TMaxWindow];
+	size_t m_head = 0;
+	size_t m_length = 0;
+	size_t m_window = TMaxWindow;
+	uint32_t m_addedCount = 0;
+};
@@ -0,0 +1,121 @@
+/**
+ * @file crc32_fast.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "crc32_fast.h"
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "slice-by-8 loads words in little endian order");
+
+// reflected 0x04C11DB7
+#define CRC32_POLYNOMIAL 0xEDB88320
+
+struct Crc32Tables {
+	// table[0] is the usual byte table, table[k] advances a byte which is followed by k more bytes
+	uint32_t table[8][256];
+};
+
+static constexpr Crc32Tables makeCrc32Tables() {
+	Crc32Tables result{};
+
+	for (uint32_t i = 0; i < 256; i++) {
+		uint32_t crc = i;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & 1) ? (crc >> 1) ^ CRC32_POLYNOMIAL : crc >> 1;
+		}
+		result.table[0][i] = crc;
+	}
+
+	for (size_t k = 1; k < 8; k++) {
+		for (size_t i = 0; i < 256; i++) {
+			uint32_t previous = result.table[k - 1][i];
+			result.table[k][i] = (previous >> 8) ^ result.table[0][previous & 0xFF];
+		}
+	}
+
+	return result;
+}
+
+static constexpr Crc32Tables crc32Tables = makeCrc32Tables();
+
+static uint32_t load32(const uint8_t *p) {
+	uint32_t result;
+	memcpy(&result, p, sizeof(result));
+	return result;
+}
+
+uint32_t crc32FastInc(const void *buf, uint32_t crc, size_t size) {
+	const auto &t = crc32Tables.table;
+	const uint8_t *p = reinterpret_cast<const uint8_t*>(buf);
+
+	crc = ~crc;
+
+	while (size >= 8) {
+		uint32_t one = load32(p) ^ crc;
+		uint32_t two = load32(p + 4);
+
+		crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24]
+			^ t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+
+		p += 8;
+		size -= 8;
+	}
+
+	while (size--) {
+		crc = t[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+	}
+
+	return ~crc;
+}
+
+#if EFI_CRC32_HW
+
+// below that setup and locking cost more than they save
+#define CRC32_HW_MIN_SIZE 64
+
+static chibios_rt::Mutex crcUnitMutex;
+
+/**
+ * STM32 unit shifts 32 bit words MSB first starting from 0xFFFFFFFF, which is the reflected
+ * CRC32 with every word and the result bit reversed.
+ */
+static uint32_t crc32Hardware(const uint8_t *p, size_t size) {
+	uint32_t crc;
+
+	{
+		chibios_rt::MutexLocker lock(crcUnitMutex);
+
+		static bool isClockEnabled = false;
+		if (!isClockEnabled) {
+			rccEnableCRC(false);
+			isClockEnabled = true;
+		}
+
+		CRC->CR = CRC_CR_RESET;
+
+		for (size_t i = 0; i < size / 4; i++) {
+			CRC->DR = __RBIT(load32(p));
+			p += 4;
+		}
+
+		crc = ~__RBIT(CRC->DR);
+	}
+
+	return crc32FastInc(p, crc, size % 4);
+}
+
+#endif // EFI_CRC32_HW
+
+uint32_t crc32Fast(const void *buf, size_t size) {
+#if EFI_CRC32_HW
+	// mutex can not be taken from ISR
+	if (size >= CRC32_HW_MIN_SIZE && !port_is_isr_context()) {
+		return crc32Hardware(reinterpret_cast<const uint8_t*>(buf), size);
+	}
+#endif // EFI_CRC32_HW
+
+	return crc32FastInc(buf, 0, size);
+}
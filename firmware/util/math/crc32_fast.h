@@ -0,0 +1,83 @@
+/**
+ * @file crc32_fast.h
+ * @brief Same CRC32 as crc32() and crc32inc() from rusefi/crc.h, eight bytes per step
+ *
+ * Slice-by-8 tables take 8KB of flash. With EFI_CRC32_HW whole buffer crc32Fast() goes through
+ * the STM32 CRC unit, incremental calls always stay in software since F4 unit can not be seeded.
+ *
+ * CRC unit is shared under a mutex: crc32Fast() from ISR context falls back to software, but it must not
+ * be called from a critical section or before the OS is started, use crc32FastInc(buf, 0, size) there.
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+uint32_t crc32Fast(const void *buf, size_t size);
+uint32_t crc32FastInc(const void *buf, uint32_t crc, size_t size);
+
+/**
+ * CRC of a page which mostly does not change between checks.
+ * Keeps CRC of every prefix ending on a block boundary, so after a write only blocks from
+ * the first dirty one to the end of the page are read again.
+ */
+template <size_t TSize, size_t TBlockSize = 512>
+class Crc32PageCache {
+public:
+	uint32_t get(const uint8_t *page) {
+		if (page != m_page) {
+			m_page = page;
+			m_validBlocks = 0;
+		}
+
+		uint32_t generation = m_generation;
+		size_t validBlocks = m_validBlocks;
+
+		uint32_t crc = validBlocks == 0 ? 0 : m_prefixCrc[validBlocks - 1];
+		for (size_t i = validBlocks; i < blockCount; i++) {
+			size_t offset = i * TBlockSize;
+			size_t size = (i + 1 == blockCount) ? TSize - offset : TBlockSize;
+			crc = crc32FastInc(page + offset, crc, size);
+			m_prefixCrc[i] = crc;
+		}
+
+		// a write in the middle of this leaves its blocks dirty for next time
+		if (generation == m_generation) {
+			m_validBlocks = blockCount;
+		}
+
+		return crc;
+	}
+
+	void markDirty(size_t offset, size_t size) {
+		if (size == 0) {
+			return;
+		}
+
+		m_generation = m_generation + 1;
+		size_t block = offset / TBlockSize;
+		if (block < m_validBlocks) {
+			m_validBlocks = block;
+		}
+	}
+
+	void invalidate() {
+		markDirty(0, TSize);
+	}
+
+	// how many blocks next get() would read, for tests
+	size_t getDirtyBlockCount() const {
+		return blockCount - m_validBlocks;
+	}
+
+	static constexpr size_t blockCount = (TSize + TBlockSize - 1) / TBlockSize;
+
+private:
+	const uint8_t *m_page = nullptr;
+	volatile size_t m_validBlocks = 0;
+	volatile uint32_t m_generation = 0;
+	uint32_t m_prefixCrc[blockCount] = {};
+};
@@ -14,6 +14,7 @@
 #include "error_handling.h"
 
 #include <type_traits>
+#include <rusefi/interpolation.h>
 
 #ifndef DEBUG_INTERPOLATION
 #define DEBUG_INTERPOLATION FALSE
@@ -118,3 +119,39 @@ void setCurveValue(const kType bins[], VType values[], int size, float key, floa
 		index = 0;
 	values[index] = value;
 }
+
+/**
+ * interpolate3d() at every combination of rowValues and colValues, same operations in the same
+ * order per cell so results match exactly. Each axis value is binned once rather than once per
+ * output cell, and the inner loops run over contiguous arrays which the compiler is free to vectorize.
+ */
+template<typename VType, unsigned RNum, typename RType, unsigned CNum, typename CType,
+		unsigned ORNum, typename ORType, unsigned OCNum, typename OCType>
+void interpolate3dGrid(float (&output)[ORNum][OCNum],
+		const VType (&table)[RNum][CNum],
+		const RType (&rowBins)[RNum], const ORType (&rowValues)[ORNum],
+		const CType (&colBins)[CNum], const OCType (&colValues)[OCNum]) {
+	size_t colIdx[OCNum];
+	float colFrac[OCNum];
+	for (size_t j = 0; j < OCNum; j++) {
+		auto col = priv::getBin((float)colValues[j], colBins);
+		colIdx[j] = col.Idx;
+		colFrac[j] = col.Frac;
+	}
+
+	for (size_t i = 0; i < ORNum; i++) {
+		auto row = priv::getBin((float)rowValues[i], rowBins);
+
+		// along the columns first, same order of operations as interpolate3d
+		float left[OCNum];
+		float right[OCNum];
+		for (size_t j = 0; j < OCNum; j++) {
+			left[j] = priv::linterp(table[row.Idx][colIdx[j]], table[row.Idx][colIdx[j] + 1], colFrac[j]);
+			right[j] = priv::linterp(table[row.Idx + 1][colIdx[j]], table[row.Idx + 1][colIdx[j] + 1], colFrac[j]);
+		}
+
+		for (size_t j = 0; j < OCNum; j++) {
+			output[i][j] = priv::linterp(left[j], right[j], row.Frac);
+		}
+	}
+}
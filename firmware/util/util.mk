@@ -13,6 +13,7 @@ UTILSRC_CPP = \
 	$(UTIL_DIR)/math/efi_pid.cpp \
 	$(UTIL_DIR)/math/interpolation.cpp \
 	$(UTIL_DIR)/math/crc8hondak.cpp \
+	$(UTIL_DIR)/math/crc32_fast.cpp \
 	$(PROJECT_DIR)/util/datalogging.cpp \
 	$(PROJECT_DIR)/util/loggingcentral.cpp \
 	$(PROJECT_DIR)/util/cli_registry.cpp \
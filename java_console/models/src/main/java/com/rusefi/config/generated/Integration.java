@@ -89,6 +89,7 @@ public class Integration {
 	public static final char TS_BURN_COMMAND = 'B';
 	public static final char TS_CHUNK_WRITE_COMMAND = 'C';
 	public static final char TS_COMMAND_F = 'F';
+	public static final int TS_COMPOSITE_COMPACT_ENABLE = 7;
 	public static final int TS_COMPOSITE_DISABLE = 2;
 	public static final int TS_COMPOSITE_ENABLE = 1;
 	public static final int TS_COMPOSITE_READ = 3;
@@ -96,6 +97,7 @@ public class Integration {
 	public static final char TS_EXECUTE = 'E';
 	public static final char TS_GET_COMPOSITE_BUFFER_DONE_DIFFERENTLY = '8';
 	public static final char TS_GET_CONFIG_ERROR = 'e';
+	public static final char TS_GET_EDGE_LATENCY = 'y';
 	public static final char TS_GET_FIRMWARE_VERSION = 'V';
 	public static final char TS_GET_OUTPUTS_SIZE = '4';
 	public static final char TS_GET_PROTOCOL_VERSION_COMMAND_F = 'F';
@@ -106,6 +108,7 @@ public class Integration {
 	public static final char TS_ONLINE_PROTOCOL = 'z';
 	public static final char TS_OUTPUT_ALL_COMMAND = 'A';
 	public static final char TS_OUTPUT_COMMAND = 'O';
+	public static final char TS_OUTPUT_DELTA_COMMAND = 'd';
 	public static final char TS_PERF_TRACE_BEGIN = '_';
 	public static final char TS_PERF_TRACE_GET_BUFFER = 'b';
 	public static final String TS_PROTOCOL = "001";
@@ -128,5 +131,6 @@ public class Integration {
 	public static final char TS_TEST_COMMAND = 't';
 	public static final int TS_TRIGGER_SCOPE_DISABLE = 5;
 	public static final int TS_TRIGGER_SCOPE_ENABLE = 4;
+	public static final int TS_TRIGGER_SCOPE_ENVELOPE_ENABLE = 8;
 	public static final int TS_TRIGGER_SCOPE_READ = 6;
 }
@@ -1727,6 +1727,7 @@ public class VariableRegistryValues {
 	public static final int ts_command_e_TS_WIDEBAND_SET_SENS_BY_ID = 37;
 	public static final int ts_command_e_TS_X14 = 20;
 	public static final char TS_COMMAND_F = 'F';
+	public static final int TS_COMPOSITE_COMPACT_ENABLE = 7;
 	public static final int TS_COMPOSITE_DISABLE = 2;
 	public static final int TS_COMPOSITE_ENABLE = 1;
 	public static final int TS_COMPOSITE_READ = 3;
@@ -1734,6 +1735,7 @@ public class VariableRegistryValues {
 	public static final char TS_EXECUTE = 'E';
 	public static final char TS_GET_COMPOSITE_BUFFER_DONE_DIFFERENTLY = '8';
 	public static final char TS_GET_CONFIG_ERROR = 'e';
+	public static final char TS_GET_EDGE_LATENCY = 'y';
 	public static final char TS_GET_FIRMWARE_VERSION = 'V';
 	public static final char TS_GET_OUTPUTS_SIZE = '4';
 	public static final char TS_GET_PROTOCOL_VERSION_COMMAND_F = 'F';
@@ -1744,6 +1746,7 @@ public class VariableRegistryValues {
 	public static final char TS_ONLINE_PROTOCOL = 'z';
 	public static final char TS_OUTPUT_ALL_COMMAND = 'A';
 	public static final char TS_OUTPUT_COMMAND = 'O';
+	public static final char TS_OUTPUT_DELTA_COMMAND = 'd';
 	public static final char TS_PERF_TRACE_BEGIN = '_';
 	public static final char TS_PERF_TRACE_GET_BUFFER = 'b';
 	public static final String TS_PROTOCOL = "001";
@@ -1770,6 +1773,7 @@ public class VariableRegistryValues {
 	public static final String TS_TRIGGER_SCOPE_CHANNEL_2_NAME = "Channel 2";
 	public static final int TS_TRIGGER_SCOPE_DISABLE = 5;
 	public static final int TS_TRIGGER_SCOPE_ENABLE = 4;
+	public static final int TS_TRIGGER_SCOPE_ENVELOPE_ENABLE = 8;
 	public static final int TS_TRIGGER_SCOPE_READ = 6;
 	public static final int TsCalMode_EtbKd = 5;
 	public static final int TsCalMode_EtbKi = 4;
@@ -1,6 +1,11 @@
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../../firmware/console/binary/tooth_log_compact.h"
 
 typedef struct __attribute__ ((packed)) {
 	// the whole order of all packet bytes is reversed, not just the 'endian-swap' integers
@@ -24,8 +29,48 @@ static inline uint32_t SWAP_UINT32(uint32_t x)
 
 static constexpr double ticksPerSecond = 1e6;
 
+// see TS_COMPOSITE_COMPACT_ENABLE
+static void convertCompact(std::ifstream& src, std::ofstream& dst)
+{
+	std::vector<uint8_t> data((std::istreambuf_iterator<char>(src)), std::istreambuf_iterator<char>());
+
+	ToothLogCompactDecoder decoder;
+	size_t idx = 0;
+
+	while (idx < data.size())
+	{
+		uint32_t timestampUs;
+		uint8_t channels;
+
+		size_t consumed = decoder.decode(&data[idx], data.size() - idx, timestampUs, channels);
+		if (consumed == 0)
+		{
+			std::cerr << "Malformed compact record at offset " << idx << std::endl;
+			return;
+		}
+		idx += consumed;
+
+		double sec = timestampUs / ticksPerSecond;
+
+		dst << sec << "," << ((channels & TOOTH_LOG_COMPACT_PRI) ? 1 : 0) << "," << ((channels & TOOTH_LOG_COMPACT_SEC) ? 1 : 0) << std::endl;
+	}
+}
+
 int main(int argc, char** argv)
 {
+	bool compact = argc > 1 && std::string(argv[1]) == "--compact";
+	if (compact)
+	{
+		argc--;
+		argv++;
+	}
+
+	if (argc < 3)
+	{
+		std::cerr << "Usage: log_convert [--compact] input.teeth output.csv" << std::endl;
+		return 1;
+	}
+
 	std::ifstream src(argv[1], std::ios::binary);
 	std::ofstream dst(argv[2], std::ios::binary);
 
@@ -33,6 +78,12 @@ int main(int argc, char** argv)
 
 	dst << "timestamp,pri,sec" << std::endl;
 
+	if (compact)
+	{
+		convertCompact(src, dst);
+		return 0;
+	}
+
 	while (!src.eof())
 	{
 		composite_logger_s entry;
@@ -764,8 +764,10 @@
  * @brief   Idle Loop hook.
  * @details This hook is continuously invoked by the idle thread loop.
  */
+#include "virtual_clock.h"
 #define CH_CFG_IDLE_LOOP_HOOK() {                                           \
   /* Idle loop code here.*/                                                 \
+  simVirtualClockOnIdle();                                                  \
 }
 
 /**
@@ -26,6 +26,8 @@
 
 #include "fw_configuration.h"
 #include "board_overrides.h"
+#include "virtual_clock.h"
+#include "sim_scenario.h"
 
 #define CONSOLE_WA_SIZE     THD_WORKING_AREA_SIZE(4096)
 
@@ -150,6 +152,14 @@ void setup_custom_board_overrides(){
 }
 
 
+static void printUsage(const char *name) {
+	printf("Usage: %s [timeout_seconds] [--virtual-time] [--scenario file] [--mlg file]\n", name);
+	printf("  timeout_seconds  exit after given (simulated) time\n");
+	printf("  --virtual-time   run on deterministic virtual clock, as fast as host CPU allows\n");
+	printf("  --scenario file  execute timed console commands, see sim_scenario.cpp\n");
+	printf("  --mlg file       write MLG log at sdCardLogFrequency rate\n");
+}
+
 /*------------------------------------------------------------------------*
  * Simulator main.                                                        *
  *------------------------------------------------------------------------*/
@@ -157,6 +167,26 @@ int main(int argc, char** argv) {
 	setbuf(stdout, NULL);
 	setup_custom_fw_overrides();
 	setup_custom_board_overrides();
+
+	int timeoutSeconds = 0;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--virtual-time") == 0) {
+			simVirtualClockEnable();
+			if (!simIsVirtualClock()) {
+				printf("Virtual clock is not supported on this platform\n");
+				return -1;
+			}
+		} else if ((strcmp(argv[i], "--scenario") == 0) && (i + 1 < argc)) {
+			setSimScenarioFile(argv[++i]);
+		} else if ((strcmp(argv[i], "--mlg") == 0) && (i + 1 < argc)) {
+			setSimMlgFile(argv[++i]);
+		} else if (isdigit((unsigned char)argv[i][0])) {
+			timeoutSeconds = atoi(argv[i]);
+		} else {
+			printUsage(argv[0]);
+			return -1;
+		}
+	}
 	/*
 	 * System initializations.
 	 * - HAL initialization, this also initializes the configured device drivers
@@ -167,12 +197,11 @@ int main(int argc, char** argv) {
 	halInit();
 	chSysInit();
 
-	if (argc == 2) {
-		int timeoutSeconds = atoi(argv[1]);
+	if (timeoutSeconds > 0) {
 		printf("Running rusEFI simulator for %d seconds, then exiting.\n\n", timeoutSeconds);
 
 		chSysLock();
-		chVTSetI(&exitTimer, MY_US2ST(timeoutSeconds * 1e6), [](ch_virtual_timer*, void*) { exit(0); }, nullptr);
+		chVTSetI(&exitTimer, MY_US2ST(timeoutSeconds * 1e6), [](ch_virtual_timer*, void*) { simScenarioExit(0); }, nullptr);
 		chSysUnlock();
 	}
 
@@ -194,6 +223,8 @@ int main(int argc, char** argv) {
 
 	rusEfiFunctionalTest();
 
+	startSimScenario();
+
 	/*
 	 * Events servicing loop.
 	 */
@@ -43,6 +43,12 @@
 #define EFI_MCP_3208 FALSE
 #define EFI_CAN_SERIAL FALSE
 #define EFI_TS_SCATTER FALSE
+#define EFI_TS_OUTPUT_DELTA TRUE
+#define EFI_LIVE_DATA_SNAPSHOT TRUE
+#define EFI_CRC32_HW FALSE
+#define EFI_TS_PAGE_CRC_CACHE FALSE
+#define EFI_TRIGGER_EMULATOR_TIMELINE TRUE
+#define EFI_TRIGGER_SHAPE_DB TRUE
 #define EFI_SOFTWARE_KNOCK FALSE
 #define _HAS_STATIC_RTTI FALSE
 #define __GXX_RTTI FALSE
@@ -171,6 +177,9 @@
 #define SPARK_EXTREME_LOGGING FALSE
 #define DEBUG_PWM FALSE
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER FALSE
+#define EFI_PWM_BANK TRUE
+#define EFI_OUTPUT_EDGE_LATENCY FALSE
+#define EFI_ENGINE_MODULE_TIMING FALSE
 #define EFI_TUNER_STUDIO_VERBOSE FALSE
 #define EFI_FILE_LOGGING TRUE
 #define EFI_WARNING_LED FALSE
@@ -224,7 +224,6 @@ void rusEfiFunctionalTest() {
 
 	engineConfiguration->enableVerboseCanTx = true;
 
-	initPeriodicEvents(); //TODO: replace to initMainLoop();
 	initMainLoop();
 	rememberCurrentConfiguration();
 
@@ -0,0 +1,176 @@
+/**
+ * @file	sim_scenario.cpp
+ * @brief   Headless simulator runs: scripted console commands and MLG output
+ *
+ * Scenario is a text file, one console command per line prefixed with time in milliseconds since start:
+ *
+ *   # comment
+ *   0 set_sensor_mock 4 90
+ *   0 rpm 1200
+ *   60000 rpm 6000
+ *   120000 exit
+ *
+ * Lines are executed in order, a line with time in the past is executed immediately.
+ * 'exit' flushes MLG output and terminates simulator. Together with --virtual-time this allows CI to run
+ * long drive cycles much faster than wall clock and get repeatable results.
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "sim_scenario.h"
+#include "cli_registry.h"
+#include "binary_mlg_logging.h"
+#include "buffered_writer.h"
+
+#include <fstream>
+#include <string>
+
+#define SIM_SCENARIO_EXIT_COMMAND "exit"
+#define SIM_SCENARIO_MAX_LINE 128
+
+static const char *scenarioFileName = nullptr;
+static const char *mlgFileName = nullptr;
+
+class SimMlgWriter final : public BufferedWriter<512> {
+public:
+	bool open(const char *fileName) {
+		m_stream.open(fileName, std::ios::binary | std::ios::trunc);
+		return m_stream.is_open();
+	}
+
+	bool isOpen() const {
+		return m_stream.is_open();
+	}
+
+	size_t writeInternal(const char* buffer, size_t count) override {
+		m_stream.write(buffer, count);
+		return count;
+	}
+
+	void close() {
+		flush();
+		m_stream.flush();
+	}
+
+private:
+	std::ofstream m_stream;
+};
+
+static SimMlgWriter mlgWriter;
+
+void setSimScenarioFile(const char *fileName) {
+	scenarioFileName = fileName;
+}
+
+void setSimMlgFile(const char *fileName) {
+	mlgFileName = fileName;
+}
+
+void simScenarioExit(int code) {
+	if (mlgWriter.isOpen()) {
+		mlgWriter.close();
+	}
+	fflush(stdout);
+	exit(code);
+}
+
+static THD_WORKING_AREA(mlgThreadStack, 3 * UTILITY_THREAD_STACK_SIZE);
+static void mlgThread(void*) {
+	chRegSetThreadName("sim MLG");
+
+	MLG::resetFileLogging();
+
+	while (true) {
+		systime_t before = chVTGetSystemTime();
+
+		MLG::writeSdLogLine(mlgWriter);
+
+		// same limits as SD card logger
+		auto freq = engineConfiguration->sdCardLogFrequency;
+		if (freq > 250) {
+			freq = 250;
+		} else if (freq < 1) {
+			freq = 1;
+		}
+
+		chThdSleepUntilWindowed(before, before + CH_CFG_ST_FREQUENCY / freq);
+	}
+}
+
+static THD_WORKING_AREA(scenarioThreadStack, 3 * UTILITY_THREAD_STACK_SIZE);
+static void scenarioThread(void*) {
+	chRegSetThreadName("sim scenario");
+
+	std::ifstream scenario(scenarioFileName);
+	if (!scenario.is_open()) {
+		printf("Scenario: unable to open [%s]\n", scenarioFileName);
+		simScenarioExit(-1);
+	}
+
+	systime_t start = chVTGetSystemTime();
+	std::string line;
+	int lineNumber = 0;
+
+	while (std::getline(scenario, line)) {
+		lineNumber++;
+
+		line = line.substr(0, line.find('#'));
+
+		const char *text = line.c_str();
+		char *commandStart;
+		double timeMs = strtod(text, &commandStart);
+
+		while (*commandStart == ' ' || *commandStart == '\t') {
+			commandStart++;
+		}
+
+		std::string command(commandStart);
+		while (!command.empty() && isspace((unsigned char)command.back())) {
+			command.pop_back();
+		}
+
+		if (commandStart == text) {
+			// empty line or no timestamp
+			if (!command.empty()) {
+				printf("Scenario: line %d has no time [%s]\n", lineNumber, command.c_str());
+			}
+			continue;
+		}
+
+		sysinterval_t target = TIME_MS2I(timeMs);
+		sysinterval_t elapsed = chVTTimeElapsedSinceX(start);
+		if (target > elapsed) {
+			chThdSleep(target - elapsed);
+		}
+
+		printf("Scenario: %.3f [%s]\n", timeMs, command.c_str());
+
+		if (command == SIM_SCENARIO_EXIT_COMMAND) {
+			simScenarioExit(0);
+		}
+
+		char buffer[SIM_SCENARIO_MAX_LINE];
+		strncpy(buffer, command.c_str(), sizeof(buffer) - 1);
+		buffer[sizeof(buffer) - 1] = 0;
+		handleConsoleLine(buffer);
+	}
+
+	printf("Scenario: done after %d lines\n", lineNumber);
+}
+
+void startSimScenario() {
+	if (mlgFileName) {
+		if (!mlgWriter.open(mlgFileName)) {
+			printf("Scenario: unable to create [%s]\n", mlgFileName);
+			simScenarioExit(-1);
+		}
+
+		chThdCreateStatic(mlgThreadStack, sizeof(mlgThreadStack), PRIO_MMC, mlgThread, nullptr);
+	}
+
+	if (scenarioFileName) {
+		chThdCreateStatic(scenarioThreadStack, sizeof(scenarioThreadStack), PRIO_CONSOLE, scenarioThread, nullptr);
+	}
+}
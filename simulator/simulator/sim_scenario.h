@@ -0,0 +1,21 @@
+/**
+ * @file	sim_scenario.h
+ * @brief   Headless simulator runs: scripted console commands and MLG output
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+void setSimScenarioFile(const char *fileName);
+void setSimMlgFile(const char *fileName);
+
+/**
+ * Starts scenario and MLG logger threads if configured, to be invoked once engine controller is up
+ */
+void startSimScenario();
+
+/**
+ * Flushes MLG output and terminates simulator
+ */
+void simScenarioExit(int code);
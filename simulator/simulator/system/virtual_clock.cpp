@@ -0,0 +1,70 @@
+/**
+ * @file	virtual_clock.cpp
+ * @brief   Deterministic faster-than-real-time clock for posix simulator
+ *
+ * ChibiOS posix port generates system tick by comparing host gettimeofday() against next tick deadline.
+ * In virtual clock mode we link with --wrap=gettimeofday and return our own counter instead, which only moves
+ * forward when idle thread runs, exactly to the next tick. So everything driven by system time: virtual timers,
+ * SleepExecutor, periodic threads, trigger stimulator, advances as fast as host CPU allows, and two runs of
+ * the same scenario see identical timing.
+ *
+ * Note that code busy-waiting on time would never make progress in this mode.
+ *
+ * Symbol wrapping needs GNU ld, so the Makefile enables EFI_SIM_VIRTUAL_CLOCK on Linux only.
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "virtual_clock.h"
+
+#include <sys/time.h>
+
+#if EFI_SIM_VIRTUAL_CLOCK
+
+// fixed epoch so that even wall clock timestamps are repeatable
+#define VIRTUAL_CLOCK_EPOCH_SEC	1700000000
+
+static bool isVirtualClock = false;
+static uint64_t virtualTimeUs = 0;
+
+extern "C" int __real_gettimeofday(struct timeval *tv, void *tz);
+
+extern "C" int __wrap_gettimeofday(struct timeval *tv, void *tz) {
+	if (!isVirtualClock) {
+		return __real_gettimeofday(tv, tz);
+	}
+
+	tv->tv_sec = VIRTUAL_CLOCK_EPOCH_SEC + virtualTimeUs / 1000000;
+	tv->tv_usec = virtualTimeUs % 1000000;
+	return 0;
+}
+
+void simVirtualClockEnable(void) {
+	isVirtualClock = true;
+}
+
+int simIsVirtualClock(void) {
+	return isVirtualClock;
+}
+
+void simVirtualClockOnIdle(void) {
+	if (isVirtualClock) {
+		virtualTimeUs += 1000000 / CH_CFG_ST_FREQUENCY;
+	}
+}
+
+#else // EFI_SIM_VIRTUAL_CLOCK
+
+void simVirtualClockEnable(void) {
+}
+
+int simIsVirtualClock(void) {
+	return false;
+}
+
+void simVirtualClockOnIdle(void) {
+}
+
+#endif // EFI_SIM_VIRTUAL_CLOCK
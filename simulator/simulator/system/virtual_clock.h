@@ -0,0 +1,26 @@
+/**
+ * @file	virtual_clock.h
+ * @brief   Deterministic faster-than-real-time clock for posix simulator
+ *
+ * @date Oct 18, 2026
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Should be invoked before halInit() since HAL start-up captures current time
+ */
+void simVirtualClockEnable(void);
+int simIsVirtualClock(void);
+/**
+ * Invoked from idle thread loop hook: nothing else is ready to run so we jump to next system tick
+ */
+void simVirtualClockOnIdle(void);
+
+#ifdef __cplusplus
+}
+#endif
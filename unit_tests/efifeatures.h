@@ -61,6 +61,15 @@
 
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER FALSE
 #define EFI_SIGNAL_EXECUTOR_SLEEP FALSE
+#define EFI_PWM_BANK TRUE
+#define EFI_OUTPUT_EDGE_LATENCY TRUE
+#define EFI_TS_OUTPUT_DELTA TRUE
+#define EFI_LIVE_DATA_SNAPSHOT TRUE
+#define EFI_CRC32_HW FALSE
+#define EFI_TS_PAGE_CRC_CACHE TRUE
+#define EFI_TRIGGER_EMULATOR_TIMELINE TRUE
+#define EFI_TRIGGER_SHAPE_DB TRUE
+#define EFI_ENGINE_MODULE_TIMING TRUE
 
 #define EFI_SHAFT_POSITION_INPUT TRUE
 #define EFI_ENGINE_CONTROL TRUE
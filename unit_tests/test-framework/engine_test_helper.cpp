@@ -32,6 +32,8 @@ extern WaveChart waveChart;
 #endif /* EFI_ENGINE_SNIFFER */
 
 #include "fw_configuration.h"
+#include "live_data_snapshot.h"
+#include "tunerstudio.h"
 
 extern engine_configuration_s & activeConfiguration;
 extern PinRepository pinRepository;
@@ -44,6 +46,8 @@ EngineTestHelperBase::EngineTestHelperBase(Engine * eng, engine_configuration_s
 	// todo: make this not a global variable, we need currentTimeProvider interface on engine
 	setTimeNowUs(0);
 	ButtonDebounce::resetForUnitTests();
+	resetLiveDataSnapshotForUnitTests();
+	resetTsPageCrcCacheForUnitTests();
 	unitTestBusyWaitHack = false;
 	unitTestTaskPrecisionHack = false;
 	EnableToothLogger();
@@ -161,7 +165,7 @@ EngineTestHelper::EngineTestHelper(engine_type_e engineType, configuration_callb
 	commonInitEngineController();
 
 	// this is needed to have valid CLT and IAT.
-	//todo: reuse 	initPeriodicEvents() method
+	// tests run no MainLoop, so do one full pass of what its "slow" rate group runs in parts
 	engine.periodicSlowCallback();
 
 	extern bool hasInitGtest;
@@ -20,6 +20,10 @@ int TestExecutor::executeAll(efitimeus_t nowUs) {
 }
 
 int TestExecutor::executeAllNt(efitick_t nowNt) {
+	scheduling_s *head = schedulingQueue.getHead();
+	if (m_isrDelayUs && head && head->getMomentNt() <= nowNt) {
+		advanceTimeUs(m_isrDelayUs);
+	}
 	return schedulingQueue.executeAll(nowNt);
 }
 
@@ -67,3 +71,7 @@ void TestExecutor::cancel(scheduling_s* s) {
 void TestExecutor::setMockExecutor(Scheduler* exec) {
 	m_mockExecutor = exec;
 }
+
+void TestExecutor::setIsrDelayUs(int delayUs) {
+	m_isrDelayUs = delayUs;
+}
@@ -26,7 +26,12 @@ public:
 	scheduling_s * getForUnitTest(int index);
 
 	void setMockExecutor(Scheduler* exec);
+	/**
+	 * Emulates late timer interrupt: each pass which has something due starts this much after its target time
+	 */
+	void setIsrDelayUs(int delayUs);
 private:
 	EventQueue schedulingQueue;
 	Scheduler* m_mockExecutor = nullptr;
+	int m_isrDelayUs = 0;
 };
@@ -8,6 +8,7 @@
 #include "pch.h"
 #include "map_averaging.h"
 #include "harley.h"
+#include "linear_func.h"
 
 namespace {
 	auto const startAveragingAction{ action_s::make<startAveraging>((mapSampler*){}) };
@@ -147,3 +148,133 @@ TEST(EngineModules, MapAveragingModule_onEnginePhase60_2_one_cylinderCustomSampl
 	bool averageDone = eth.assertEventExistsAtEnginePhase("startMapAveraging callback", startAveragingAction, static_cast<angle_t>(75));
     EXPECT_TRUE(averageDone);
 }
+
+// what MapAverager used to do: convert every sample, average pressures of valid ones
+static float averageOfConvertedSamples(const SensorConverter& func, const float* volts, size_t count) {
+	float sum = 0;
+	int valid = 0;
+	for (size_t i = 0; i < count; i++) {
+		SensorResult result = func.convert(volts[i]);
+		if (result) {
+			sum += result.Value;
+			valid++;
+		}
+	}
+	return sum / valid;
+}
+
+static void averageWindow(MapAverager& averager, const float* volts, size_t count) {
+	averager.start(0);
+	for (size_t i = 0; i < count; i++) {
+		averager.submit(volts[i]);
+	}
+	averager.stop();
+}
+
+static const float windowVolts[] = { 1.21, 1.35, 1.18, 0.97, 1.44, 1.52, 1.03, 1.26, 1.31, 1.09 };
+
+TEST(MapAverager, SameAsPerSampleConversion) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->mapExpAverageAlpha = 1;
+
+	LinearFunc gm1bar;
+	gm1bar.configure(0, 10, 5, 105, 0, 300);
+	// falling pressure with rising voltage
+	LinearFunc honda3bar;
+	honda3bar.configure(0.5, 91.422, 3.0, 0, -100, 300);
+
+	for (LinearFunc* func : { &gm1bar, &honda3bar }) {
+		MapAverager averager(SensorType::MapFast, MS2NT(200));
+		averager.setFunction(*func);
+		averager.setMinBufferLength(1);
+
+		averageWindow(averager, windowVolts, efi::size(windowVolts));
+
+		float expected = averageOfConvertedSamples(*func, windowVolts, efi::size(windowVolts));
+		EXPECT_NEAR(expected, averager.get().value_or(-1), 1e-4);
+		// whole kPa output channel
+		EXPECT_EQ((uint8_t)expected, engine->outputChannels.mapPerCylinder[0]);
+	}
+}
+
+TEST(MapAverager, SamplesOutsideWindowIgnored) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->mapExpAverageAlpha = 1;
+
+	LinearFunc func;
+	func.configure(0, 0, 5, 100, 0, 300);
+	MapAverager averager(SensorType::MapFast, MS2NT(200));
+	averager.setFunction(func);
+
+	averager.submit(4);
+	averageWindow(averager, windowVolts, 3);
+	averager.submit(4);
+
+	EXPECT_NEAR(averageOfConvertedSamples(func, windowVolts, 3), averager.get().value_or(-1), 1e-4);
+	// instant value still follows every sample
+	EXPECT_NEAR(80, averager.getInstant().value_or(-1), 1e-4);
+	EXPECT_FLOAT_EQ(4, averager.getInstantVolts());
+
+	// window without samples keeps previous value
+	averager.start(0);
+	averager.stop();
+	EXPECT_NEAR(averageOfConvertedSamples(func, windowVolts, 3), averager.get().value_or(-1), 1e-4);
+}
+
+TEST(MapAverager, InvalidSampleDropped) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->mapExpAverageAlpha = 1;
+
+	// above 4.47 volts is over 100 kPa, out of range
+	LinearFunc func;
+	func.configure(0, 10, 5, 105, 0, 100);
+	MapAverager averager(SensorType::MapFast, MS2NT(200));
+	averager.setFunction(func);
+
+	const float volts[] = { 1.21, 1.35, 4.8, 1.18, 0.97 };
+	averageWindow(averager, volts, efi::size(volts));
+
+	float expected = averageOfConvertedSamples(func, volts, efi::size(volts));
+	// average of four valid samples, spike does not pull it up
+	EXPECT_NEAR((func.convert(1.21).Value + func.convert(1.35).Value + func.convert(1.18).Value + func.convert(0.97).Value) / 4, expected, 1e-4);
+	EXPECT_NEAR(expected, averager.get().value_or(-1), 1e-4);
+
+	// window with nothing valid keeps previous value
+	const float invalid[] = { 4.8, 4.9 };
+	averageWindow(averager, invalid, efi::size(invalid));
+	EXPECT_NEAR(expected, averager.get().value_or(-1), 1e-4);
+}
+
+TEST(MapAverager, MinBufferPerSensor) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->mapExpAverageAlpha = 1;
+
+	LinearFunc func;
+	func.configure(0, 0, 5, 100, 0, 300);
+
+	MapAverager bank1(SensorType::MapFast, MS2NT(200));
+	MapAverager bank2(SensorType::MapFast2, MS2NT(200));
+	bank1.setFunction(func);
+	bank2.setFunction(func);
+	bank1.setMinBufferLength(3);
+	bank2.setMinBufferLength(1);
+
+	const float low[] = { 1 };
+	const float mid[] = { 2 };
+	const float high[] = { 3 };
+
+	averageWindow(bank1, mid, 1);
+	averageWindow(bank1, low, 1);
+	averageWindow(bank2, high, 1);
+	averageWindow(bank1, high, 1);
+
+	// minimum of last three windows
+	EXPECT_NEAR(20, bank1.get().value_or(-1), 1e-4);
+	// not affected by bank1 windows
+	EXPECT_NEAR(60, bank2.get().value_or(-1), 1e-4);
+
+	// low window falls out of the buffer
+	averageWindow(bank1, high, 1);
+	averageWindow(bank1, high, 1);
+	EXPECT_NEAR(60, bank1.get().value_or(-1), 1e-4);
+}
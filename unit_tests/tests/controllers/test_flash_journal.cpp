@@ -0,0 +1,363 @@
+/*
+ * @file test_flash_journal.cpp
+ *
+ * @date: Oct 18, 2026
+ */
+
+#include "pch.h"
+#include "flash_journal.h"
+
+namespace {
+
+// NOR flash: erase sets all bits, program can only clear bits
+class MockFlashMedia : public FlashJournalMedia {
+public:
+	static constexpr size_t bankSize = 8 * 1024;
+
+	MockFlashMedia() {
+		memset(mem, 0x00, sizeof(mem));
+	}
+
+	size_t getBankSize() override {
+		return bankSize;
+	}
+
+	size_t getWriteAlignment() override {
+		return 8;
+	}
+
+	bool erase(size_t bank) override {
+		eraseCount++;
+
+		if (powerLost()) {
+			// interrupted erase leaves half of the bank undefined
+			memset(mem[bank], 0x5a, bankSize / 2);
+			return false;
+		}
+
+		memset(mem[bank], 0xff, bankSize);
+		return true;
+	}
+
+	bool write(size_t bank, size_t offset, const uint8_t *ptr, size_t size) override {
+		for (size_t i = 0; i < size; i++) {
+			if (powerLost()) {
+				return false;
+			}
+
+			if (mem[bank][offset + i] != 0xff) {
+				doubleWrites++;
+			}
+
+			mem[bank][offset + i] &= ptr[i];
+			bytesProgrammed++;
+			if (writeBudget > 0) {
+				writeBudget--;
+			}
+		}
+		return true;
+	}
+
+	bool read(size_t bank, size_t offset, uint8_t *ptr, size_t size) override {
+		memcpy(ptr, &mem[bank][offset], size);
+		return true;
+	}
+
+	bool powerLost() {
+		return writeBudget == 0;
+	}
+
+	uint8_t mem[2][bankSize];
+	// bytes until simulated power loss, negative for unlimited
+	int writeBudget = -1;
+	int eraseCount = 0;
+	int doubleWrites = 0;
+	size_t bytesProgrammed = 0;
+};
+
+struct TestItem {
+	uint8_t data[3000];
+
+	void fill(uint8_t seed) {
+		for (size_t i = 0; i < sizeof(data); i++) {
+			data[i] = (uint8_t)(i * 7 + seed);
+		}
+	}
+};
+
+}
+
+TEST(FlashJournal, BlankIsNotFound) {
+	MockFlashMedia media;
+	media.erase(0);
+	media.erase(1);
+	FlashJournal journal(media);
+
+	TestItem item;
+	EXPECT_EQ(StorageStatus::NotFound, journal.read(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+	EXPECT_EQ(StorageStatus::NotSupported, journal.read(EFI_STORAGE_TOTAL_ITEMS, item.data, sizeof(item.data)));
+}
+
+TEST(FlashJournal, StoreRead) {
+	MockFlashMedia media;
+	FlashJournal journal(media);
+
+	TestItem written, readBack;
+	written.fill(1);
+
+	// garbage in both banks, first store formats
+	EXPECT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, written.data, sizeof(written.data)));
+	EXPECT_EQ(0, journal.getActiveBank());
+	EXPECT_EQ(1, media.eraseCount);
+
+	EXPECT_EQ(StorageStatus::Ok, journal.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(written.data, readBack.data, sizeof(written.data)));
+
+	// survives reboot
+	FlashJournal rebooted(media);
+	memset(readBack.data, 0, sizeof(readBack.data));
+	EXPECT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(written.data, readBack.data, sizeof(written.data)));
+
+	// other item is not there
+	EXPECT_EQ(StorageStatus::NotFound, rebooted.read(EFI_LTFT_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, media.doubleWrites);
+}
+
+TEST(FlashJournal, OnlyChangedChunksAreWritten) {
+	MockFlashMedia media;
+	FlashJournal journal(media);
+
+	TestItem item, readBack;
+	item.fill(2);
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+
+	// same data again, no flash access at all
+	size_t programmed = media.bytesProgrammed;
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+	EXPECT_EQ(programmed, media.bytesProgrammed);
+
+	// single cell change costs one chunk plus commit
+	item.data[1234]++;
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+	EXPECT_LE(media.bytesProgrammed - programmed, FlashJournal::chunkSize + 2 * 16);
+	EXPECT_EQ(1, media.eraseCount);
+
+	FlashJournal rebooted(media);
+	ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(item.data, readBack.data, sizeof(item.data)));
+	EXPECT_EQ(0, media.doubleWrites);
+}
+
+TEST(FlashJournal, CompactionWhenFull) {
+	MockFlashMedia media;
+	FlashJournal journal(media);
+
+	TestItem settings, ltft, readBack;
+	settings.fill(3);
+	ltft.fill(100);
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, settings.data, sizeof(settings.data)));
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_LTFT_RECORD_ID, ltft.data, sizeof(ltft.data)));
+
+	for (int i = 0; i < 200; i++) {
+		ltft.data[(i * 131) % sizeof(ltft.data)] += i;
+		ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_LTFT_RECORD_ID, ltft.data, sizeof(ltft.data)));
+	}
+
+	EXPECT_GT(journal.getCompactionCounter(), 1u);
+	EXPECT_LE(journal.getUsedBytes(), MockFlashMedia::bankSize);
+
+	FlashJournal rebooted(media);
+	ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(settings.data, readBack.data, sizeof(settings.data)));
+	ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_LTFT_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(ltft.data, readBack.data, sizeof(ltft.data)));
+	EXPECT_EQ(0, media.doubleWrites);
+}
+
+TEST(FlashJournal, BackgroundCompaction) {
+	MockFlashMedia media;
+	FlashJournal journal(media);
+
+	TestItem item, readBack;
+	item.fill(4);
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+
+	while (!journal.needsCompaction()) {
+		item.data[journal.getUsedBytes() % sizeof(item.data)]++;
+		ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+	}
+	// only initial format so far
+	ASSERT_EQ(1u, journal.getCompactionCounter());
+
+	size_t usedBefore = journal.getUsedBytes();
+	ASSERT_EQ(StorageStatus::Ok, journal.compact());
+	EXPECT_EQ(1, journal.getActiveBank());
+	EXPECT_LT(journal.getUsedBytes(), usedBefore);
+	EXPECT_FALSE(journal.needsCompaction());
+
+	FlashJournal rebooted(media);
+	ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(item.data, readBack.data, sizeof(item.data)));
+}
+
+/**
+ * Interrupt store after every few programmed bytes: after reboot we should read either
+ * complete old or complete new image, and next store should succeed
+ */
+static void checkPowerLossDuringStore(int stores, bool expectCompaction) {
+	MockFlashMedia media;
+	TestItem oldItem, newItem, readBack;
+	oldItem.fill(5);
+
+	{
+		FlashJournal journal(media);
+		ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, oldItem.data, sizeof(oldItem.data)));
+		// age the log so that interesting stores include compaction
+		for (int i = 0; i < stores; i++) {
+			oldItem.data[(i * 97) % sizeof(oldItem.data)] ^= 0x55;
+			ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, oldItem.data, sizeof(oldItem.data)));
+		}
+	}
+
+	memcpy(newItem.data, oldItem.data, sizeof(newItem.data));
+	for (size_t i = 0; i < sizeof(newItem.data); i += 500) {
+		newItem.data[i]++;
+	}
+
+	uint8_t snapshot[2][MockFlashMedia::bankSize];
+	memcpy(snapshot, media.mem, sizeof(snapshot));
+
+	// how many bytes does uninterrupted store program?
+	size_t fullStore;
+	{
+		FlashJournal journal(media);
+		journal.mount();
+		size_t before = media.bytesProgrammed;
+		ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, newItem.data, sizeof(newItem.data)));
+		fullStore = media.bytesProgrammed - before;
+		ASSERT_EQ(expectCompaction, journal.getCompactionCounter() != 0);
+	}
+
+	for (size_t budget = 0; budget < fullStore; budget += 3) {
+		memcpy(media.mem, snapshot, sizeof(snapshot));
+		media.writeBudget = budget;
+
+		{
+			FlashJournal journal(media);
+			EXPECT_NE(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, newItem.data, sizeof(newItem.data)));
+		}
+
+		media.writeBudget = -1;
+
+		FlashJournal rebooted(media);
+		ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data))) << budget;
+		bool isOld = memcmp(oldItem.data, readBack.data, sizeof(readBack.data)) == 0;
+		bool isNew = memcmp(newItem.data, readBack.data, sizeof(readBack.data)) == 0;
+		ASSERT_TRUE(isOld || isNew) << "torn image after power loss at " << budget;
+
+		// and we are able to recover
+		ASSERT_EQ(StorageStatus::Ok, rebooted.store(EFI_SETTINGS_RECORD_ID, newItem.data, sizeof(newItem.data)));
+		FlashJournal recovered(media);
+		ASSERT_EQ(StorageStatus::Ok, recovered.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+		ASSERT_EQ(0, memcmp(newItem.data, readBack.data, sizeof(readBack.data))) << budget;
+	}
+}
+
+TEST(FlashJournal, PowerLossDuringAppend) {
+	checkPowerLossDuringStore(3, false);
+}
+
+TEST(FlashJournal, PowerLossDuringCompaction) {
+	MockFlashMedia media;
+	TestItem item;
+	item.fill(6);
+
+	// find how many stores fit before compaction
+	FlashJournal journal(media);
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+	int stores = 0;
+	while (journal.getCompactionCounter() == 1) {
+		item.data[(stores * 97) % sizeof(item.data)] ^= 0x55;
+		ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+		stores++;
+	}
+
+	// last store before next one compacts
+	checkPowerLossDuringStore(stores - 1, true);
+}
+
+TEST(FlashJournal, MigrationKeepsLegacyCopy) {
+	MockFlashMedia media;
+	TestItem legacy, item;
+	legacy.fill(8);
+	item.fill(9);
+
+	// legacy raw image in first sector, backup one is gone
+	media.erase(0);
+	media.erase(1);
+	memcpy(media.mem[0], legacy.data, sizeof(legacy.data));
+
+	uint8_t snapshot[2][MockFlashMedia::bankSize];
+	memcpy(snapshot, media.mem, sizeof(snapshot));
+
+	size_t fullStore;
+	{
+		FlashJournal journal(media);
+		journal.setInitialBank(1);
+		size_t before = media.bytesProgrammed;
+		ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+		fullStore = media.bytesProgrammed - before;
+		EXPECT_EQ(1, journal.getActiveBank());
+	}
+
+	// power loss at any point of the first store leaves legacy image intact
+	for (size_t budget = 0; budget <= fullStore; budget += 7) {
+		memcpy(media.mem, snapshot, sizeof(snapshot));
+		media.writeBudget = budget;
+		{
+			FlashJournal journal(media);
+			journal.setInitialBank(1);
+			journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data));
+		}
+		media.writeBudget = -1;
+
+		ASSERT_EQ(0, memcmp(media.mem[0], legacy.data, sizeof(legacy.data))) << budget;
+
+		FlashJournal rebooted(media);
+		if (rebooted.isFormatted()) {
+			TestItem readBack;
+			ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+			ASSERT_EQ(0, memcmp(item.data, readBack.data, sizeof(item.data))) << budget;
+		}
+	}
+}
+
+TEST(FlashJournal, ChangedAfterResize) {
+	MockFlashMedia media;
+	FlashJournal journal(media);
+
+	TestItem item, readBack;
+	item.fill(10);
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, 1000));
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, 300));
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+
+	FlashJournal rebooted(media);
+	ASSERT_EQ(StorageStatus::Ok, rebooted.read(EFI_SETTINGS_RECORD_ID, readBack.data, sizeof(readBack.data)));
+	EXPECT_EQ(0, memcmp(item.data, readBack.data, sizeof(item.data)));
+}
+
+TEST(FlashJournal, Format) {
+	MockFlashMedia media;
+	FlashJournal journal(media);
+
+	TestItem item;
+	item.fill(7);
+	ASSERT_EQ(StorageStatus::Ok, journal.store(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+	ASSERT_EQ(StorageStatus::Ok, journal.format());
+	EXPECT_EQ(StorageStatus::NotFound, journal.read(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+
+	FlashJournal rebooted(media);
+	EXPECT_EQ(StorageStatus::NotFound, rebooted.read(EFI_SETTINGS_RECORD_ID, item.data, sizeof(item.data)));
+}
@@ -117,3 +117,149 @@ TEST(LTFT, testSlowCallbackLoadError) {
 	EXPECT_FALSE(ltft.ltftLoadPending);
 	EXPECT_TRUE(ltft.ltftLoadError);
 }
+
+static void setupLearning(LtftState& ltftState, LongTermFuelTrim& ltft) {
+	// reset to zero
+	ltftState.load();
+	ltft.init(&ltftState);
+
+	engineConfiguration->ltft.enabled = true;
+	engineConfiguration->ltft.correctionEnabled = true;
+	engineConfiguration->ltft.deadband = 0.5; // %
+	engineConfiguration->ltft.maxAdd = 15.0; // %
+	engineConfiguration->ltft.maxRemove = 5; // %
+	engineConfiguration->ltft.timeConstant[ftRegionCruise] = 10; // seconds
+}
+
+TEST(LTFT, testNeighbourLearning)
+{
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+	setupLearning(ltftState, ltft);
+
+	ClosedLoopFuelResult clInput;
+	clInput.region = ftRegionCruise;
+	clInput.banks[0] = clInput.banks[1] = 1.1;
+
+	// a quarter of the way from bin 2 to bin 3 on both axis
+	float rpm = config->veRpmBins[2] + 0.25f * (config->veRpmBins[3] - config->veRpmBins[2]);
+	float load = config->veLoadBins[2] + 0.25f * (config->veLoadBins[3] - config->veLoadBins[2]);
+
+	ltft.updateCell(rpm, load);
+	ITERATE_TIME(1, ltft.learn(clInput))
+
+	// every surrounding cell learns, in proportion to its weight
+	float nearest = ltftState.trims[0][2][2];
+	EXPECT_GT(nearest, 0);
+	EXPECT_NEAR(nearest / 3, ltftState.trims[0][2][3], 1e-4);
+	EXPECT_NEAR(nearest / 3, ltftState.trims[0][3][2], 1e-4);
+	EXPECT_NEAR(nearest / 9, ltftState.trims[0][3][3], 1e-4);
+	EXPECT_EQ(0, ltftState.trims[0][1][2]);
+	EXPECT_EQ(0, ltftState.trims[0][2][4]);
+	EXPECT_FLOAT_EQ(nearest, ltftState.trims[1][2][2]);
+}
+
+TEST(LTFT, testConvergenceSpeed)
+{
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+	setupLearning(ltftState, ltft);
+
+	ClosedLoopFuelResult clInput;
+	clInput.region = ftRegionCruise;
+	clInput.banks[0] = clInput.banks[1] = 1.1;
+
+	// on a cell center trim follows the error with configured time constant
+	float rpm = config->veRpmBins[4];
+	float load = config->veLoadBins[4];
+	ltft.updateCell(rpm, load);
+	ITERATE_TIME(10, ltft.learn(clInput))
+	EXPECT_NEAR(1 + 0.1 * (1 - expf(-1)), ltft.getTrims().banks[0], 1e-3);
+
+	// half way between four cells each of them gets a quarter of the gain, correction at the
+	// operating point converges four times slower but it does converge
+	rpm = 0.5f * (config->veRpmBins[8] + config->veRpmBins[9]);
+	load = 0.5f * (config->veLoadBins[8] + config->veLoadBins[9]);
+	ltft.updateCell(rpm, load);
+	ITERATE_TIME(40, ltft.learn(clInput))
+	EXPECT_NEAR(1 + 0.1 * (1 - expf(-1)), ltft.getTrims().banks[0], 1e-3);
+	ITERATE_TIME(200, ltft.learn(clInput))
+	EXPECT_NEAR(1.1, ltft.getTrims().banks[0], 1e-3);
+
+	// far outside of the table nothing is learned
+	uint32_t misses = ltft.ltftCntMiss;
+	ltft.updateCell(2 * config->veRpmBins[VE_RPM_COUNT - 1], load);
+	ltft.learn(clInput);
+	EXPECT_EQ(misses + 1, ltft.ltftCntMiss);
+	EXPECT_FALSE(ltft.ltftLearning);
+}
+
+TEST(LTFT, testTrimsMatchInterpolation)
+{
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+	setupLearning(ltftState, ltft);
+	ltftState.fillRandom();
+
+	for (float rpm = 0; rpm < 9000; rpm += 370) {
+		for (float load = 0; load < 300; load += 13) {
+			ClosedLoopFuelResult result = ltft.getTrims(rpm, load);
+			for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+				float expected = 1 + interpolate3d(ltftState.trims[bank],
+					config->veLoadBins, load,
+					config->veRpmBins, rpm);
+				ASSERT_NEAR(expected, result.banks[bank], 1e-5) << rpm << " " << load;
+			}
+		}
+	}
+}
+
+TEST(LTFT, learnAndApplyReuseCell)
+{
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+	setupLearning(ltftState, ltft);
+	ltftState.fillRandom();
+
+	ClosedLoopFuelResult clInput;
+	clInput.region = ftRegionCruise;
+	clInput.banks[0] = 1.1;
+	clInput.banks[1] = 0.9;
+
+	// a quarter of the way from bin 4 to bin 5 on both axis
+	float rpm = config->veRpmBins[4] + 0.25f * (config->veRpmBins[5] - config->veRpmBins[4]);
+	float load = config->veLoadBins[4] + 0.25f * (config->veLoadBins[5] - config->veLoadBins[4]);
+	ltft.updateCell(rpm, load);
+	ClosedLoopFuelResult before = ltft.getTrims();
+
+	// bins no longer match the operating point, anything searching them again would land elsewhere
+	for (size_t i = 0; i < VE_RPM_COUNT; i++) {
+		config->veRpmBins[i] += 1000;
+	}
+
+	// bin search happened once in updateCell(), both banks of getTrims() and learn() only use its result
+	ClosedLoopFuelResult after = ltft.getTrims();
+	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+		EXPECT_EQ(before.banks[bank], after.banks[bank]);
+	}
+
+	LtftState previous = ltftState;
+	ltft.learn(clInput);
+	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+		for (size_t loadIdx = 0; loadIdx < VE_LOAD_COUNT; loadIdx++) {
+			for (size_t rpmIdx = 0; rpmIdx < VE_RPM_COUNT; rpmIdx++) {
+				bool isCell = (loadIdx == 4 || loadIdx == 5) && (rpmIdx == 4 || rpmIdx == 5);
+				EXPECT_EQ(isCell, previous.trims[bank][loadIdx][rpmIdx] != ltftState.trims[bank][loadIdx][rpmIdx])
+					<< bank << " " << loadIdx << " " << rpmIdx;
+			}
+		}
+	}
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test_engine_module_timing.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "engine_module_timing.h"
+
+TEST(EngineModuleTiming, record) {
+	EngineModuleTiming timing;
+	timing.reset();
+
+	timing.record(100);
+	EXPECT_EQ(1u, timing.calls);
+	EXPECT_EQ(100u, timing.max);
+	EXPECT_NEAR(100, timing.average, 1e-3);
+
+	timing.record(420);
+	timing.record(20);
+	EXPECT_EQ(3u, timing.calls);
+	EXPECT_EQ(20u, timing.last);
+	EXPECT_EQ(420u, timing.max);
+	EXPECT_EQ(540u, timing.total);
+	// rolling average moves 1/32 of the way to each new sample
+	float expected = 100 + (420 - 100) / 32.0f;
+	expected += (20 - expected) / 32;
+	EXPECT_NEAR(expected, timing.average, 1e-3);
+}
+
+struct QuickTestModule : public EngineModule {
+	void onFastCallback() override {
+		advanceTimeUs(5);
+	}
+};
+
+struct HeavyTestModule : public EngineModule {
+	void onFastCallback() override {
+		advanceTimeUs(30);
+	}
+};
+
+TEST(EngineModuleTiming, perModuleDuration) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	resetEngineModuleTiming();
+
+	type_list<QuickTestModule, HeavyTestModule> modules;
+	for (int i = 0; i < 3; i++) {
+		applyAllEngineModules(modules, EngineModuleHook::FastCallback, [](auto & m) { m.onFastCallback(); });
+	}
+
+	const EngineModuleTiming *quick = getEngineModuleTiming(EngineModuleHook::FastCallback, 0);
+	const EngineModuleTiming *heavy = getEngineModuleTiming(EngineModuleHook::FastCallback, 1);
+	ASSERT_NE(nullptr, quick);
+	ASSERT_NE(nullptr, heavy);
+
+	EXPECT_EQ(3u, quick->calls);
+	EXPECT_EQ(US2NT(5), quick->max);
+	EXPECT_NEAR(5, quick->average / getEngineModuleTimingCountsPerUs(), 1e-3);
+	EXPECT_EQ(US2NT(30), heavy->max);
+	EXPECT_EQ(3 * US2NT(30), heavy->total);
+
+	char name[40];
+	getEngineModuleName(heavy->prettyName, name, sizeof(name));
+	EXPECT_STREQ("HeavyTestModule", name);
+
+	// other hooks untouched
+	EXPECT_EQ(0u, getEngineModuleTiming(EngineModuleHook::SlowCallback, 0)->calls);
+	EXPECT_EQ(nullptr, getEngineModuleTiming(EngineModuleHook::FastCallback, getEngineModuleTimingCount()));
+
+	reportEngineModuleTimingToTS();
+	EXPECT_EQ(1u, engine->outputChannels.engineModulesHeaviestFastIndex);
+	EXPECT_NEAR(30, engine->outputChannels.engineModulesHeaviestFastMaxUs, 1e-3);
+	EXPECT_TRUE(engine->outputChannels.engineModulesFastUs >= engine->outputChannels.engineModulesHeaviestFastUs);
+	EXPECT_NEAR(0, engine->outputChannels.engineModulesSlowUs, 1e-3);
+}
+
+TEST(EngineModuleTiming, engineFastCallbackCoversAllModules) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	resetEngineModuleTiming();
+
+	engine->periodicFastCallback();
+
+	bool foundBoost = false;
+	for (size_t i = 0; i < getEngineModuleTimingCount(); i++) {
+		const EngineModuleTiming *timing = getEngineModuleTiming(EngineModuleHook::FastCallback, i);
+		EXPECT_EQ(1u, timing->calls) << "module " << i;
+
+		char name[40];
+		getEngineModuleName(timing->prettyName, name, sizeof(name));
+		foundBoost |= strcmp(name, "BoostController") == 0;
+	}
+	EXPECT_TRUE(foundBoost);
+}
+
+TEST(EngineModuleTiming, nameTruncation) {
+	char name[6];
+	getEngineModuleName("const char* getEngineModuleTypeName() [with TModule = LongTermFuelTrim]", name, sizeof(name));
+	EXPECT_STREQ("LongT", name);
+
+	getEngineModuleName(nullptr, name, sizeof(name));
+	EXPECT_STREQ("?", name);
+}
+
+TEST(EngineModuleTiming, slowCallbackPartsCoverAllModulesOnce) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	resetEngineModuleTiming();
+
+	// part zero is engine level work only
+	engine->periodicSlowCallbackPart(0, 3);
+	EXPECT_EQ(0u, getEngineModuleTiming(EngineModuleHook::SlowCallback, 0)->calls);
+
+	engine->periodicSlowCallbackPart(1, 3);
+	EXPECT_EQ(1u, getEngineModuleTiming(EngineModuleHook::SlowCallback, 0)->calls);
+	EXPECT_EQ(0u, getEngineModuleTiming(EngineModuleHook::SlowCallback, 1)->calls);
+
+	engine->periodicSlowCallbackPart(2, 3);
+	for (size_t i = 0; i < getEngineModuleTimingCount(); i++) {
+		EXPECT_EQ(1u, getEngineModuleTiming(EngineModuleHook::SlowCallback, i)->calls) << "module " << i;
+	}
+}
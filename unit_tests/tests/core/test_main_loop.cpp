@@ -88,4 +88,142 @@ TEST(MainLoop, operatorTest){
 
     auto operatorResult = LoopPeriod::None & LoopPeriod::Period500hz;
     EXPECT_FALSE(operatorResult);
-}
\ No newline at end of file
+}
+static int taskCalls;
+static uint8_t lastPart;
+static int taskDurationUs;
+
+static void testTask(efitick_t, uint8_t part) {
+    taskCalls++;
+    lastPart = part;
+    advanceTimeUs(taskDurationUs);
+}
+
+static void resetTestTask(int durationUs) {
+    taskCalls = 0;
+    lastPart = 0xFF;
+    taskDurationUs = durationUs;
+}
+
+// one main loop tick
+static void tick(RateGroup& group, LoopPeriod flags) {
+    group.onTick(flags, getTimeNowNt());
+    advanceTimeUs(1000 - taskDurationUs);
+}
+
+TEST(MainLoop, rateGroupPartsSpreadOverTicks) {
+    setTimeNowUs(0);
+    resetTestTask(100);
+    RateGroup group("test", LoopPeriod::Period20hz, testTask, 3);
+
+    // not released yet
+    tick(group, LoopPeriod::Period1000hz);
+    EXPECT_EQ(taskCalls, 0);
+
+    tick(group, LoopPeriod::Period1000hz | LoopPeriod::Period20hz);
+    EXPECT_EQ(taskCalls, 1);
+    EXPECT_EQ(lastPart, 0);
+
+    tick(group, LoopPeriod::Period1000hz);
+    EXPECT_EQ(lastPart, 1);
+    tick(group, LoopPeriod::Period1000hz);
+    EXPECT_EQ(lastPart, 2);
+    EXPECT_EQ(taskCalls, 3);
+
+    // done until next release
+    tick(group, LoopPeriod::Period1000hz);
+    EXPECT_EQ(taskCalls, 3);
+
+    const RateGroupStats& stats = group.getStats();
+    EXPECT_EQ(stats.releases, 1u);
+    EXPECT_EQ(stats.overruns, 0u);
+    // sum of all three parts
+    EXPECT_EQ(stats.lastExecNt, (uint32_t)US2NT(300));
+    EXPECT_EQ(stats.execHistogram[RateGroupStats::getBin(US2NT(300))], 1);
+}
+
+TEST(MainLoop, rateGroupPartCountLimitedByTicks) {
+    setTimeNowUs(0);
+    resetTestTask(0);
+    // only one tick per 1000hz period
+    RateGroup group("test", LoopPeriod::Period1000hz, testTask, 3);
+
+    tick(group, LoopPeriod::Period1000hz);
+    tick(group, LoopPeriod::Period1000hz);
+    EXPECT_EQ(taskCalls, 2);
+    EXPECT_EQ(lastPart, 0);
+    EXPECT_EQ(group.getStats().overruns, 0u);
+}
+
+TEST(MainLoop, rateGroupDeadlineOverrun) {
+    setTimeNowUs(0);
+    resetTestTask(600);
+    RateGroup group("test", LoopPeriod::Period500hz, testTask, 1, /*deadlineMs*/ 0.5);
+
+    group.onTick(LoopPeriod::Period500hz, getTimeNowNt());
+    EXPECT_EQ(group.getStats().overruns, 1u);
+    EXPECT_EQ(group.getStats().maxExecNt, (uint32_t)US2NT(600));
+
+    // within default deadline of whole period
+    setTimeNowUs(0);
+    RateGroup relaxed("test", LoopPeriod::Period500hz, testTask);
+    relaxed.onTick(LoopPeriod::Period500hz, getTimeNowNt());
+    EXPECT_EQ(relaxed.getStats().overruns, 0u);
+
+    relaxed.resetStats();
+    EXPECT_EQ(relaxed.getStats().releases, 0u);
+}
+
+TEST(MainLoop, rateGroupReleasedWhilePending) {
+    setTimeNowUs(0);
+    resetTestTask(0);
+    RateGroup group("test", LoopPeriod::Period20hz, testTask, 3);
+
+    group.onTick(LoopPeriod::Period20hz, getTimeNowNt());
+    // released again before parts 1 and 2 got their ticks
+    group.onTick(LoopPeriod::Period20hz, getTimeNowNt());
+
+    EXPECT_EQ(group.getStats().releases, 2u);
+    EXPECT_EQ(group.getStats().overruns, 1u);
+    // starts over from first part
+    EXPECT_EQ(lastPart, 0);
+}
+
+TEST(MainLoop, rateGroupJitter) {
+    setTimeNowUs(0);
+    resetTestTask(0);
+    RateGroup group("test", LoopPeriod::Period200hz, testTask);
+
+    group.onTick(LoopPeriod::Period200hz, getTimeNowNt());
+    // right on time
+    advanceTimeUs(5000);
+    group.onTick(LoopPeriod::Period200hz, getTimeNowNt());
+    // 300us late
+    advanceTimeUs(5300);
+    group.onTick(LoopPeriod::Period200hz, getTimeNowNt());
+    // 200us early
+    advanceTimeUs(4800);
+    group.onTick(LoopPeriod::Period200hz, getTimeNowNt());
+
+    const RateGroupStats& stats = group.getStats();
+    EXPECT_EQ(stats.maxJitterNt, (uint32_t)US2NT(300));
+    EXPECT_EQ(stats.jitterHistogram[0], 1);
+    EXPECT_EQ(stats.jitterHistogram[RateGroupStats::getBin(US2NT(300))], 1);
+    EXPECT_EQ(stats.jitterHistogram[RateGroupStats::getBin(US2NT(200))], 1);
+}
+
+TEST(MainLoop, rateGroupHistogramBins) {
+    EXPECT_EQ(RateGroupStats::getBin(0), 0u);
+    EXPECT_EQ(RateGroupStats::getBin(US2NT(1)), 1u);
+    EXPECT_EQ(RateGroupStats::getBin(US2NT(3)), 2u);
+    EXPECT_EQ(RateGroupStats::getBin(US2NT(1000)), 10u);
+    EXPECT_EQ(RateGroupStats::getBin(US2NT(1000000)), (size_t)RATE_GROUP_HISTOGRAM_BINS - 1);
+}
+
+TEST(MainLoop, groupsRateMonotonic) {
+    for (size_t i = 1; i < MAIN_LOOP_GROUP_COUNT; i++) {
+        EXPECT_GE(hzForPeriod(mainLoop.getGroup(i - 1).getPeriod()), hzForPeriod(mainLoop.getGroup(i).getPeriod()));
+    }
+
+    EXPECT_EQ(mainLoop.getGroup(MAIN_LOOP_GROUP_COUNT - 1).getPeriod(), SLOW_CALLBACK_RATE);
+}
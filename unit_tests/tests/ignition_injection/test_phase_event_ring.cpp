@@ -0,0 +1,163 @@
+/**
+ * @file test_phase_event_ring.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "phase_event_ring.h"
+
+#include <vector>
+
+static void rebuild(PhaseEventRing& ring, const std::vector<float>& angles) {
+	ring.beginRebuild();
+	for (size_t i = 0; i < angles.size(); i++) {
+		ring.add(angles[i], i);
+	}
+	ring.finishRebuild();
+}
+
+static std::vector<uint8_t> inRange(PhaseEventRing& ring, float currentPhase, float nextPhase) {
+	std::vector<uint8_t> ids;
+	ring.forEachInRange(currentPhase, nextPhase, [&](uint8_t id) {
+		ids.push_back(id);
+	});
+	return ids;
+}
+
+// how far from currentPhase the engine is when it gets to the angle
+static float distanceFrom(float currentPhase, float angle) {
+	float distance = angle - currentPhase;
+	return distance < 0 ? distance + 720 : distance;
+}
+
+TEST(PhaseEventRing, wrapAround) {
+	PhaseEventRing ring;
+	// 0 and 719.9 on both sides of the cycle end, NaN never fires
+	rebuild(ring, { 360, 719.9f, 0, 180, NAN, 540 });
+	EXPECT_EQ(5u, ring.getCount());
+
+	EXPECT_EQ((std::vector<uint8_t>{ 3 }), inRange(ring, 170, 190));
+	// range end is exclusive
+	EXPECT_EQ((std::vector<uint8_t>{ }), inRange(ring, 170, 180));
+	EXPECT_EQ((std::vector<uint8_t>{ 3 }), inRange(ring, 180, 181));
+
+	// last tooth of the cycle, in the order engine gets to them
+	EXPECT_EQ((std::vector<uint8_t>{ 1, 2 }), inRange(ring, 700, 10));
+	EXPECT_EQ((std::vector<uint8_t>{ 5, 1, 2, 3 }), inRange(ring, 500, 200));
+
+	// a single tooth per cycle sees everything
+	EXPECT_EQ((std::vector<uint8_t>{ 5, 1, 2, 3, 0 }), inRange(ring, 450, 450));
+}
+
+TEST(PhaseEventRing, sameAsPhaseInRange) {
+	srand(7);
+
+	for (int shape = 0; shape < 50; shape++) {
+		PhaseEventRing ring;
+		std::vector<float> angles;
+		int count = 1 + rand() % PHASE_EVENT_RING_SIZE;
+		for (int i = 0; i < count; i++) {
+			// duplicates on purpose
+			angles.push_back((rand() % 1440) * 0.5f);
+		}
+		rebuild(ring, angles);
+
+		// every tooth of a 60-2 wheel over a four stroke cycle plus random windows
+		for (int tooth = 0; tooth < 500; tooth++) {
+			float currentPhase = tooth < 120 ? tooth * 6 : (rand() % 7200) * 0.1f;
+			float nextPhase = tooth < 120 ? ((tooth + 1) % 120) * 6 : (rand() % 7200) * 0.1f;
+
+			std::vector<uint8_t> expected;
+			for (size_t i = 0; i < angles.size(); i++) {
+				if (isPhaseInRange(angles[i], currentPhase, nextPhase)) {
+					expected.push_back(i);
+				}
+			}
+
+			std::vector<uint8_t> actual = inRange(ring, currentPhase, nextPhase);
+
+			// same events
+			std::vector<uint8_t> sorted = actual;
+			std::sort(sorted.begin(), sorted.end());
+			ASSERT_EQ(expected, sorted) << currentPhase << " " << nextPhase;
+
+			// in the order they happen
+			for (size_t i = 1; i < actual.size(); i++) {
+				EXPECT_LE(distanceFrom(currentPhase, angles[actual[i - 1]]), distanceFrom(currentPhase, angles[actual[i]]));
+			}
+		}
+	}
+}
+
+TEST(PhaseEventRing, invalidate) {
+	PhaseEventRing ring;
+	EXPECT_TRUE(ring.needsRebuild());
+
+	rebuild(ring, { 100, 200 });
+	EXPECT_FALSE(ring.needsRebuild());
+
+	ring.invalidate();
+	EXPECT_TRUE(ring.needsRebuild());
+	rebuild(ring, { 300, 200 });
+	EXPECT_EQ((std::vector<uint8_t>{ 1, 0 }), inRange(ring, 150, 350));
+}
+
+TEST(PhaseEventRing, everyEventOncePerCycle) {
+	constexpr int cylinders = 12;
+	constexpr int teeth = 116;
+	constexpr int cycles = 3;
+
+	std::vector<float> angles;
+	for (int i = 0; i < cylinders; i++) {
+		angles.push_back(i * 720.0f / cylinders + 13);
+	}
+
+	PhaseEventRing ring;
+	rebuild(ring, angles);
+
+	// 60-2 over a four stroke cycle, the gap is two teeth wide
+	std::vector<float> phases;
+	for (int i = 0; i < teeth; i++) {
+		phases.push_back((i < 58 ? i : i + 2) * 6);
+	}
+
+	for (int cycle = 0; cycle < cycles; cycle++) {
+		std::vector<int> visits(cylinders);
+		int callbacks = 0;
+		for (int tooth = 0; tooth < teeth; tooth++) {
+			float currentPhase = phases[tooth];
+			float nextPhase = phases[(tooth + 1) % teeth];
+			ring.forEachInRange(currentPhase, nextPhase, [&](uint8_t id) {
+				EXPECT_TRUE(isPhaseInRange(angles[id], currentPhase, nextPhase)) << tooth;
+				visits[id]++;
+				callbacks++;
+			});
+		}
+
+		// one callback per event, where checking every cylinder on every tooth takes cylinders * teeth calls
+		EXPECT_EQ(std::vector<int>(cylinders, 1), visits) << cycle;
+		EXPECT_EQ(cylinders, callbacks) << cycle;
+	}
+}
+
+TEST(PhaseEventRing, noRebuildAtSteadyState) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->isFasterEngineSpinUpEnabled = false;
+	setCrankOperationMode();
+	eth.setTriggerType(trigger_type_e::TT_HALF_MOON);
+
+	eth.smartFireTriggerEvents2(/* count */ 20, 25 /* ms */);
+	ASSERT_EQ(1200, Sensor::getOrZero(SensorType::Rpm));
+
+	uint32_t ignitionRebuilds = engine->ignitionEvents.phaseOrder.getRebuildCount();
+	uint32_t injectionRebuilds = getFuelSchedule()->phaseOrder.getRebuildCount();
+	ASSERT_LT(0u, ignitionRebuilds);
+	ASSERT_LT(0u, injectionRebuilds);
+
+	// same RPM and load, so neither dwell nor injection angles move
+	eth.smartFireTriggerEvents2(/* count */ 20, 25 /* ms */);
+	EXPECT_EQ(ignitionRebuilds, engine->ignitionEvents.phaseOrder.getRebuildCount());
+	EXPECT_EQ(injectionRebuilds, getFuelSchedule()->phaseOrder.getRebuildCount());
+}
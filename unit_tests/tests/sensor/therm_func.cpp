@@ -114,3 +114,82 @@ TEST(Thermistor, Option3) {
     ASSERT_NEAR(-9.17, thermistorFuncAat->convert(53100).Value, EPS2D);
 }
 
+
+struct ThermistorTableCase {
+	const char* name;
+	thermistor_conf_s conf;
+	bool isPulldown;
+};
+
+static const ThermistorTableCase thermistorTableCases[] = {
+	{ "common NTC", {-20, 23.8889, 120, 18000, 2100, 100, 2700}, false },
+	{ "GM", {-40, 40, 130, 100'000, 1459, 70, 2490}, false },
+	{ "Dodge", {-40, 30, 120, 336660, 7550, 390, 2700}, false },
+	{ "common NTC pulldown", {-20, 23.8889, 120, 18000, 2100, 100, 2700}, true },
+	{ "PTC", {0, 100, 200, 486, 975, 1679, 1000}, false },
+};
+
+static void configureThermistorTable(thermistor_t& f, const ThermistorTableCase& c) {
+	thermistor_conf_s conf = c.conf;
+	f.get<resist>().configure(5.0f, conf.bias_resistor, c.isPulldown);
+	f.get<therm>().configure(conf);
+	f.configure();
+}
+
+TEST(Thermistor, TableMatchesExact) {
+	for (const auto& c : thermistorTableCases) {
+		thermistor_t f;
+		configureThermistorTable(f, c);
+
+		// reported error should be what we find ourselves, and small over the range engines actually see
+		float worst = 0;
+		float worstInCommonRange = 0;
+
+		for (float raw = 0; raw < 5.2f; raw += 0.0005f) {
+			SensorResult exact = f.convertExact(raw);
+			SensorResult table = f.convert(raw);
+
+			if (raw < 0.05f || raw > 5.0f * 0.98f) {
+				// shorted/open circuit is decided exactly the same way
+				ASSERT_FALSE(table.Valid) << c.name << " " << raw;
+				ASSERT_EQ(exact.Code, table.Code) << c.name << " " << raw;
+				continue;
+			}
+
+			if (!exact.Valid || !table.Valid) {
+				// a table value slightly off may only flip validity right next to the limits
+				if (exact.Valid != table.Valid) {
+					float celsius = f.get<therm>().getCelsius(f.get<resist>().convert(raw).Value);
+					float limitDistance = std::min(std::abs(celsius - (-50)), std::abs(celsius - CLT_UPPER_VALIDATION_LIMIT));
+					ASSERT_LT(limitDistance, f.getMaxError() + 0.01f) << c.name << " " << raw;
+				}
+				continue;
+			}
+
+			float error = std::abs(table.Value - exact.Value);
+			worst = std::max(worst, error);
+			if (exact.Value > -40 && exact.Value < 150) {
+				worstInCommonRange = std::max(worstInCommonRange, error);
+			}
+		}
+
+		EXPECT_LE(worst, f.getMaxError() * 1.05f + 0.001f) << c.name;
+		EXPECT_GE(worst, f.getMaxError() * 0.95f) << c.name;
+		EXPECT_LT(f.getMaxError(), 1.2f) << c.name;
+		EXPECT_LT(worstInCommonRange, 0.35f) << c.name;
+	}
+}
+
+TEST(Thermistor, TableNotConfiguredUsesExact) {
+	thermistor_t f;
+	thermistor_conf_s conf = {-20, 23.8889, 120, 18000, 2100, 100, 2700};
+	f.get<resist>().configure(5.0f, conf.bias_resistor, false);
+	f.get<therm>().configure(conf);
+
+	for (float raw = 0; raw < 5.2f; raw += 0.01f) {
+		SensorResult exact = f.convertExact(raw);
+		SensorResult result = f.convert(raw);
+		ASSERT_EQ(exact.Valid, result.Valid);
+		ASSERT_EQ(exact.Value, result.Value);
+	}
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "logicdata_csv_reader.h"
 #include "sent_decoder.h"
+#include "sent_pulse_buffer.h"
 
 // On STM32 we are running timer on 1/4 of cpu clock. Cpu clock is 168 MHz
 #define CORE_CLOCK				168'000'000
@@ -217,3 +218,121 @@ TEST(sent, testNoMessages) {
    	bool isError = channel.GetMsg(nullptr) != 0;
    	ASSERT_TRUE(isError);
 }
+
+static std::vector<uint16_t> sentTest_readPulses(const char *file) {
+	std::vector<uint16_t> pulses;
+	CsvReader reader(1, 0);
+
+	reader.open(file);
+
+	bool first = true;
+	double prevTimeStamp = 0;
+
+	while (reader.haveMore()) {
+		double value = 0;
+		double stamp = reader.readTimestampAndValues(&value);
+
+		if (first) {
+			prevTimeStamp = stamp;
+			first = false;
+			continue;
+		}
+		// we care only about falling edges
+		if (value < 0.5) {
+			pulses.push_back((stamp - prevTimeStamp) * TIMER_CLOCK);
+			prevTimeStamp = stamp;
+		}
+	}
+
+	return pulses;
+}
+
+// Capture ISR pushes into ring and wakes decoder on frame boundary, decoder drains whole batch
+static void sentTest_batchedMatchesDirect(const char *file) {
+	std::vector<uint16_t> pulses = sentTest_readPulses(file);
+	ASSERT_TRUE(pulses.size() > 100);
+
+	sent_channel direct;
+	int directMessages = 0;
+	for (uint16_t clocks : pulses) {
+		if (direct.Decoder(clocks, 0) > 0) {
+			directMessages++;
+		}
+	}
+
+	sent_channel batched;
+	SentPulseBuffer<64> buffer;
+	int batchedMessages = 0;
+	int wakeups = 0;
+	for (uint16_t clocks : pulses) {
+		ASSERT_TRUE(buffer.push(clocks, 0));
+		if (sentIsFrameBoundary(batched.getTickTime(), clocks) || buffer.getCount() >= 10) {
+			batchedMessages += sentDecodePending(buffer, batched);
+			wakeups++;
+		}
+	}
+	batchedMessages += sentDecodePending(buffer, batched);
+
+	EXPECT_EQ(directMessages, batchedMessages);
+	EXPECT_EQ(0u, buffer.getOverflowCounter());
+	// about one wakeup per frame instead of one per pulse
+	EXPECT_TRUE(wakeups < (int)pulses.size() / 4);
+
+	uint8_t stat1, stat2;
+	uint16_t sig01, sig11, sig02, sig12;
+	ASSERT_EQ(0, direct.GetSignals(&stat1, &sig01, &sig11));
+	ASSERT_EQ(0, batched.GetSignals(&stat2, &sig02, &sig12));
+	EXPECT_EQ(stat1, stat2);
+	EXPECT_EQ(sig01, sig02);
+	EXPECT_EQ(sig11, sig12);
+
+	for (int i = 0; i < 256; i++) {
+		EXPECT_EQ(direct.GetSlowChannelValue(i), batched.GetSlowChannelValue(i));
+	}
+}
+
+TEST(sent, batchedFordIdle) {
+	sentTest_batchedMatchesDirect("tests/sent/resources/ford-sent-idle.csv");
+}
+
+TEST(sent, batchedOpelMove) {
+	sentTest_batchedMatchesDirect("tests/sent/resources/opel-throttle-move.csv");
+}
+
+TEST(sent, batchedFuelPressure) {
+	sentTest_batchedMatchesDirect("tests/sent/resources/SENT-fuel-pressure.csv");
+}
+
+TEST(sent, batchedVagMap) {
+	sentTest_batchedMatchesDirect("tests/sent/resources/vag_04e.906.051.csv");
+}
+
+TEST(sent, pulseBufferOverflow) {
+	SentPulseBuffer<4> buffer;
+
+	for (int i = 0; i < 4; i++) {
+		ASSERT_TRUE(buffer.push(100 + i, 0));
+	}
+	// full, pulse is dropped
+	ASSERT_FALSE(buffer.push(200, 0));
+	EXPECT_EQ(1u, buffer.getOverflowCounter());
+
+	uint16_t clocks;
+	uint8_t flags;
+	for (int i = 0; i < 4; i++) {
+		ASSERT_TRUE(buffer.pop(clocks, flags));
+		EXPECT_EQ(100 + i, clocks);
+		EXPECT_EQ(0, flags);
+	}
+	ASSERT_FALSE(buffer.pop(clocks, flags));
+
+	// next pulse after loss tells decoder to restart
+	ASSERT_TRUE(buffer.push(300, 0));
+	ASSERT_TRUE(buffer.pop(clocks, flags));
+	EXPECT_EQ(300, clocks);
+	EXPECT_EQ(SENT_FLAG_HW_OVERFLOW, flags);
+
+	ASSERT_TRUE(buffer.push(301, 0));
+	ASSERT_TRUE(buffer.pop(clocks, flags));
+	EXPECT_EQ(0, flags);
+}
@@ -0,0 +1,131 @@
+/**
+ * @file test_edge_latency.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "edge_latency.h"
+
+using ::testing::_;
+
+TEST(EdgeLatency, buckets) {
+	EXPECT_EQ(0u, EdgeLatency::getBucketIndex(-US2NT(5)));
+	EXPECT_EQ(0u, EdgeLatency::getBucketIndex(0));
+	EXPECT_EQ(1u, EdgeLatency::getBucketIndex(US2NT(1)));
+	EXPECT_EQ(2u, EdgeLatency::getBucketIndex(US2NT(3)));
+	EXPECT_EQ(3u, EdgeLatency::getBucketIndex(US2NT(4)));
+	EXPECT_EQ(5u, EdgeLatency::getBucketIndex(US2NT(20)));
+	EXPECT_EQ(11u, EdgeLatency::getBucketIndex(US2NT(1024)));
+	EXPECT_EQ(11u, EdgeLatency::getBucketIndex(US2NT(1'000'000)));
+
+	EdgeLatency stats;
+	stats.reset();
+	stats.record(US2NT(2));
+	stats.record(US2NT(10));
+	stats.record(-US2NT(1));
+
+	EXPECT_EQ(3u, stats.count);
+	EXPECT_EQ(-US2NT(1), stats.minNt);
+	EXPECT_EQ(US2NT(10), stats.maxNt);
+	EXPECT_NEAR(11 / 3.0, stats.getMeanUs(), 1e-3);
+	EXPECT_EQ(1, stats.buckets[0]);
+	EXPECT_EQ(1, stats.buckets[2]);
+	EXPECT_EQ(1, stats.buckets[4]);
+}
+
+static void setCoilHigh() {
+	enginePins.coils[1].setHigh();
+}
+
+TEST(EdgeLatency, isrDelayMeasuredOnCoil) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	resetEdgeLatency();
+
+	scheduling_s scheduling;
+	engine->scheduler.schedule("test", &scheduling, US2NT(1000), action_s::make<setCoilHigh>());
+	engine->scheduler.setIsrDelayUs(7);
+
+	eth.setTimeAndInvokeEventsUs(2000);
+
+	const auto& report = getEdgeLatencyReport();
+	EXPECT_TRUE(report.queue.count >= 1);
+	EXPECT_TRUE(report.queue.maxNt >= US2NT(7));
+
+	EXPECT_EQ(0u, report.coils[0].count);
+	const auto& coil = report.coils[1];
+	EXPECT_EQ(1u, coil.count);
+	EXPECT_EQ(US2NT(7), coil.minNt);
+	EXPECT_EQ(US2NT(7), coil.maxNt);
+	// [4, 8) us
+	EXPECT_EQ(1, coil.buckets[3]);
+
+	// toggled outside of scheduled action - not an edge to measure
+	enginePins.coils[1].setLow();
+	EXPECT_EQ(1u, coil.count);
+
+	// published to output channels regardless of debug mode
+	reportEdgeLatencyToTS();
+	EXPECT_NEAR(7, engine->outputChannels.edgeLatencyCoilMax, 1e-3);
+	EXPECT_NEAR(7, engine->outputChannels.edgeLatencyCoilMean, 1e-3);
+	EXPECT_TRUE(engine->outputChannels.edgeLatencyQueueMax >= 7);
+
+	engine->scheduler.setIsrDelayUs(0);
+}
+
+TEST(EdgeLatency, engineOutputsWithIsrDelay) {
+	extern bool unitTestTaskPrecisionHack;
+	unitTestTaskPrecisionHack = true;
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->isFasterEngineSpinUpEnabled = false;
+
+	EXPECT_CALL(*eth.mockAirmass, getAirmass(_, _))
+		.WillRepeatedly(Return(AirmassResult{0.1008f, 50.0f}));
+
+	setupSimpleTestEngineWithMafAndTT_ONE_trigger(&eth);
+	engineConfiguration->injectionMode = IM_BATCH;
+	engineConfiguration->isIgnitionEnabled = true;
+
+	eth.fireTriggerEventsWithDuration(20);
+	eth.fireTriggerEventsWithDuration(20);
+	ASSERT_EQ(3000, Sensor::getOrZero(SensorType::Rpm));
+
+	resetEdgeLatency();
+	engine->scheduler.setIsrDelayUs(20);
+
+	for (int i = 0; i < 8; i++) {
+		eth.smartFireRise(20);
+		eth.smartFireFall(20);
+	}
+
+	engine->scheduler.setIsrDelayUs(0);
+
+	const auto& report = getEdgeLatencyReport();
+	EXPECT_EQ((uint32_t)US_TO_NT_MULTIPLIER, report.ticksPerUs);
+
+	uint32_t injectorEdges = 0;
+	uint32_t coilEdges = 0;
+
+	for (size_t i = 0; i < MAX_CYLINDER_COUNT; i++) {
+		for (const EdgeLatency* stats : { &report.injectors[i], &report.coils[i] }) {
+			if (stats->count == 0) {
+				continue;
+			}
+
+			// never early, at least as late as the interrupt
+			EXPECT_TRUE(stats->minNt >= US2NT(20)) << "output " << i;
+			EXPECT_TRUE(stats->getMeanUs() >= 20) << "output " << i;
+			EXPECT_EQ(0, stats->buckets[0]) << "output " << i;
+			// [16, 32) us
+			EXPECT_TRUE(stats->buckets[5] > 0) << "output " << i;
+		}
+
+		injectorEdges += report.injectors[i].count;
+		coilEdges += report.coils[i].count;
+	}
+
+	EXPECT_TRUE(injectorEdges > 0);
+	EXPECT_TRUE(coilEdges > 0);
+	EXPECT_TRUE(report.queue.count >= injectorEdges / 2);
+}
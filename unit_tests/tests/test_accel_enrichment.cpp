@@ -150,4 +150,38 @@ TEST(fuel, testTpsAccelEnrichment) {
 	engineConfiguration->accelEnrichmentMode = AE_MODE_PREDICTIVE_MAP;
 	// should return 0 if we are using predictive map
 	EXPECT_EQ(0, engine->module<TpsAccelEnrichment>()->getTpsEnrichment());
-}
\ No newline at end of file
+}
+TEST(fuel, testTpsAccelMaxDeltaSameAsScan) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	auto& tpsAccel = *engine->module<TpsAccelEnrichment>();
+
+	srand(42);
+
+	for (int length : { 2, 3, 4, 10, 40 }) {
+		tpsAccel.setLength(length);
+		std::vector<float> values;
+
+		for (int i = 0; i < 500; i++) {
+			float tps = rand() % 101;
+			values.push_back(tps);
+			tpsAccel.onNewValue(tps);
+
+			// what getMaxDeltaIndex used to do: newest to oldest over the last 'length' values
+			int len = std::min<int>(values.size(), length);
+			if (len < 2) {
+				continue;
+			}
+			int ci = values.size() - 1;
+			float expected = values[ci] - values[ci - 1];
+			for (int back = 1; back < len - 1; back++) {
+				float v = values[ci - back] - values[ci - back - 1];
+				if (v > expected) {
+					expected = v;
+				}
+			}
+
+			ASSERT_EQ(expected, tpsAccel.getMaxDelta()) << length << " " << i;
+			ASSERT_EQ(expected, tpsAccel.deltaTps) << length << " " << i;
+		}
+	}
+}
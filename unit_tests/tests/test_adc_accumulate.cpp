@@ -0,0 +1,77 @@
+#include "pch.h"
+
+#include "adc_accumulate.h"
+
+#include <random>
+
+// what AdcDevice::getAvgAdcValue used to do on every read
+static uint32_t sumChannelNaive(const uint16_t *buf, size_t channels, size_t depth, size_t channel) {
+	uint32_t result = 0;
+	size_t index = channel;
+	for (size_t i = 0; i < depth; i++) {
+		result += buf[index];
+		index += channels;
+	}
+	return result;
+}
+
+static void fillRandom(uint16_t *buf, size_t size, uint16_t maxValue) {
+	std::mt19937 rng(12345);
+	std::uniform_int_distribution<int> dist(0, maxValue);
+	for (size_t i = 0; i < size; i++) {
+		buf[i] = dist(rng);
+	}
+}
+
+TEST(AdcAccumulate, MatchesPerChannelSum) {
+	for (size_t channels : { 1, 2, 5, 8, 13, 16 }) {
+		for (size_t depth : { 1, 4, 16 }) {
+			uint16_t buf[16 * 16];
+			fillRandom(buf, channels * depth, 4095);
+
+			uint32_t sums[ADC_ACCUMULATE_MAX_CHANNELS];
+			uint16_t orAll = adcAccumulateInterleaved(buf, channels, depth, sums);
+			EXPECT_TRUE(orAll <= 4095);
+
+			for (size_t ch = 0; ch < channels; ch++) {
+				EXPECT_EQ(sumChannelNaive(buf, channels, depth, ch), sums[ch]) << channels << "x" << depth << " ch" << ch;
+			}
+		}
+	}
+}
+
+TEST(AdcAccumulate, OutOfRangeSampleIsVisibleInOr) {
+	uint16_t buf[4 * 4] = {};
+	uint32_t sums[4];
+
+	EXPECT_EQ(0, adcAccumulateInterleaved(buf, 4, 4, sums));
+
+	buf[9] = 0x1000;
+	buf[3] = 0x0fff;
+	EXPECT_TRUE(adcAccumulateInterleaved(buf, 4, 4, sums) > 4095);
+	EXPECT_EQ(0x1000u, sums[1]);
+	EXPECT_EQ(0x0fffu, sums[3]);
+}
+
+// fast ADC buffer shape, what AdcDevice publishes against averaging the samples on every read
+TEST(AdcAccumulate, AverageMatchesPerSampleAverage) {
+	constexpr size_t channels = 16;
+	constexpr size_t depth = 4;
+	alignas(4) uint16_t buf[channels * depth];
+
+	for (uint16_t maxValue : { 0, 1, 100, 4095 }) {
+		fillRandom(buf, efi::size(buf), maxValue);
+		// full scale on every row of the last channel
+		for (size_t row = 0; row < depth; row++) {
+			buf[row * channels + channels - 1] = maxValue;
+		}
+
+		uint32_t sums[channels];
+		EXPECT_LE(adcAccumulateInterleaved(buf, channels, depth, sums, 4095), 4095);
+
+		for (size_t ch = 0; ch < channels; ch++) {
+			EXPECT_EQ(sumChannelNaive(buf, channels, depth, ch) / depth, sums[ch] / depth) << maxValue << " ch" << ch;
+		}
+		EXPECT_EQ(maxValue, sums[channels - 1] / depth);
+	}
+}
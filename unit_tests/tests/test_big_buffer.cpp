@@ -1,10 +1,84 @@
 #include "pch.h"
 
-BigBufferUser getBigBufferCurrentUser();
+static BigBufferReport::Block getBlock(BigBufferUser user) {
+  return getBigBufferReport().users[(size_t)user];
+}
 
 TEST(BigBuffer, CppMagic) {
   BigBufferHandle h = getBigBuffer(BigBufferUser::ToothLogger);
-  ASSERT_EQ(getBigBufferCurrentUser(), BigBufferUser::ToothLogger);
+  ASSERT_TRUE(h);
+  ASSERT_EQ(getBlock(BigBufferUser::ToothLogger).size, h.size());
   h = {};
-  ASSERT_EQ(getBigBufferCurrentUser(), BigBufferUser::None);
+  ASSERT_EQ(0u, getBlock(BigBufferUser::ToothLogger).size);
+  ASSERT_EQ(0u, getBigBufferReport().used);
+}
+
+TEST(BigBuffer, TwoDiagnosticsAtOnce) {
+  BigBufferHandle tooth = getBigBuffer(BigBufferUser::ToothLogger);
+  BigBufferHandle scope = getBigBuffer(BigBufferUser::TriggerScope);
+
+  ASSERT_TRUE(tooth);
+  ASSERT_TRUE(scope);
+  EXPECT_EQ((size_t)BIG_BUFFER_QUOTA_TOOTH_LOGGER, tooth.size());
+  EXPECT_EQ((size_t)BIG_BUFFER_QUOTA_TRIGGER_SCOPE, scope.size());
+
+  // no overlap
+  auto toothStart = tooth.get<uint8_t>();
+  auto scopeStart = scope.get<uint8_t>();
+  EXPECT_TRUE(toothStart + tooth.size() <= scopeStart || scopeStart + scope.size() <= toothStart);
+
+  // each user holds one block at a time
+  uint32_t failedBefore = getBigBufferReport().failedRequests;
+  EXPECT_FALSE(getBigBuffer(BigBufferUser::ToothLogger));
+  EXPECT_EQ(failedBefore + 1, getBigBufferReport().failedRequests);
+
+  auto report = getBigBufferReport();
+  EXPECT_EQ(tooth.size() + scope.size(), report.used);
+  EXPECT_EQ((size_t)BIG_BUFFER_SIZE - report.used, report.largestFree);
+  EXPECT_TRUE(report.highWater >= report.used);
+  EXPECT_EQ(tooth.size(), getBlock(BigBufferUser::ToothLogger).size);
+  EXPECT_EQ(scope.size(), getBlock(BigBufferUser::TriggerScope).size);
+}
+
+TEST(BigBuffer, ReclaimOnRelease) {
+  uint8_t* arenaStart;
+  {
+    BigBufferHandle tooth = getBigBuffer(BigBufferUser::ToothLogger);
+    BigBufferHandle scope = getBigBuffer(BigBufferUser::TriggerScope);
+    ASSERT_TRUE(tooth);
+    ASSERT_TRUE(scope);
+    arenaStart = std::min(tooth.get<uint8_t>(), scope.get<uint8_t>());
+
+    // too little space for a caller with a minimum
+    EXPECT_FALSE(getBigBuffer(BigBufferUser::PerfTrace, (size_t)BIG_BUFFER_SIZE - tooth.size() - scope.size() + 8));
+  }
+  EXPECT_EQ(0u, getBigBufferReport().used);
+
+  // released space is reused
+  BigBufferHandle trace = getBigBuffer(BigBufferUser::PerfTrace);
+  ASSERT_TRUE(trace);
+  EXPECT_EQ(arenaStart, trace.get<uint8_t>());
+  EXPECT_EQ((size_t)BIG_BUFFER_SIZE, trace.size());
+
+  // moving the handle moves ownership, not the block
+  BigBufferHandle moved = efi::move(trace);
+  EXPECT_FALSE(trace);
+  EXPECT_EQ(moved.size(), getBlock(BigBufferUser::PerfTrace).size);
+
+  moved = {};
+  EXPECT_EQ(0u, getBigBufferReport().used);
+  EXPECT_EQ((size_t)BIG_BUFFER_SIZE, getBigBufferReport().largestFree);
+}
+
+TEST(BigBuffer, Alignment) {
+  BigBufferHandle trace = getBigBuffer(BigBufferUser::PerfTrace, 8);
+  ASSERT_TRUE(trace);
+  trace = {};
+
+  BigBufferHandle tooth = getBigBuffer(BigBufferUser::ToothLogger);
+  ASSERT_TRUE(tooth);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(tooth.get<uint8_t>()) % 8);
+  EXPECT_EQ(0u, tooth.size() % 8);
+
+  EXPECT_FALSE(getBigBuffer(BigBufferUser::None));
 }
@@ -0,0 +1,158 @@
+/**
+ * @file test_live_data_snapshot.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "live_data_snapshot.h"
+#include "tunerstudio.h"
+#include "tunerstudio_impl.h"
+#include "tunerstudio_io.h"
+
+using TestImage = DoubleBufferedImage<64>;
+
+static const efidur_t maxAge = 1000;
+
+// every byte of a generation has the same value, so a torn image has two different values in it
+static bool produce(TestImage &image, uint8_t generation) {
+	uint8_t *buffer = image.beginWrite();
+	if (!buffer) {
+		return false;
+	}
+
+	memset(buffer, generation, TestImage::size);
+	image.publish(buffer, 0);
+	return true;
+}
+
+TEST(LiveDataSnapshot, nothingPublished) {
+	TestImage image;
+	EXPECT_EQ(nullptr, image.acquire(0, maxAge));
+
+	ASSERT_TRUE(produce(image, 1));
+	EXPECT_NE(nullptr, image.acquire(0, maxAge));
+	// too old
+	EXPECT_EQ(nullptr, image.acquire(maxAge + 1, maxAge));
+}
+
+TEST(LiveDataSnapshot, readerNeverSeesTornImage) {
+	TestImage image;
+	uint8_t generation = 1;
+	ASSERT_TRUE(produce(image, generation));
+
+	uint8_t previous = 0;
+
+	for (int reads = 0; reads < 20; reads++) {
+		const uint8_t *buffer = image.acquire(0, maxAge);
+		ASSERT_NE(nullptr, buffer);
+		uint8_t first = buffer[0];
+		// every read gets a newer image than the one before
+		EXPECT_GT(first, previous);
+		previous = first;
+
+		// producer preempts reader after every byte
+		for (size_t i = 0; i < TestImage::size; i++) {
+			ASSERT_EQ(first, buffer[i]) << "read " << reads << " byte " << i;
+
+			if (produce(image, generation + 1)) {
+				generation++;
+			}
+		}
+
+		image.release(buffer);
+	}
+}
+
+TEST(LiveDataSnapshot, producerSkipsWhileBothHeld) {
+	TestImage image;
+	ASSERT_TRUE(produce(image, 1));
+
+	const uint8_t *slowReader = image.acquire(0, maxAge);
+	ASSERT_TRUE(produce(image, 2));
+	const uint8_t *otherReader = image.acquire(0, maxAge);
+	EXPECT_NE(slowReader, otherReader);
+	uint32_t sequence = image.getSequence();
+
+	// both buffers are held: latest image stays published
+	EXPECT_FALSE(produce(image, 3));
+	EXPECT_EQ(sequence, image.getSequence());
+	EXPECT_EQ(1, slowReader[TestImage::size - 1]);
+	EXPECT_EQ(2, otherReader[TestImage::size - 1]);
+
+	image.release(slowReader);
+	EXPECT_TRUE(produce(image, 3));
+
+	const uint8_t *newReader = image.acquire(0, maxAge);
+	EXPECT_EQ(3, newReader[0]);
+	image.release(newReader);
+	image.release(otherReader);
+}
+
+TEST(LiveDataSnapshot, oneProducerAtATime) {
+	TestImage image;
+
+	uint8_t *buffer = image.beginWrite();
+	ASSERT_NE(nullptr, buffer);
+	// another TS thread finds the image stale at the same time
+	EXPECT_EQ(nullptr, image.beginWrite());
+
+	image.publish(buffer, 0);
+	EXPECT_TRUE(produce(image, 2));
+}
+
+static uint8_t outputBuffer[TS_TOTAL_OUTPUT_SIZE + 16];
+
+class OutputBufferTsChannel : public TsChannelBase {
+public:
+	OutputBufferTsChannel() : TsChannelBase("Test") { }
+
+	void write(const uint8_t* buffer, size_t size, bool) override {
+		memcpy(&outputBuffer[writeIdx], buffer, size);
+		writeIdx += size;
+	}
+
+	size_t readTimeout(uint8_t*, size_t size, int) override {
+		return size;
+	}
+
+	size_t writeIdx = 0;
+};
+
+static int32_t requestDebugIntField5() {
+	OutputBufferTsChannel channel;
+	TunerStudio ts;
+	ts.cmdOutputChannels(&channel, 0, TS_TOTAL_OUTPUT_SIZE);
+	EXPECT_EQ((size_t)TS_TOTAL_OUTPUT_SIZE + 7, channel.writeIdx);
+
+	int32_t value;
+	// size and response code come first
+	memcpy(&value, &outputBuffer[3 + offsetof(output_channels_s, debugIntField5)], sizeof(value));
+	return value;
+}
+
+TEST(LiveDataSnapshot, channelsServedFromSnapshot) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	engine->outputChannels.debugIntField5 = 100;
+	// no snapshot yet: first request takes it
+	EXPECT_EQ(100, requestDebugIntField5());
+
+	engine->outputChannels.debugIntField5 = 200;
+	// all clients get the same sample until it is too old
+	EXPECT_EQ(100, requestDebugIntField5());
+	advanceTimeUs(MS2US(LIVE_DATA_SNAPSHOT_PERIOD_MS) / 2);
+	EXPECT_EQ(100, requestDebugIntField5());
+
+	advanceTimeUs(MS2US(LIVE_DATA_SNAPSHOT_PERIOD_MS));
+	EXPECT_EQ(200, requestDebugIntField5());
+
+	// both buffers held by slow readers: live data
+	LiveDataReader slowReader;
+	advanceTimeUs(2 * MS2US(LIVE_DATA_SNAPSHOT_PERIOD_MS));
+	LiveDataReader otherSlowReader;
+	advanceTimeUs(2 * MS2US(LIVE_DATA_SNAPSHOT_PERIOD_MS));
+	engine->outputChannels.debugIntField5 = 300;
+	EXPECT_EQ(300, requestDebugIntField5());
+}
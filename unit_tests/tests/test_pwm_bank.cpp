@@ -0,0 +1,273 @@
+/*
+ * test_pwm_bank.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "pwm_bank.h"
+
+#define BANK_CHANNELS 6
+
+struct PwmRunResult {
+	int wakeups = 0;
+	int maxQueueDepth = 0;
+	int pinState[BANK_CHANNELS];
+};
+
+static PwmRunResult runSlowPwms(Scheduler *target, TestExecutor &executor, int durationUs) {
+	struct {
+		int startUs;
+		float frequency;
+		float duty;
+	} channels[BANK_CHANNELS] = {
+		// idle/boost/vvt like channels started few microseconds apart
+		{ 0, 100, 0.3 },
+		{ 1, 100, 0.3 },
+		{ 2, 100, 0.5 },
+		{ 3, 100, 0.5 },
+		{ 0, 200, 0.4 },
+		{ 4, 50, 0.25 },
+	};
+
+	OutputPin pins[BANK_CHANNELS];
+	SimplePwm pwms[BANK_CHANNELS];
+
+	for (int i = 0; i < BANK_CHANNELS; i++) {
+		setTimeNowUs(channels[i].startUs);
+		startSimplePwm(&pwms[i], "bank test", target, &pins[i], channels[i].frequency, channels[i].duty);
+	}
+
+	PwmRunResult result;
+	efitick_t endNt = US2NT(durationUs);
+
+	while (executor.getHead() && executor.getHead()->getMomentNt() <= endNt) {
+		efitick_t nextNt = executor.getHead()->getMomentNt();
+		setTimeNowNt(nextNt);
+		if (executor.executeAllNt(nextNt) > 0) {
+			// one timer interrupt on real hardware
+			result.wakeups++;
+		}
+		result.maxQueueDepth = std::max(result.maxQueueDepth, executor.size());
+	}
+
+	for (int i = 0; i < BANK_CHANNELS; i++) {
+		result.pinState[i] = pins[i].currentLogicValue;
+		target->cancel(&pwms[i].scheduling);
+	}
+	executor.clear();
+
+	return result;
+}
+
+TEST(PwmBank, singleQueueEntryAndFewerWakeups) {
+	// mid-period so that no edge is within merge window of the end
+	int durationUs = 100'500;
+
+	TestExecutor directExecutor;
+	PwmRunResult direct = runSlowPwms(&directExecutor, directExecutor, durationUs);
+
+	TestExecutor executor;
+	PwmBank bank;
+	bank.setExecutor(&executor);
+	PwmRunResult banked = runSlowPwms(&bank, executor, durationUs);
+
+	printf("PWM bank: queue depth %d -> %d, wakeups %d -> %d, max edges per pass %d\n",
+		direct.maxQueueDepth, banked.maxQueueDepth,
+		direct.wakeups, banked.wakeups,
+		(int)bank.maxEdgesPerPass);
+
+	// every channel keeps own entry in the main queue without the bank
+	EXPECT_EQ(BANK_CHANNELS, direct.maxQueueDepth);
+	// bank holds single slot
+	EXPECT_EQ(1, banked.maxQueueDepth);
+	// edges microseconds apart are applied in one pass
+	EXPECT_TRUE(banked.wakeups < direct.wakeups);
+	EXPECT_EQ((uint32_t)banked.wakeups, bank.bankCallbackCounter);
+	EXPECT_TRUE(bank.maxEdgesPerPass > 1);
+
+	// outputs end up in the same state
+	for (int i = 0; i < BANK_CHANNELS; i++) {
+		EXPECT_EQ(direct.pinState[i], banked.pinState[i]) << "channel " << i;
+	}
+}
+
+static int bankTestCounter;
+static void bankTestAction(int increment) {
+	bankTestCounter += increment;
+}
+
+TEST(PwmBank, cancelAndReorder) {
+	setTimeNowUs(0);
+	bankTestCounter = 0;
+
+	TestExecutor executor;
+	PwmBank bank(0);
+	bank.setExecutor(&executor);
+
+	scheduling_s a, b, c;
+	bank.schedule("a", &a, US2NT(300), action_s::make<bankTestAction>(1));
+	bank.schedule("b", &b, US2NT(200), action_s::make<bankTestAction>(10));
+	bank.schedule("c", &c, US2NT(100), action_s::make<bankTestAction>(100));
+	EXPECT_EQ(3, bank.size());
+	ASSERT_EQ(1, executor.size());
+	EXPECT_EQ(100, executor.getHead()->getMomentUs());
+
+	// cancel head, bank slot moves to the new head
+	bank.cancel(&c);
+	EXPECT_EQ(2, bank.size());
+	ASSERT_EQ(1, executor.size());
+	EXPECT_EQ(200, executor.getHead()->getMomentUs());
+
+	setTimeNowUs(100);
+	executor.executeAll(100);
+	EXPECT_EQ(0, bankTestCounter);
+	ASSERT_EQ(1, executor.size());
+	EXPECT_EQ(200, executor.getHead()->getMomentUs());
+
+	setTimeNowUs(300);
+	executor.executeAll(300);
+	EXPECT_EQ(11, bankTestCounter);
+	EXPECT_EQ(0, bank.size());
+	EXPECT_EQ(0, executor.size());
+}
+
+static int earlyEdgeCounter;
+static int appliedEdgeCounter;
+static void bankTimingAction(scheduling_s *scheduling) {
+	appliedEdgeCounter++;
+	if (getTimeNowNt() < scheduling->getMomentNt()) {
+		earlyEdgeCounter++;
+	}
+}
+
+TEST(PwmBank, neverAppliedBeforeEdge) {
+	setTimeNowUs(0);
+	earlyEdgeCounter = 0;
+	appliedEdgeCounter = 0;
+
+	TestExecutor executor;
+	PwmBank bank(US2NT(5));
+	bank.setExecutor(&executor);
+
+	scheduling_s a, b, c;
+	bank.schedule("a", &a, US2NT(100), action_s::make<bankTimingAction>(&a));
+	bank.schedule("b", &b, US2NT(103), action_s::make<bankTimingAction>(&b));
+	bank.schedule("c", &c, US2NT(110), action_s::make<bankTimingAction>(&c));
+
+	// 'a' and 'b' are merged at the moment of the later one
+	ASSERT_EQ(1, executor.size());
+	EXPECT_EQ(103, executor.getHead()->getMomentUs());
+
+	setTimeNowUs(103);
+	executor.executeAll(103);
+	EXPECT_EQ(2, appliedEdgeCounter);
+	EXPECT_EQ(1, bank.size());
+	ASSERT_EQ(1, executor.size());
+	EXPECT_EQ(110, executor.getHead()->getMomentUs());
+
+	// edge joining the cluster of the head moves the slot later
+	bank.schedule("a", &a, US2NT(111), action_s::make<bankTimingAction>(&a));
+	ASSERT_EQ(1, executor.size());
+	EXPECT_EQ(111, executor.getHead()->getMomentUs());
+
+	// edge outside of the cluster does not
+	bank.schedule("b", &b, US2NT(120), action_s::make<bankTimingAction>(&b));
+	EXPECT_EQ(111, executor.getHead()->getMomentUs());
+
+	setTimeNowUs(111);
+	executor.executeAll(111);
+	EXPECT_EQ(4, appliedEdgeCounter);
+	EXPECT_EQ(1, bank.size());
+	EXPECT_EQ(120, executor.getHead()->getMomentUs());
+
+	// slot firing late applies what is due and nothing ahead of its moment
+	bank.schedule("c", &c, US2NT(130), action_s::make<bankTimingAction>(&c));
+	setTimeNowUs(125);
+	executor.executeAll(125);
+	EXPECT_EQ(5, appliedEdgeCounter);
+	EXPECT_EQ(1, bank.size());
+	EXPECT_EQ(130, executor.getHead()->getMomentUs());
+
+	setTimeNowUs(130);
+	executor.executeAll(130);
+	EXPECT_EQ(6, appliedEdgeCounter);
+	EXPECT_EQ(0, earlyEdgeCounter);
+}
+
+TEST(PwmBank, slowChannelEdgesNotEarly) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setTimeNowUs(0);
+
+	OutputPin pins[2];
+	SimplePwm pwms[2];
+	startSimplePwm(&pwms[0], "slow1", &engine->scheduler, &pins[0], 100, 0.5);
+	setTimeNowUs(3);
+	startSimplePwm(&pwms[1], "slow2", &engine->scheduler, &pins[1], 100, 0.25);
+
+	// both channels are driven by the bank through single main queue entry
+	EXPECT_EQ(&engine->pwmBank, pwms[0].m_executor);
+	EXPECT_EQ(&engine->pwmBank, pwms[1].m_executor);
+	EXPECT_EQ(1, engine->scheduler.size());
+	EXPECT_EQ(2, engine->pwmBank.size());
+
+	efitick_t endNt = MS2NT(50);
+	while (engine->scheduler.getHead() && engine->scheduler.getHead()->getMomentNt() <= endNt) {
+		efitick_t nextNt = engine->scheduler.getHead()->getMomentNt();
+		efitick_t pendingNt[2];
+		for (int i = 0; i < 2; i++) {
+			pendingNt[i] = pwms[i].scheduling.getMomentNt();
+		}
+
+		setTimeNowNt(nextNt);
+		engine->scheduler.executeAllNt(nextNt);
+
+		for (int i = 0; i < 2; i++) {
+			if (pwms[i].scheduling.getMomentNt() != pendingNt[i]) {
+				// edge was applied in this pass: not ahead of its moment and by at most merge window late
+				EXPECT_TRUE(pendingNt[i] <= nextNt) << "channel " << i;
+				EXPECT_TRUE(nextNt - pendingNt[i] <= US2NT(PWM_BANK_MERGE_WINDOW_US)) << "channel " << i;
+			}
+			EXPECT_TRUE(pwms[i].scheduling.getMomentNt() > nextNt) << "channel " << i;
+		}
+	}
+
+	EXPECT_TRUE(engine->pwmBank.maxEdgesPerPass > 1);
+
+	for (int i = 0; i < 2; i++) {
+		engine->pwmBank.cancel(&pwms[i].scheduling);
+	}
+	engine->scheduler.clear();
+}
+
+TEST(PwmBank, frequencyChangeMovesChannel) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	setTimeNowUs(0);
+
+	OutputPin pin;
+	SimplePwm pwm;
+	startSimplePwm(&pwm, "gppwm", &engine->scheduler, &pin, 100, 0.5);
+	EXPECT_EQ(&engine->pwmBank, pwm.m_executor);
+	EXPECT_EQ(1, engine->pwmBank.size());
+
+	// new frequency takes effect on the next edge
+	pwm.setFrequency(5000);
+	efitick_t nextNt = engine->scheduler.getHead()->getMomentNt();
+	setTimeNowNt(nextNt);
+	engine->scheduler.executeAllNt(nextNt);
+	EXPECT_EQ(&engine->scheduler, pwm.m_executor);
+	EXPECT_EQ(0, engine->pwmBank.size());
+	EXPECT_EQ(1, engine->scheduler.size());
+	EXPECT_EQ(&pwm.scheduling, engine->scheduler.getHead());
+
+	pwm.setFrequency(100);
+	nextNt = engine->scheduler.getHead()->getMomentNt();
+	setTimeNowNt(nextNt);
+	engine->scheduler.executeAllNt(nextNt);
+	EXPECT_EQ(&engine->pwmBank, pwm.m_executor);
+	EXPECT_EQ(1, engine->pwmBank.size());
+
+	engine->pwmBank.cancel(&pwm.scheduling);
+	engine->scheduler.clear();
+}
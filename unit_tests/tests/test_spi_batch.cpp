@@ -0,0 +1,143 @@
+/**
+ * @file	test_spi_batch.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "gpio/spi_batch.h"
+
+struct MockSpiBus : public SpiBatchBus {
+	void acquire() override {
+		EXPECT_FALSE(acquired);
+		acquired = true;
+		acquireCount++;
+	}
+
+	void release() override {
+		EXPECT_TRUE(acquired);
+		acquired = false;
+	}
+
+	// 16 bit frames in wire order, one chip select each
+	void exchange(int chip, uint16_t frame) {
+		EXPECT_TRUE(acquired);
+		wire.push_back({ chip, frame });
+		// each frame takes few microseconds on the wire
+		advanceTimeUs(4);
+	}
+
+	bool acquired = false;
+	int acquireCount = 0;
+	std::vector<std::pair<int, uint16_t>> wire;
+};
+
+// output register image sent as two byte-wide frames, like TLE6240
+struct MockSmartChip : public SpiBatchClient {
+	MockSmartChip(MockSpiBus &p_bus, int p_index)
+		: bus(p_bus)
+		, index(p_index)
+	{
+	}
+
+	int writePad(size_t pin, int value) {
+		if (value) {
+			state |= (1 << pin);
+		} else {
+			state &= ~(1 << pin);
+		}
+		return engine->request(id);
+	}
+
+	int flushOutputs() override {
+		bus.exchange(index, state & 0xff);
+		bus.exchange(index, state >> 8);
+		sent = state;
+		return 0;
+	}
+
+	MockSpiBus &bus;
+	const int index;
+	SpiBatchEngine *engine = nullptr;
+	int id = -1;
+	uint16_t state = 0;
+	uint16_t sent = 0;
+};
+
+TEST(SpiBatch, coalescesWritesAcrossChips) {
+	setTimeNowUs(1000);
+
+	MockSpiBus bus;
+	SpiBatchEngine engine(&bus);
+	MockSmartChip chipA(bus, 0);
+	MockSmartChip chipB(bus, 1);
+
+	chipA.engine = chipB.engine = &engine;
+	chipA.id = engine.addClient(&chipA);
+	chipB.id = engine.addClient(&chipB);
+	ASSERT_EQ(0, chipA.id);
+	ASSERT_EQ(1, chipB.id);
+
+	// only the first write wakes engine up
+	EXPECT_TRUE(chipA.writePad(0, 1));
+	advanceTimeUs(10);
+	EXPECT_FALSE(chipA.writePad(9, 1));
+	EXPECT_FALSE(chipB.writePad(3, 1));
+	EXPECT_FALSE(chipA.writePad(0, 0));
+	EXPECT_TRUE(engine.hasPending());
+
+	advanceTimeUs(50);
+	EXPECT_EQ(2, engine.flush());
+	EXPECT_FALSE(engine.hasPending());
+
+	// one bus transaction carrying final state of both chips, two frames each
+	EXPECT_EQ(1, bus.acquireCount);
+	ASSERT_EQ(4u, bus.wire.size());
+	EXPECT_EQ(0, bus.wire[0].first);
+	EXPECT_EQ(0x00, bus.wire[0].second);
+	EXPECT_EQ(0x02, bus.wire[1].second);
+	EXPECT_EQ(1, bus.wire[2].first);
+	EXPECT_EQ(0x08, bus.wire[2].second);
+	EXPECT_EQ(0x00, bus.wire[3].second);
+	EXPECT_EQ(0x0200, chipA.sent);
+	EXPECT_EQ(0x0008, chipB.sent);
+
+	EXPECT_EQ(2u, engine.requestCounter);
+	EXPECT_EQ(2u, engine.coalescedCounter);
+	EXPECT_EQ(1u, engine.flushCounter);
+	EXPECT_EQ(2u, engine.clientFlushCounter);
+
+	// latency is measured from the first request of each chip to its last frame
+	EXPECT_EQ(US2NT(10 + 50 + 8), engine.maxLatencyNt);
+	EXPECT_EQ(US2NT(50 + 16), engine.lastLatencyNt);
+	EXPECT_EQ(US2NT(68 + 66), engine.totalLatencyNt);
+
+	// nothing pending - bus is not touched
+	EXPECT_EQ(0, engine.flush());
+	EXPECT_EQ(1, bus.acquireCount);
+}
+
+TEST(SpiBatch, requestAllAndClientLimit) {
+	setTimeNowUs(0);
+
+	MockSpiBus bus;
+	SpiBatchEngine engine(&bus);
+
+	std::vector<std::unique_ptr<MockSmartChip>> chips;
+	for (int i = 0; i < SPI_BATCH_MAX_CLIENTS; i++) {
+		chips.emplace_back(std::make_unique<MockSmartChip>(bus, i));
+		EXPECT_EQ(i, engine.addClient(chips.back().get()));
+	}
+
+	MockSmartChip extra(bus, SPI_BATCH_MAX_CLIENTS);
+	EXPECT_EQ(-1, engine.addClient(&extra));
+	EXPECT_FALSE(engine.request(-1));
+	EXPECT_FALSE(engine.request(SPI_BATCH_MAX_CLIENTS));
+
+	// periodic diagnostic refresh polls every chip in one transaction
+	EXPECT_TRUE(engine.requestAll());
+	EXPECT_EQ(SPI_BATCH_MAX_CLIENTS, engine.flush());
+	EXPECT_EQ(1, bus.acquireCount);
+	EXPECT_EQ(2u * SPI_BATCH_MAX_CLIENTS, bus.wire.size());
+}
@@ -117,3 +117,66 @@ TEST(ThrottleModel, BigEngineSmallThrottle) {
 	EXPECT_NEAR(343.4, model.estimateThrottleFlow(100, 100, 95, 0), 1e-1);
 	// ^   part throttle model   ^
 }
+
+TEST(ThrottleModel, InverseTableMatchesSolver) {
+	MockThrottleModel model;
+
+	for (float pr : { 0.3f, 0.6f, 0.9f, 0.97f }) {
+		for (float iat : { -20.0f, 0.0f, 60.0f }) {
+			for (float flow = 0.5; flow < 900; flow *= 1.1f) {
+				float solver = model.throttlePositionForFlowSolver(flow, pr, 100, iat);
+				float table = model.throttlePositionForFlow(flow, pr, 100, iat);
+
+				// solver itself only converges to 0.1 degree
+				EXPECT_NEAR(solver, table, 0.05) << "flow " << flow << " pr " << pr << " iat " << iat;
+			}
+		}
+	}
+}
+
+class NonMonotonicThrottleModel : public MockThrottleModel {
+public:
+	float effectiveArea(float tps) const override {
+		// dips between 40 and 60
+		return tps > 40 && tps < 60 ? MockThrottleModel::effectiveArea(40) : MockThrottleModel::effectiveArea(tps);
+	}
+};
+
+TEST(ThrottleModel, InverseTableEdges) {
+	NonMonotonicThrottleModel model;
+
+	// below the smallest area throttle is closed
+	EXPECT_EQ(0, model.throttlePositionForFlow(0.01, 0.3, 100, 0));
+	// flat part of the curve resolves to lowest position
+	float flatFlow = model.partThrottleFlow(50, 0.3, 100, 0);
+	EXPECT_NEAR(40, model.throttlePositionForFlow(flatFlow, 0.3, 100, 0), 1e-3);
+	// above flat part
+	EXPECT_NEAR(70, model.throttlePositionForFlow(model.partThrottleFlow(70, 0.3, 100, 0), 0.3, 100, 0), 1e-3);
+	EXPECT_EQ(100, model.throttlePositionForFlow(1000, 0.3, 100, 0));
+}
+
+TEST(ThrottleModel, InverseTableRebuiltOnConfigurationChange) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	ThrottleModel& model = engine->module<ThrottleModel>().unmock();
+
+	size_t size = efi::size(config->throttleEstimateEffectiveAreaValues);
+	for (size_t i = 0; i < size; i++) {
+		float x = i / (size - 1.0f);
+		config->throttleEstimateEffectiveAreaValues[i] = 500 * x * x;
+	}
+	model.onConfigurationChange(engineConfiguration);
+	float before = model.throttlePositionForFlow(50, 0.5, 100, 20);
+
+	// twice the area at every position, same flow needs less throttle
+	for (size_t i = 0; i < size; i++) {
+		float x = i / (size - 1.0f);
+		config->throttleEstimateEffectiveAreaValues[i] = 1000 * x * x;
+	}
+	// still using previous table
+	EXPECT_EQ(before, model.throttlePositionForFlow(50, 0.5, 100, 20));
+
+	model.onConfigurationChange(engineConfiguration);
+	float after = model.throttlePositionForFlow(50, 0.5, 100, 20);
+	EXPECT_LT(after, before);
+	EXPECT_NEAR(model.throttlePositionForFlowSolver(50, 0.5, 100, 20), after, 0.5);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file test_tooth_log_compact.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "tooth_log_compact.h"
+
+struct CompactEntry {
+	uint32_t timestampUs;
+	uint8_t channels;
+};
+
+static std::vector<CompactEntry> decodeAll(const uint8_t *data, size_t size) {
+	std::vector<CompactEntry> result;
+	ToothLogCompactDecoder decoder;
+
+	size_t idx = 0;
+	while (idx < size) {
+		CompactEntry entry;
+		size_t consumed = decoder.decode(&data[idx], size - idx, entry.timestampUs, entry.channels);
+		EXPECT_NE(0u, consumed) << "offset " << idx;
+		if (consumed == 0) {
+			break;
+		}
+		idx += consumed;
+		result.push_back(entry);
+	}
+
+	return result;
+}
+
+TEST(ToothLogCompact, roundTrip) {
+	std::vector<CompactEntry> entries = {
+		{ 1'000'000, TOOTH_LOG_COMPACT_PRI | TOOTH_LOG_COMPACT_SYNC },
+		// same channels
+		{ 1'000'100, TOOTH_LOG_COMPACT_PRI | TOOTH_LOG_COMPACT_SYNC },
+		// primary toggle only
+		{ 1'000'200, TOOTH_LOG_COMPACT_SYNC },
+		// several channels change
+		{ 1'000'250, TOOTH_LOG_COMPACT_SEC | TOOTH_LOG_COMPACT_COIL | TOOTH_LOG_COMPACT_INJECTOR },
+		// long gap needs multi-byte varint
+		{ 1'900'000, TOOTH_LOG_COMPACT_TRIGGER },
+		// timer wrap around
+		{ 0xFFFF'FFF0, TOOTH_LOG_COMPACT_PRI },
+		{ 0x0000'0010, 0 },
+	};
+
+	uint8_t data[256];
+	size_t size = 0;
+	ToothLogCompactEncoder encoder;
+
+	for (const auto& entry : entries) {
+		size_t written = encoder.encode(&data[size], sizeof(data) - size, entry.timestampUs, entry.channels);
+		ASSERT_NE(0u, written);
+		ASSERT_TRUE(written <= TOOTH_LOG_COMPACT_MAX_RECORD);
+		size += written;
+	}
+
+	// resync record carries absolute time
+	EXPECT_EQ(TOOTH_LOG_COMPACT_HEADER_CHANNELS, data[0]);
+	EXPECT_EQ(TOOTH_LOG_COMPACT_RESYNC | TOOTH_LOG_COMPACT_PRI | TOOTH_LOG_COMPACT_SYNC, data[1]);
+	// 100us delta, nothing changed
+	EXPECT_EQ(100u << 2, (data[6] & 0x7F) | (data[7] << 7));
+	EXPECT_EQ(26u, size);
+
+	auto decoded = decodeAll(data, size);
+	ASSERT_EQ(entries.size(), decoded.size());
+	for (size_t i = 0; i < entries.size(); i++) {
+		EXPECT_EQ(entries[i].timestampUs, decoded[i].timestampUs) << "entry " << i;
+		EXPECT_EQ(entries[i].channels, decoded[i].channels) << "entry " << i;
+	}
+}
+
+TEST(ToothLogCompact, noSpaceLeavesStateUntouched) {
+	ToothLogCompactEncoder encoder;
+	uint8_t data[16];
+
+	// resync record is six bytes
+	EXPECT_EQ(0u, encoder.encode(data, 5, 1000, TOOTH_LOG_COMPACT_PRI));
+	EXPECT_EQ(6u, encoder.encode(data, 6, 1000, TOOTH_LOG_COMPACT_PRI));
+	EXPECT_EQ(0u, encoder.encode(&data[6], 0, 1010, 0));
+	EXPECT_EQ(1u, encoder.encode(&data[6], 1, 1010, 0));
+
+	auto decoded = decodeAll(data, 7);
+	ASSERT_EQ(2u, decoded.size());
+	EXPECT_EQ(1010u, decoded[1].timestampUs);
+	EXPECT_EQ(0, decoded[1].channels);
+}
+
+TEST(ToothLogCompact, decoderNeedsResync) {
+	ToothLogCompactDecoder decoder;
+	uint32_t timestampUs;
+	uint8_t channels;
+
+	// delta record without preceding absolute timestamp
+	uint8_t delta[] = { 10 << 2 };
+	EXPECT_EQ(0u, decoder.decode(delta, sizeof(delta), timestampUs, channels));
+
+	// truncated resync record
+	uint8_t truncated[] = { TOOTH_LOG_COMPACT_HEADER_CHANNELS, TOOTH_LOG_COMPACT_RESYNC, 0x10, 0x27 };
+	EXPECT_EQ(0u, decoder.decode(truncated, sizeof(truncated), timestampUs, channels));
+}
+
+TEST(ToothLogCompact, concatenatedBuffers) {
+	uint8_t data[64];
+	size_t size = 0;
+
+	ToothLogCompactEncoder encoder;
+	size += encoder.encode(&data[size], sizeof(data) - size, 500, TOOTH_LOG_COMPACT_PRI);
+	size += encoder.encode(&data[size], sizeof(data) - size, 600, 0);
+	// new buffer
+	encoder.reset();
+	size += encoder.encode(&data[size], sizeof(data) - size, 700, TOOTH_LOG_COMPACT_PRI);
+
+	auto decoded = decodeAll(data, size);
+	ASSERT_EQ(3u, decoded.size());
+	EXPECT_EQ(700u, decoded[2].timestampUs);
+	EXPECT_EQ(TOOTH_LOG_COMPACT_PRI, decoded[2].channels);
+}
+
+TEST(ToothLogCompact, sixtyMinusTwoAtRedline) {
+	// 8000 rpm, 60-2 crank wheel, both edges logged, cam tooth once per cycle
+	constexpr uint32_t toothUs = 1'000'000 / (8000 / 60) / 60;
+	constexpr size_t bufferBytes = toothLoggerEntriesPerBuffer * sizeof(composite_logger_s);
+
+	uint8_t data[bufferBytes];
+	size_t size = 0;
+	size_t records = 0;
+
+	ToothLogCompactEncoder encoder;
+	uint32_t nowUs = 0;
+	uint8_t channels = TOOTH_LOG_COMPACT_SYNC;
+
+	while (bufferBytes - size >= TOOTH_LOG_COMPACT_MAX_RECORD) {
+		size_t tooth = (records / 2) % 58;
+		nowUs += (tooth == 0 && (records % 2) == 0) ? 3 * toothUs / 2 : toothUs / 2;
+
+		channels ^= TOOTH_LOG_COMPACT_PRI;
+		if ((records % 232) == 0) {
+			channels ^= TOOTH_LOG_COMPACT_SEC;
+		}
+
+		size += encoder.encode(&data[size], bufferBytes - size, nowUs, channels);
+		records++;
+	}
+
+	// same buffer used to hold toothLoggerEntriesPerBuffer fixed size records
+	EXPECT_TRUE(records >= 2 * toothLoggerEntriesPerBuffer) << records;
+	EXPECT_EQ(records, decodeAll(data, size).size());
+}
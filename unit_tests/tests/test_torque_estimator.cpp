@@ -0,0 +1,79 @@
+/**
+ * @file test_torque_estimator.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "torque_estimator.h"
+
+static void fillRandomVe() {
+	srand(42);
+	for (size_t load = 0; load < VE_LOAD_COUNT; load++) {
+		for (size_t rpm = 0; rpm < VE_RPM_COUNT; rpm++) {
+			config->veTable[load][rpm] = 20 + (rand() % 1000) * 0.1f;
+		}
+	}
+}
+
+// one interpolate3d per cell, the way estimateTorqueTable used to do it
+static float estimateTorqueReference(size_t loadIndex, size_t rpmIndex) {
+	float rpmValue = config->torqueRpmBins[rpmIndex];
+	float mapValue = config->torqueLoadBins[loadIndex];
+
+	percent_t veValue = interpolate3d(
+		config->veTable,
+		config->veLoadBins, mapValue,
+		config->veRpmBins, rpmValue
+	);
+	return engineConfiguration->referenceTorqueForGenerator
+		* veValue / engineConfiguration->referenceVeForGenerator
+		* mapValue / engineConfiguration->referenceMapForGenerator;
+}
+
+TEST(TorqueEstimator, gridMatchesInterpolate3d) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	fillRandomVe();
+
+	// on bins, between bins and off both ends of the table
+	float rpms[] = { 0, 650, 1234.5f, 3000, 5555, 7000, 20000 };
+	float loads[] = { 5, 30, 47.3f, 100, 180, 400 };
+
+	float grid[efi::size(loads)][efi::size(rpms)];
+	interpolate3dGrid(grid, config->veTable, config->veLoadBins, loads, config->veRpmBins, rpms);
+
+	for (size_t i = 0; i < efi::size(loads); i++) {
+		for (size_t j = 0; j < efi::size(rpms); j++) {
+			float expected = interpolate3d(config->veTable, config->veLoadBins, loads[i], config->veRpmBins, rpms[j]);
+			// exact, not near
+			EXPECT_EQ(expected, grid[i][j]) << loads[i] << " " << rpms[j];
+		}
+	}
+}
+
+TEST(TorqueEstimator, tableMatchesPerCell) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	fillRandomVe();
+
+	engineConfiguration->referenceTorqueForGenerator = 250;
+	engineConfiguration->referenceVeForGenerator = 90;
+	engineConfiguration->referenceMapForGenerator = 100;
+	for (size_t i = 0; i < TORQUE_CURVE_RPM_SIZE; i++) {
+		config->torqueRpmBins[i] = 900 + 1130 * i;
+	}
+	for (size_t i = 0; i < TORQUE_CURVE_SIZE; i++) {
+		config->torqueLoadBins[i] = 25 + 37 * i;
+	}
+
+	estimateTorqueTable();
+
+	for (size_t load = 0; load < TORQUE_CURVE_SIZE; load++) {
+		for (size_t rpm = 0; rpm < TORQUE_CURVE_RPM_SIZE; rpm++) {
+			// same rounding into the stored type
+			std::remove_reference_t<decltype(config->torqueTable[0][0])> expected;
+			expected = estimateTorqueReference(load, rpm);
+			EXPECT_EQ((float)expected, (float)config->torqueTable[load][rpm]) << load << " " << rpm;
+		}
+	}
+}
@@ -0,0 +1,119 @@
+/**
+ * @file test_trigger_scope_envelope.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "trigger_scope_envelope.h"
+
+#include <vector>
+
+// interleaved like the ADC writes it: ch1 ramps, ch2 is a square wave
+static std::vector<uint8_t> makeFrames(size_t frameCount) {
+	std::vector<uint8_t> frames;
+	for (size_t i = 0; i < frameCount; i++) {
+		frames.push_back(i % 200);
+		frames.push_back((i / 8) % 2 ? 250 : 10);
+	}
+	return frames;
+}
+
+TEST(TriggerScopeEnvelope, minMaxMean) {
+	std::vector<uint8_t> frames = makeFrames(64);
+	uint8_t output[4 * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE];
+
+	TriggerScopeEnvelope envelope;
+	envelope.start(output, sizeof(output), 16);
+	EXPECT_EQ(64u, envelope.getFramesToFill());
+	EXPECT_TRUE(envelope.feed(frames.data(), 64));
+	ASSERT_EQ(sizeof(output), envelope.getSize());
+
+	for (int record = 0; record < 4; record++) {
+		const uint8_t *r = output + record * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE;
+		int first = record * 16;
+		// ramp
+		EXPECT_EQ(first, r[0]);
+		EXPECT_EQ(first + 15, r[1]);
+		// (2 * first + 15) / 2 rounded
+		EXPECT_EQ(first + 8, r[2]);
+		// two full periods of the square wave
+		EXPECT_EQ(10, r[3]);
+		EXPECT_EQ(250, r[4]);
+		EXPECT_EQ(130, r[5]);
+	}
+}
+
+TEST(TriggerScopeEnvelope, chunksSameAsWhole) {
+	std::vector<uint8_t> frames = makeFrames(1000);
+	uint8_t whole[200 * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE];
+	uint8_t chunked[200 * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE];
+
+	TriggerScopeEnvelope envelope;
+	envelope.start(whole, sizeof(whole), 7);
+	EXPECT_FALSE(envelope.feed(frames.data(), 1000));
+	// 142 complete records, six frames into the next one
+	size_t wholeSize = envelope.getSize();
+	EXPECT_EQ(142u * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE, wholeSize);
+
+	// odd chunk sizes split records anywhere
+	envelope.start(chunked, sizeof(chunked), 7);
+	size_t position = 0;
+	for (size_t chunk = 1; position < 1000; chunk = chunk * 3 % 37 + 1) {
+		size_t count = std::min(chunk, 1000 - position);
+		envelope.feed(frames.data() + position * TRIGGER_SCOPE_CHANNEL_COUNT, count);
+		position += count;
+	}
+
+	ASSERT_EQ(wholeSize, envelope.getSize());
+	EXPECT_EQ(0, memcmp(whole, chunked, wholeSize));
+	EXPECT_EQ((200u - 142) * 7 - 6, envelope.getFramesToFill());
+}
+
+TEST(TriggerScopeEnvelope, stopsWhenFull) {
+	std::vector<uint8_t> frames = makeFrames(100);
+	// room for two records plus a partial one which is never written
+	uint8_t output[2 * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE + 4];
+	memset(output, 0xAA, sizeof(output));
+
+	TriggerScopeEnvelope envelope;
+	envelope.start(output, sizeof(output), 10);
+	EXPECT_EQ(20u, envelope.getFramesToFill());
+
+	EXPECT_FALSE(envelope.feed(frames.data(), 15));
+	EXPECT_EQ(5u, envelope.getFramesToFill());
+	EXPECT_TRUE(envelope.feed(frames.data() + 15 * TRIGGER_SCOPE_CHANNEL_COUNT, 85));
+	EXPECT_TRUE(envelope.isFull());
+	EXPECT_EQ(0u, envelope.getFramesToFill());
+	EXPECT_EQ(2u * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE, envelope.getSize());
+
+	// tail untouched
+	for (size_t i = 2 * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE; i < sizeof(output); i++) {
+		EXPECT_EQ(0xAA, output[i]);
+	}
+
+	EXPECT_TRUE(envelope.feed(frames.data(), 10));
+	EXPECT_EQ(2u * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE, envelope.getSize());
+}
+
+TEST(TriggerScopeEnvelope, noDecimation) {
+	std::vector<uint8_t> frames = makeFrames(20);
+	uint8_t output[20 * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE];
+
+	TriggerScopeEnvelope envelope;
+	// zero is taken as one
+	envelope.start(output, sizeof(output), 0);
+	EXPECT_EQ(1, envelope.getSamplesPerRecord());
+	EXPECT_TRUE(envelope.feed(frames.data(), 20));
+
+	for (int i = 0; i < 20; i++) {
+		for (int ch = 0; ch < TRIGGER_SCOPE_CHANNEL_COUNT; ch++) {
+			const uint8_t *r = output + i * TRIGGER_SCOPE_ENVELOPE_RECORD_SIZE + 3 * ch;
+			uint8_t sample = frames[i * TRIGGER_SCOPE_CHANNEL_COUNT + ch];
+			EXPECT_EQ(sample, r[0]);
+			EXPECT_EQ(sample, r[1]);
+			EXPECT_EQ(sample, r[2]);
+		}
+	}
+}
@@ -0,0 +1,91 @@
+/**
+ * @file test_ts_output_delta.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "ts_output_delta.h"
+
+static size_t encode(uint8_t *shadow, const uint8_t *current, size_t size, uint8_t *out, size_t space, bool *overflow = nullptr) {
+	TsOutputDeltaEncoder encoder(out, space);
+	// odd part size to cross run boundaries
+	for (size_t position = 0; position < size; position += 7) {
+		encoder.update(shadow + position, current + position, std::min<size_t>(7, size - position));
+	}
+	if (overflow) {
+		*overflow = encoder.isOverflow();
+	}
+	return encoder.size();
+}
+
+TEST(TsOutputDelta, roundTrip) {
+	uint8_t previous[100] = {};
+	uint8_t shadow[100] = {};
+	uint8_t current[100] = {};
+	current[3] = 1;
+	current[4] = 2;
+	current[50] = 3;
+	current[99] = 4;
+
+	uint8_t runs[100];
+	size_t size = encode(shadow, current, sizeof(current), runs, sizeof(runs));
+	// three runs: two bytes at 3, one byte at 50, one byte at 99
+	EXPECT_EQ(3u * 2 + 4, size);
+	EXPECT_EQ(0, memcmp(shadow, current, sizeof(current)));
+
+	ASSERT_TRUE(tsOutputDeltaApply(previous, sizeof(previous), runs, size));
+	EXPECT_EQ(0, memcmp(previous, current, sizeof(current)));
+
+	// nothing changed: nothing to send
+	EXPECT_EQ(0u, encode(shadow, current, sizeof(current), runs, sizeof(runs)));
+}
+
+TEST(TsOutputDelta, longGapAndLongRun) {
+	static uint8_t previous[1000];
+	static uint8_t shadow[1000];
+	static uint8_t current[1000];
+	memset(previous, 0, sizeof(previous));
+	memset(shadow, 0, sizeof(shadow));
+	memset(current, 0, sizeof(current));
+
+	// gap does not fit into skip byte
+	current[600] = 1;
+	// run does not fit into length byte
+	for (size_t i = 700; i < 1000; i++) {
+		current[i] = i;
+	}
+
+	static uint8_t runs[1000];
+	size_t size = encode(shadow, current, sizeof(current), runs, sizeof(runs));
+	EXPECT_LT(size, sizeof(current));
+
+	ASSERT_TRUE(tsOutputDeltaApply(previous, sizeof(previous), runs, size));
+	EXPECT_EQ(0, memcmp(previous, current, sizeof(current)));
+}
+
+TEST(TsOutputDelta, overflow) {
+	uint8_t shadow[100] = {};
+	uint8_t current[100];
+	for (size_t i = 0; i < sizeof(current); i++) {
+		// every other byte changed is the worst case
+		current[i] = i % 2;
+	}
+
+	uint8_t runs[100];
+	bool overflow = false;
+	encode(shadow, current, sizeof(current), runs, sizeof(runs), &overflow);
+	EXPECT_TRUE(overflow);
+	// shadow is updated anyway, so it can be sent as full frame
+	EXPECT_EQ(0, memcmp(shadow, current, sizeof(current)));
+}
+
+TEST(TsOutputDelta, applyRejectsOutOfBounds) {
+	uint8_t image[10] = {};
+	const uint8_t beyondImage[] = { 9, 2, 1, 1 };
+	EXPECT_FALSE(tsOutputDeltaApply(image, sizeof(image), beyondImage, sizeof(beyondImage)));
+
+	const uint8_t truncated[] = { 0, 3, 1 };
+	EXPECT_FALSE(tsOutputDeltaApply(image, sizeof(image), truncated, sizeof(truncated)));
+}
@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "tunerstudio.h"
 #include "tunerstudio_io.h"
+#include "tunerstudio_impl.h"
+#include "ts_output_delta.h"
+#include "live_data_snapshot.h"
+#include "long_term_fuel_trim.h"
 
 static uint8_t st5TestBuffer[16000];
 
@@ -136,3 +140,149 @@ TEST(TunerstudioCommands, outOfRangeWriteChunkSendsExactlyOneError) {
 
 	EXPECT_EQ(tsState.errorOutOfRange - prevErrors, 1);
 }
+
+static uint32_t requestSettingsPageCrc(TunerStudio &ts) {
+	BufferTsChannel channel;
+	ts.handleCrc32Check(&channel, TS_PAGE_SETTINGS, 0, TOTAL_CONFIG_SIZE);
+	EXPECT_EQ(4u + 7, channel.writeIdx);
+
+	uint32_t crc;
+	memcpy(&crc, &st5TestBuffer[3], sizeof(crc));
+	return SWAP_UINT32(crc);
+}
+
+TEST(TunerstudioCommands, settingsPageCrcFollowsWrites) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	::testing::NiceMock<MockTsChannel> channel;
+	TunerStudio ts;
+	const uint8_t *page = reinterpret_cast<const uint8_t*>(engineConfiguration);
+
+	EXPECT_EQ(crc32(page, TOTAL_CONFIG_SIZE), requestSettingsPageCrc(ts));
+
+	uint8_t val = page[TOTAL_CONFIG_SIZE - 10] + 1;
+	ts.handleWriteChunkCommand(&channel, TS_PAGE_SETTINGS, TOTAL_CONFIG_SIZE - 10, 1, &val);
+	EXPECT_EQ(crc32(page, TOTAL_CONFIG_SIZE), requestSettingsPageCrc(ts));
+
+	// change which does not come through TS
+	engineConfiguration->cylindersCount++;
+	incrementGlobalConfigurationVersion("test");
+	EXPECT_EQ(crc32(page, TOTAL_CONFIG_SIZE), requestSettingsPageCrc(ts));
+
+	// firmware changes VE table without configuration version bump
+	LtftState ltft;
+	ltft.reset();
+	ltft.trims[0][0][0] = 0.1f;
+	ltft.applyToVe();
+	EXPECT_EQ(crc32(page, TOTAL_CONFIG_SIZE), requestSettingsPageCrc(ts));
+}
+
+TEST(TunerstudioCommands, writeChunkReachesThrottleInverseTable) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	::testing::NiceMock<MockTsChannel> channel;
+	TunerStudio ts;
+	ThrottleModel& model = engine->module<ThrottleModel>().unmock();
+
+	size_t size = efi::size(config->throttleEstimateEffectiveAreaValues);
+	for (size_t i = 0; i < size; i++) {
+		float x = i / (size - 1.0f);
+		config->throttleEstimateEffectiveAreaValues[i] = 500 * x * x;
+	}
+	model.onSlowCallback();
+	float before = model.throttlePositionForFlow(50, 0.5, 100, 20);
+
+	// twice the area at every position, written by TS without burn
+	decltype(config->throttleEstimateEffectiveAreaValues) doubled;
+	for (size_t i = 0; i < size; i++) {
+		doubled[i] = 2 * config->throttleEstimateEffectiveAreaValues[i];
+	}
+	ts.handleWriteChunkCommand(&channel, TS_PAGE_SETTINGS, offsetof(persistent_config_s, throttleEstimateEffectiveAreaValues),
+		sizeof(doubled), doubled);
+
+	// model notices the new curve by itself
+	model.onSlowCallback();
+	float after = model.throttlePositionForFlow(50, 0.5, 100, 20);
+	EXPECT_LT(after, before);
+	EXPECT_NEAR(model.throttlePositionForFlowSolver(50, 0.5, 100, 20), after, 0.5);
+}
+
+#if EFI_TS_OUTPUT_DELTA
+
+struct DeltaResponse {
+	uint8_t type;
+	uint8_t sequence;
+	const uint8_t *body;
+	size_t bodySize;
+};
+
+static DeltaResponse parseDeltaResponse(const BufferTsChannel& channel) {
+	size_t packetSize = (st5TestBuffer[0] << 8) | st5TestBuffer[1];
+	EXPECT_EQ(channel.writeIdx, packetSize + 6);
+	EXPECT_EQ(st5TestBuffer[2], TS_RESPONSE_OK);
+	// response code and frame header
+	return { st5TestBuffer[3], st5TestBuffer[4], &st5TestBuffer[5], packetSize - 1 - TS_OUTPUT_DELTA_HEADER_SIZE };
+}
+
+static int32_t readDebugIntField5(const uint8_t *image) {
+	int32_t value;
+	memcpy(&value, image + offsetof(output_channels_s, debugIntField5), sizeof(value));
+	return value;
+}
+
+TEST(TunerstudioCommands, outputChannelsDeltaResync) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	BufferTsChannel channel;
+	BufferTsChannel otherChannel;
+	TunerStudio ts;
+	static uint8_t image[TS_TOTAL_OUTPUT_SIZE];
+
+	// nothing applied yet: full frame
+	ts.cmdOutputChannelsDelta(&channel, 0, TS_TOTAL_OUTPUT_SIZE, -1);
+	DeltaResponse response = parseDeltaResponse(channel);
+	ASSERT_EQ(TS_OUTPUT_DELTA_FULL, response.type);
+	ASSERT_EQ((size_t)TS_TOTAL_OUTPUT_SIZE, response.bodySize);
+	memcpy(image, response.body, response.bodySize);
+	uint8_t sequence = response.sequence;
+
+	engine->outputChannels.debugIntField5 = 12345;
+	// let the live data snapshot expire
+	advanceTimeUs(2 * MS2US(LIVE_DATA_SNAPSHOT_PERIOD_MS));
+	channel.reset();
+	ts.cmdOutputChannelsDelta(&channel, 0, TS_TOTAL_OUTPUT_SIZE, sequence);
+	response = parseDeltaResponse(channel);
+	ASSERT_EQ(TS_OUTPUT_DELTA_CHANGES, response.type);
+	EXPECT_LT(response.bodySize, (size_t)TS_TOTAL_OUTPUT_SIZE);
+	EXPECT_EQ((uint8_t)(sequence + 1), response.sequence);
+	ASSERT_TRUE(tsOutputDeltaApply(image, sizeof(image), response.body, response.bodySize));
+	EXPECT_EQ(12345, readDebugIntField5(image));
+	sequence = response.sequence;
+
+	// another channel has its own shadow
+	otherChannel.reset();
+	ts.cmdOutputChannelsDelta(&otherChannel, 0, TS_TOTAL_OUTPUT_SIZE, -1);
+	EXPECT_EQ(TS_OUTPUT_DELTA_FULL, parseDeltaResponse(otherChannel).type);
+
+	// nothing changed
+	channel.reset();
+	ts.cmdOutputChannelsDelta(&channel, 0, TS_TOTAL_OUTPUT_SIZE, sequence);
+	response = parseDeltaResponse(channel);
+	EXPECT_EQ(TS_OUTPUT_DELTA_CHANGES, response.type);
+	sequence = response.sequence;
+
+	// client has missed a frame: full frame again
+	engine->outputChannels.debugIntField5 = 54321;
+	advanceTimeUs(2 * MS2US(LIVE_DATA_SNAPSHOT_PERIOD_MS));
+	channel.reset();
+	ts.cmdOutputChannelsDelta(&channel, 0, TS_TOTAL_OUTPUT_SIZE, (uint8_t)(sequence - 1));
+	response = parseDeltaResponse(channel);
+	ASSERT_EQ(TS_OUTPUT_DELTA_FULL, response.type);
+	EXPECT_EQ(54321, readDebugIntField5(response.body));
+
+	// different range: full frame
+	channel.reset();
+	ts.cmdOutputChannelsDelta(&channel, 0, 100, response.sequence);
+	response = parseDeltaResponse(channel);
+	EXPECT_EQ(TS_OUTPUT_DELTA_FULL, response.type);
+	EXPECT_EQ(100u, response.bodySize);
+}
+
+#endif // EFI_TS_OUTPUT_DELTA
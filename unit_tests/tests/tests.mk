@@ -3,6 +3,8 @@ TESTS_SRC_CPP = \
 	tests/log_replay_sandbox.cpp \
 	tests/trigger/test_all_triggers.cpp \
 	tests/trigger/test_trigger_sequence_finder.cpp \
+	tests/trigger/test_trigger_emulator_timeline.cpp \
+	tests/trigger/test_trigger_shape_db.cpp \
 	tests/trigger/test_2_stroke.cpp \
 	tests/trigger/test_symmetrical_crank.cpp \
 	tests/trigger/test_trigger_decoder.cpp \
@@ -50,6 +52,7 @@ TESTS_SRC_CPP = \
 	tests/ignition_injection/test_multispark.cpp \
 	tests/ignition_injection/test_hd_cranking.cpp \
 	tests/ignition_injection/test_ignition_scheduling.cpp \
+	tests/ignition_injection/test_phase_event_ring.cpp \
 	tests/ignition_injection/test_fuelCut.cpp \
 	tests/ignition_injection/test_fuel_computer.cpp \
 	tests/ignition_injection/test_injector_model.cpp \
@@ -94,6 +97,7 @@ TESTS_SRC_CPP = \
 	tests/nitrous_control/test_nitrous_fuel_adder.cpp \
 	tests/nitrous_control/test_nitrous_ignition_retard.cpp \
 	tests/test_fft.cpp \
+	tests/test_adc_accumulate.cpp \
 	tests/lua/test_lua_basic.cpp \
 	tests/lua/test_bit_range_msb.cpp \
 	tests/lua/test_bit_range.cpp \
@@ -118,8 +122,10 @@ TESTS_SRC_CPP = \
 	tests/lua/test_lua_debounce.cpp \
 	tests/test_change_engine_type.cpp \
 	tests/test_big_buffer.cpp \
+	tests/test_tooth_log_compact.cpp \
 	tests/system/test_periodic_thread_controller.cpp \
 	tests/system/test_scheduler.cpp \
+	tests/system/test_edge_latency.cpp \
 	tests/test_util.cpp \
 	tests/test_start_stop.cpp \
 	tests/test_hardware_reinit.cpp \
@@ -127,6 +133,7 @@ TESTS_SRC_CPP = \
 	tests/test_kline_bytes_aggregator.cpp \
 	tests/test_engine_math.cpp \
 	tests/test_throttle_model.cpp \
+	tests/test_torque_estimator.cpp \
 	tests/test_fasterEngineSpinningUp.cpp \
 	tests/test_dwell_corner_case_issue_796.cpp \
 	tests/test_idle_controller.cpp \
@@ -136,13 +143,18 @@ TESTS_SRC_CPP = \
 	tests/ignition_injection/test_fuel_wall_wetting.cpp \
 	tests/test_one_cylinder_logic.cpp \
 	tests/test_tunerstudio.cpp \
+	tests/test_ts_output_delta.cpp \
+	tests/test_live_data_snapshot.cpp \
+	tests/test_trigger_scope_envelope.cpp \
 	tests/test_pwm_generator.cpp \
+	tests/test_pwm_bank.cpp \
 	tests/test_log_buffer.cpp \
 	tests/test_event_queue.cpp \
 	tests/test_cpp_memory_layout.cpp \
 	tests/test_pid.cpp \
 	tests/test_accel_enrichment.cpp \
 	tests/test_gpiochip.cpp \
+	tests/test_spi_batch.cpp \
 	tests/test_deadband.cpp \
 	tests/test_sticky_pps.cpp \
 	tests/test_knock.cpp \
@@ -152,6 +164,7 @@ TESTS_SRC_CPP = \
 	tests/sensor/func_sensor.cpp \
 	tests/sensor/function_pointer_sensor.cpp \
 	tests/sensor/mock_sensor.cpp \
+	tests/sensor/test_sensor_snapshot.cpp \
 	tests/sensor/sensor_reader.cpp \
 	tests/sensor/lin_func.cpp \
 	tests/sensor/resist_func.cpp \
@@ -200,6 +213,7 @@ TESTS_SRC_CPP = \
 	tests/controllers/test_long_term_fuel_trim.cpp \
 	tests/ignition_injection/test_ignition_state.cpp \
 	tests/core/test_main_loop.cpp \
+	tests/core/test_engine_module_timing.cpp \
 	tests/test_trip_odometer.cpp \
 	tests/controllers/modules/map_averaging/test_map_averaging.cpp \
 	tests/util/test_utils.cpp \
@@ -207,6 +221,7 @@ TESTS_SRC_CPP = \
 	tests/controllers/algo/test_closed_loop_idle.cpp \
 	tests/controllers/modules/test_example_module.cpp \
 	tests/controllers/test_flash.cpp \
+	tests/controllers/test_flash_journal.cpp \
 	tests/controllers/modules/vvl_controller/vvl_controller_rpm_condition.cpp \
 	tests/controllers/modules/vvl_controller/vvl_controller_clt_condition.cpp \
 	tests/controllers/modules/vvl_controller/vvl_controller_tps_condition.cpp \
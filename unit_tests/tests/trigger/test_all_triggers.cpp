@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "trigger_meta_generated.h"
 #include "auto_generated_sync_edge.h"
+#include "trigger_shape_db.h"
 
 // uncomment to test starting from specific trigger
 //#define TEST_FROM_TRIGGER_ID ((int)trigger_type_e::TT_MAZDA_MIATA_NA)
@@ -91,6 +92,12 @@ TEST_P(AllTriggersFixture, TestTrigger) {
 		GTEST_SKIP() << "Trigger type " << (int)tt << " has shapeDefinitionError (not implemented)";
 	}
 
+	// firmware takes sync point from the table, unit tests always simulate
+	expected<uint32_t> precomputedSyncIndex = lookupTriggerSyncIndex(*shape, tt);
+	if (precomputedSyncIndex) {
+		ASSERT_EQ(shape->getTriggerWaveformSynchPointIndex(), (int)precomputedSyncIndex.Value) << "stale trigger_shape_db_generated.h";
+	}
+
 	fprintf(fp, "TRIGGERTYPE %d %d %s %.2f\n", tt, shape->getLength(), getTrigger_type_e(tt), shape->tdcPosition);
 
 	fprintf(fp, "%s=%s\n", TRIGGER_KNOWN_OPERATION_MODE, shape->knownOperationMode ? "true" : "false");
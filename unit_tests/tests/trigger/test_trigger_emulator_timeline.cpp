@@ -0,0 +1,158 @@
+/**
+ * @file test_trigger_emulator_timeline.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "trigger_simulator.h"
+#include "trigger_emulator_timeline.h"
+
+#include <map>
+
+static TriggerWaveform makeShape(operation_mode_e mode, trigger_config_s config) {
+	TriggerWaveform shape;
+	shape.initializeTriggerWaveform(mode, config);
+	return shape;
+}
+
+struct ExpectedEdge {
+	uint16_t setMask = 0;
+	uint16_t resetMask = 0;
+};
+
+// edges the way TriggerStimulatorHelper::feedSimulatedEvent walks the shape
+static void addExpectedEdges(std::map<uint32_t, ExpectedEdge> &edges, const TriggerWaveform &shape, int channel, int repetitions) {
+	for (int i = 0; i < (int)shape.getSize() * repetitions; i++) {
+		int stateIndex = i % shape.getSize();
+		for (int waveIndex = 0; waveIndex < PWM_PHASE_MAX_WAVE_PER_PWM; waveIndex++) {
+			if (!needEvent(stateIndex, shape.wave, waveIndex)) {
+				continue;
+			}
+
+			uint32_t time = getSimulatedEventTime(shape, i) / repetitions;
+			uint16_t bit = TRIGGER_EMULATOR_PIN_BIT(channel, waveIndex);
+			if (shape.wave.getChannelState(waveIndex, stateIndex) == TriggerValue::RISE) {
+				edges[time].setMask |= bit;
+			} else {
+				edges[time].resetMask |= bit;
+			}
+		}
+	}
+}
+
+static void assertTimeline(const TriggerEmulatorTimeline &timeline, const std::map<uint32_t, ExpectedEdge> &expected) {
+	ASSERT_EQ(expected.size(), timeline.size());
+
+	uint32_t position = timeline.getFirstEdgeTicks();
+	uint32_t total = 0;
+	size_t index = 0;
+	for (auto const& [time, edge] : expected) {
+		if (index > 0) {
+			position += timeline[index].deltaTicks;
+		}
+		total += timeline[index].deltaTicks;
+
+		EXPECT_EQ(time, position) << index;
+		EXPECT_EQ(edge.setMask, timeline[index].setMask) << index;
+		EXPECT_EQ(edge.resetMask, timeline[index].resetMask) << index;
+		index++;
+	}
+
+	// deltas including the wrap around add up to exactly one cycle
+	EXPECT_EQ(TriggerEmulatorTimeline::cycleTicks, total);
+}
+
+TEST(TriggerEmulatorTimeline, sameEdgesAsStimulator) {
+	TriggerWaveform crank = makeShape(FOUR_STROKE_CAM_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL, 60, 2 });
+
+	const MultiChannelStateSequence *waveforms[NUM_EMULATOR_CHANNELS] = { &crank.wave };
+	int repetitions[NUM_EMULATOR_CHANNELS];
+	getTriggerEmulatorRepetitions(FOUR_STROKE_CAM_SENSOR, repetitions);
+	ASSERT_EQ(1, repetitions[0]);
+
+	static TriggerEmulatorTimeline timeline;
+	ASSERT_TRUE(timeline.compile(waveforms, repetitions));
+
+	std::map<uint32_t, ExpectedEdge> expected;
+	addExpectedEdges(expected, crank, 0, 1);
+	// 58 teeth, both edges
+	EXPECT_EQ(116u, expected.size());
+	assertTimeline(timeline, expected);
+}
+
+TEST(TriggerEmulatorTimeline, crankAndCamMerged) {
+	TriggerWaveform crank = makeShape(FOUR_STROKE_CRANK_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL, 36, 1 });
+	TriggerWaveform cam = makeShape(FOUR_STROKE_CAM_SENSOR, { trigger_type_e::TT_HALF_MOON, 0, 0 });
+
+	const MultiChannelStateSequence *waveforms[NUM_EMULATOR_CHANNELS] = { &crank.wave, &cam.wave };
+	int repetitions[NUM_EMULATOR_CHANNELS];
+	getTriggerEmulatorRepetitions(FOUR_STROKE_CRANK_SENSOR, repetitions);
+	ASSERT_EQ(2, repetitions[0]);
+	ASSERT_EQ(1, repetitions[1]);
+
+	static TriggerEmulatorTimeline timeline;
+	ASSERT_TRUE(timeline.compile(waveforms, repetitions));
+
+	std::map<uint32_t, ExpectedEdge> expected;
+	addExpectedEdges(expected, crank, 0, 2);
+	addExpectedEdges(expected, cam, 1, 1);
+	assertTimeline(timeline, expected);
+
+	// at least one cam edge lands on a crank edge and shares its entry
+	size_t separateCount = 0;
+	for (size_t i = 0; i < timeline.size(); i++) {
+		separateCount += __builtin_popcount(timeline[i].setMask | timeline[i].resetMask);
+	}
+	EXPECT_LT(timeline.size(), separateCount);
+}
+
+TEST(TriggerEmulatorTimeline, overflow) {
+	TriggerWaveform crank = makeShape(FOUR_STROKE_CRANK_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL, 60, 2 });
+
+	const MultiChannelStateSequence *waveforms[NUM_EMULATOR_CHANNELS] = { &crank.wave };
+	int repetitions[NUM_EMULATOR_CHANNELS] = { 12 };
+
+	static TriggerEmulatorTimeline timeline;
+	EXPECT_FALSE(timeline.compile(waveforms, repetitions));
+	EXPECT_EQ(0u, timeline.size());
+
+	repetitions[0] = 1;
+	EXPECT_TRUE(timeline.compile(waveforms, repetitions));
+	EXPECT_EQ(116u, timeline.size());
+}
+
+TEST(TriggerEmulatorTimeline, eventPhasesSurviveWaveformRebuild) {
+	TriggerWaveform crank = makeShape(FOUR_STROKE_CRANK_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL, 36, 1 });
+
+	const MultiChannelStateSequence *waveforms[NUM_EMULATOR_CHANNELS] = { &crank.wave };
+	int repetitions[NUM_EMULATOR_CHANNELS];
+	getTriggerEmulatorRepetitions(FOUR_STROKE_CRANK_SENSOR, repetitions);
+
+	static TriggerEmulatorTimeline timeline;
+	ASSERT_TRUE(timeline.compile(waveforms, repetitions));
+
+	// expected walk, first edge of a channel gets its first phase
+	std::vector<int> expected;
+	int phase = -1;
+	for (size_t i = 0; i < 2 * crank.getSize(); i++) {
+		do {
+			phase = (phase + 1) % crank.getSize();
+		} while (!needEvent(phase, crank.wave, 0));
+		expected.push_back(phase);
+	}
+
+	// TriggerWaveform::initialize() leaves zero phases while shapes are being rebuilt
+	crank.initialize(FOUR_STROKE_CRANK_SENSOR, SyncEdge::Rise);
+	ASSERT_EQ(0, crank.wave.phaseCount);
+
+	phase = -1;
+	for (size_t i = 0; i < expected.size(); i++) {
+		phase = timeline.getNextEventPhase(0, phase);
+		EXPECT_EQ(expected[i], phase) << i;
+	}
+
+	// channel without waveform stays where it is
+	EXPECT_EQ(-1, timeline.getNextEventPhase(1, -1));
+}
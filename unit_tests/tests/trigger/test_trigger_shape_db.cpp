@@ -0,0 +1,129 @@
+/**
+ * @file test_trigger_shape_db.cpp
+ *
+ * Checks trigger_shape_db_generated.h against simulation, see trigger_shape_db.h
+ * 'make trigger_shape_db' regenerates it
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "trigger_shape_db.h"
+#include "mock_trigger_configuration.h"
+
+#include <array>
+
+#include "trigger_shape_db_generated.h"
+
+#define TRIGGER_SHAPE_DB_FILE_NAME "../firmware/controllers/trigger/decoders/trigger_shape_db_generated.h"
+
+// operation modes lookupOperationMode() could give to a primary trigger, cams use FOUR_STROKE_CAM_SENSOR
+static const operation_mode_e shapeDbModes[] = { FOUR_STROKE_CRANK_SENSOR, FOUR_STROKE_CAM_SENSOR, TWO_STROKE };
+
+static bool operator<(const TriggerShapeDbEntry& a, const TriggerShapeDbEntry& b) {
+	return a.shapeHash != b.shapeHash ? a.shapeHash < b.shapeHash : a.triggerType < b.triggerType;
+}
+
+static bool isSameKey(const TriggerShapeDbEntry& a, const TriggerShapeDbEntry& b) {
+	return a.shapeHash == b.shapeHash && a.triggerType == b.triggerType;
+}
+
+static std::vector<TriggerShapeDbEntry> simulateAllShapes() {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	engineConfiguration->triggerInputPins[1] = Gpio::Unassigned;
+
+	std::vector<TriggerShapeDbEntry> entries;
+
+	for (int type = 1; type < (int)trigger_type_e::TT_UNUSED; type++) {
+		trigger_config_s config = { (trigger_type_e)type, 0, 0 };
+		MockTriggerConfiguration triggerConfiguration(config);
+		triggerConfiguration.update();
+
+		for (operation_mode_e mode : shapeDbModes) {
+			static TriggerWaveform shape;
+			TriggerDecoderBase state("db");
+
+			try {
+				shape.initializeTriggerWaveform(mode, config);
+				if (shape.shapeDefinitionError) {
+					continue;
+				}
+
+				uint32_t syncIndex = state.findTriggerZeroEventIndex(shape, triggerConfiguration);
+				if (shape.shapeDefinitionError || syncIndex == (uint32_t)EFI_ERROR_CODE) {
+					continue;
+				}
+
+				entries.push_back({ getTriggerShapeHash(shape), (uint16_t)type, (uint16_t)syncIndex });
+			} catch (...) {
+				// not implemented for this mode
+			}
+		}
+	}
+
+	// ambiguous triggers give the same shape in every mode
+	std::sort(entries.begin(), entries.end());
+	entries.erase(std::unique(entries.begin(), entries.end(), isSameKey), entries.end());
+
+	return entries;
+}
+
+TEST(TriggerShapeDb, matchesSimulation) {
+	std::vector<TriggerShapeDbEntry> entries = simulateAllShapes();
+	ASSERT_GT(entries.size(), 50u);
+
+	ASSERT_EQ(entries.size(), triggerShapeDb.size()) << "stale trigger_shape_db_generated.h, run 'make trigger_shape_db'";
+	for (size_t i = 0; i < entries.size(); i++) {
+		const TriggerShapeDbEntry& built = triggerShapeDb[i];
+		const char* name = getTrigger_type_e((trigger_type_e)entries[i].triggerType);
+		EXPECT_EQ(entries[i].shapeHash, built.shapeHash) << name;
+		EXPECT_EQ(entries[i].triggerType, built.triggerType) << name;
+		EXPECT_EQ(entries[i].syncIndex, built.syncIndex) << name;
+	}
+}
+
+// writes the file, run with 'make trigger_shape_db'
+TEST(TriggerShapeDb, DISABLED_generate) {
+	std::vector<TriggerShapeDbEntry> entries = simulateAllShapes();
+	ASSERT_GT(entries.size(), 50u);
+
+	FILE *fp = fopen(TRIGGER_SHAPE_DB_FILE_NAME, "w");
+	ASSERT_TRUE(fp != nullptr) << TRIGGER_SHAPE_DB_FILE_NAME;
+
+	fprintf(fp, "// was generated automatically by rusEFI unit test suite, see test_trigger_shape_db.cpp\n");
+	fprintf(fp, "// do not edit manually, run 'make trigger_shape_db' in unit_tests\n");
+	fprintf(fp, "#pragma once\n\n");
+	fprintf(fp, "static constexpr std::array<TriggerShapeDbEntry, %d> triggerShapeDb = {{\n", (int)entries.size());
+	for (const TriggerShapeDbEntry& entry : entries) {
+		fprintf(fp, "\t{ 0x%08x, %d, %d }, // %s\n", entry.shapeHash, entry.triggerType, entry.syncIndex,
+			getTrigger_type_e((trigger_type_e)entry.triggerType));
+	}
+	fprintf(fp, "}};\n");
+	fclose(fp);
+
+	printf("%d trigger shapes exported to %s\n", (int)entries.size(), TRIGGER_SHAPE_DB_FILE_NAME);
+}
+
+TEST(TriggerShapeDb, hashFollowsWhatDecoderSees) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	static TriggerWaveform shape;
+	shape.initializeTriggerWaveform(FOUR_STROKE_CRANK_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL_60_2, 0, 0 });
+	uint32_t crankHash = getTriggerShapeHash(shape);
+
+	shape.initializeTriggerWaveform(FOUR_STROKE_CRANK_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL_60_2, 0, 0 });
+	EXPECT_EQ(crankHash, getTriggerShapeHash(shape));
+
+	// same wheel on the cam is a different shape
+	shape.initializeTriggerWaveform(FOUR_STROKE_CAM_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL_60_2, 0, 0 });
+	EXPECT_NE(crankHash, getTriggerShapeHash(shape));
+
+	// gap override goes to the simulation
+	shape.initializeTriggerWaveform(FOUR_STROKE_CRANK_SENSOR, { trigger_type_e::TT_TOOTHED_WHEEL_60_2, 0, 0 });
+	shape.setTriggerSynchronizationGap3(0, 1.8, 4);
+	EXPECT_NE(crankHash, getTriggerShapeHash(shape));
+
+	shape.setShapeDefinitionError(true);
+	EXPECT_FALSE(lookupTriggerSyncIndex(shape, trigger_type_e::TT_TOOTHED_WHEEL_60_2));
+}
@@ -0,0 +1,78 @@
+/**
+ * @file test_crc32_fast.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "crc32_fast.h"
+
+static void fillPattern(uint8_t *data, size_t size) {
+	uint32_t x = 12345;
+	for (size_t i = 0; i < size; i++) {
+		x = x * 1103515245 + 12345;
+		data[i] = x >> 16;
+	}
+}
+
+TEST(util, crc32FastCheckValue) {
+	const char *check = "123456789";
+	EXPECT_EQ(0xCBF43926u, crc32Fast(check, 9));
+	EXPECT_EQ(0u, crc32Fast(check, 0));
+}
+
+TEST(util, crc32FastSameAsCrc32) {
+	uint8_t data[300];
+	fillPattern(data, sizeof(data));
+
+	// every length and misalignment around the eight byte step
+	for (size_t start = 0; start < 8; start++) {
+		for (size_t size = 0; start + size <= sizeof(data); size++) {
+			ASSERT_EQ(crc32(data + start, size), crc32Fast(data + start, size)) << start << "+" << size;
+		}
+	}
+}
+
+TEST(util, crc32FastIncSameAsCrc32Inc) {
+	uint8_t data[300];
+	fillPattern(data, sizeof(data));
+
+	for (size_t split = 0; split <= sizeof(data); split += 7) {
+		uint32_t expected = crc32inc(data + split, crc32(data, split), sizeof(data) - split);
+		uint32_t actual = crc32FastInc(data + split, crc32Fast(data, split), sizeof(data) - split);
+		ASSERT_EQ(expected, actual) << split;
+		EXPECT_EQ(crc32(data, sizeof(data)), actual);
+	}
+}
+
+TEST(util, crc32PageCache) {
+	static uint8_t page[2000];
+	fillPattern(page, sizeof(page));
+
+	Crc32PageCache<sizeof(page), 256> cache;
+	EXPECT_EQ(8u, cache.blockCount);
+	EXPECT_EQ(crc32(page, sizeof(page)), cache.get(page));
+	EXPECT_EQ(0u, cache.getDirtyBlockCount());
+
+	// write in the last but one block
+	page[1700] ^= 0x55;
+	cache.markDirty(1700, 1);
+	EXPECT_EQ(2u, cache.getDirtyBlockCount());
+	EXPECT_EQ(crc32(page, sizeof(page)), cache.get(page));
+	EXPECT_EQ(0u, cache.getDirtyBlockCount());
+
+	// write across block boundary
+	page[255] ^= 1;
+	page[256] ^= 1;
+	cache.markDirty(255, 2);
+	EXPECT_EQ(8u, cache.getDirtyBlockCount());
+	EXPECT_EQ(crc32(page, sizeof(page)), cache.get(page));
+
+	// different page: everything is read again
+	static uint8_t otherPage[2000];
+	EXPECT_EQ(crc32(otherPage, sizeof(otherPage)), cache.get(otherPage));
+
+	cache.invalidate();
+	EXPECT_EQ(8u, cache.getDirtyBlockCount());
+}
@@ -0,0 +1,70 @@
+/**
+ * @file test_sliding_window_max.cpp
+ *
+ * @date Oct 18, 2026
+ */
+
+#include "pch.h"
+
+#include "sliding_window_max.h"
+
+#include <vector>
+
+TEST(SlidingWindowMax, basic) {
+	SlidingWindowMax<float, 8> window;
+	window.setWindow(3);
+	EXPECT_TRUE(window.isEmpty());
+
+	window.add(5);
+	EXPECT_EQ(5, window.getMax());
+	EXPECT_EQ(0u, window.getMaxAge());
+
+	window.add(1);
+	window.add(2);
+	EXPECT_EQ(5, window.getMax());
+	EXPECT_EQ(2u, window.getMaxAge());
+
+	// 5 falls out of the window
+	window.add(0);
+	EXPECT_EQ(2, window.getMax());
+	EXPECT_EQ(1u, window.getMaxAge());
+
+	// ties go to the newest value
+	window.add(2);
+	EXPECT_EQ(2, window.getMax());
+	EXPECT_EQ(0u, window.getMaxAge());
+
+	window.clear();
+	EXPECT_TRUE(window.isEmpty());
+	window.add(-3);
+	EXPECT_EQ(-3, window.getMax());
+}
+
+TEST(SlidingWindowMax, sameAsScan) {
+	srand(1234);
+
+	for (size_t windowSize : { 1, 2, 3, 7, 32, 64 }) {
+		SlidingWindowMax<float, 64> window;
+		window.setWindow(windowSize);
+		std::vector<float> values;
+
+		for (int i = 0; i < 2000; i++) {
+			// few distinct values so there are plenty of ties
+			float value = (rand() % 21) - 10;
+			values.push_back(value);
+			window.add(value);
+
+			// newest to oldest, strictly greater wins like TpsAccelEnrichment used to do
+			size_t length = std::min(values.size(), windowSize);
+			size_t maxAge = 0;
+			for (size_t age = 1; age < length; age++) {
+				if (values[values.size() - 1 - age] > values[values.size() - 1 - maxAge]) {
+					maxAge = age;
+				}
+			}
+
+			ASSERT_EQ(values[values.size() - 1 - maxAge], window.getMax()) << windowSize << " " << i;
+			ASSERT_EQ(maxAge, window.getMaxAge()) << windowSize << " " << i;
+		}
+	}
+}
@@ -4,6 +4,7 @@ CPPSRC += 	$(PROJECT_DIR)/../unit_tests/tests/util/test_buffered_writer.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_error_accumulator.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_exp_average.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_honda_crc.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_crc32_fast.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_closed_loop_controller.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_scaled_channel.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_timer.cpp \
@@ -11,5 +12,6 @@ CPPSRC += 	$(PROJECT_DIR)/../unit_tests/tests/util/test_buffered_writer.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_biquad.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_lua_biquad.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_hash.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_sliding_window_max.cpp \
 
 INCDIR += $(PROJECT_DIR)/controllers/system